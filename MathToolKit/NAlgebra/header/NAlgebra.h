@@ -87,12 +87,41 @@
  * u(0, 1).fill(6);
  * std::cout << u(0, 2) + v(4, 6);
  * @endcode
+ *
+ * **Views**
+ *
+ * Views are lightweight handles on blocks of vectors and matrices. They allow in place operations without copy and
+ * do not modify the viewed object state :
+ *
+ * @code{.cpp}
+ * mat_t a{mat_t::ones(4)};
+ * auto block = a.view(0, 0, 1, 1);
+ * block *= 2; // upper-left 2x2 block of a is filled with 2
+ * std::cout << block.det(); // displays "0"
+ * @endcode
  * @}
  */
 
 #include <NVector.h>
 #include <NPMatrix.h>
+#include <NLU.h>
+#include <NCholesky.h>
+#include <NQR.h>
+#include <NEigen.h>
+#include <NSVD.h>
+#include <NBandMatrix.h>
+#include <NSparseMatrix.h>
+#include <NBatchMatrix.h>
+#include <NLinearOperator.h>
+#include <NPreconditioner.h>
+#include <NKrylov.h>
+#include <NVectorView.h>
+#include <NMatrixView.h>
+#include <NExpression.h>
+#include <NFixedVector.h>
+#include <NFixedMatrix.h>
 #include <Vector3.h>
+#include <Vector3Batch.h>
 #include <Pixel.h>
 #include <AESByte.h>
 #include <thirdparty.h>
@@ -0,0 +1,78 @@
+#ifndef MATHTOOLKIT_NALIGNEDALLOCATOR_H
+#define MATHTOOLKIT_NALIGNEDALLOCATOR_H
+
+#include <cstdlib>
+#include <new>
+#include <limits>
+
+/**
+ * Default alignment in bytes of the storage of `NVector` and `NPMatrix`, size of a cache line and of an AVX-512
+ * register.
+ */
+#define NALIGNED_ALLOCATOR_ALIGNMENT 64
+
+/**
+ * @ingroup NAlgebra
+ * @{
+ * @class   NAlignedAllocator
+ * @date    17/10/2026
+ * @brief   Standard allocator returning memory aligned on `Alignment` bytes.
+ *
+ * @details This allocator is the default storage allocator of `NVector` and `NPMatrix`. It guarantees that the first
+ *          coordinate of a vector or a matrix starts a cache line, so that SIMD kernels never split a load between
+ *          two cache lines on the first elements and that two vectors never share a cache line.
+ *
+ *          The allocator is stateless, all instances compare equal.
+ *
+ *          @section Definitions
+ *             - `Alignment` : Power of two greater or equal to `sizeof(void *)`.
+ */
+
+template<typename T, size_t Alignment = NALIGNED_ALLOCATOR_ALIGNMENT>
+class NAlignedAllocator {
+
+public:
+
+    static_assert((Alignment & (Alignment - 1)) == 0 && Alignment >= sizeof(void *),
+                  "Alignment must be a power of two greater or equal to sizeof(void *)");
+
+    typedef T value_type;
+
+    template<typename U>
+    struct rebind {
+        typedef NAlignedAllocator<U, Alignment> other;
+    };
+
+    NAlignedAllocator() = default;
+
+    template<typename U>
+    NAlignedAllocator(const NAlignedAllocator<U, Alignment> &) {}
+
+    T *allocate(size_t n) {
+        if (n > std::numeric_limits<size_t>::max() / sizeof(T)) {
+            throw std::bad_alloc();
+        }
+
+        void *ptr = nullptr;
+        if (posix_memalign(&ptr, Alignment, n * sizeof(T)) != 0) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T *>(ptr);
+    }
+
+    void deallocate(T *ptr, size_t) { free(ptr); }
+
+    template<typename U>
+    inline friend bool operator==(const NAlignedAllocator<T, Alignment> &, const NAlignedAllocator<U, Alignment> &) {
+        return true;
+    }
+
+    template<typename U>
+    inline friend bool operator!=(const NAlignedAllocator<T, Alignment> &, const NAlignedAllocator<U, Alignment> &) {
+        return false;
+    }
+};
+
+/** @} */
+
+#endif //MATHTOOLKIT_NALIGNEDALLOCATOR_H
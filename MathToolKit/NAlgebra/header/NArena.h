@@ -0,0 +1,249 @@
+//
+// Created on 17/10/2026.
+//
+
+#ifndef MATHTOOLKIT_NARENA_H
+#define MATHTOOLKIT_NARENA_H
+
+#include "thirdparty.h"
+#include "NAlignedAllocator.h"
+
+/**
+ * Initial capacity in bytes of the arena of a thread.
+ */
+#define NARENA_INITIAL_CAPACITY 65536
+
+/**
+ * Greatest capacity in bytes the block of an arena grows to, larger usages keep being served by the heap.
+ */
+#define NARENA_MAX_CAPACITY 16777216
+
+/**
+ * @ingroup NAlgebra
+ * @{
+ * @class   NArena
+ * @date    17/10/2026
+ * @brief   Thread-local bump allocator for the scratch buffers of the library.
+ *
+ * @details Each thread owns an arena made of a single aligned block. Allocating only moves a cursor forward and
+ *          memory is never freed individually : it is given back at once when the enclosing `NArenaScope` ends.
+ *
+ *          A request that does not fit the block is served by the heap and recorded as an overflow. When the
+ *          outermost scope of the thread ends, the overflows are freed and the block is grown to the peak usage
+ *          observed, so that a loop repeating the same operations performs no heap allocation after its first
+ *          iteration. The counters `heapAllocations()` and `allocations()` allow to check this property.
+ *
+ *          The block never grows beyond `NARENA_MAX_CAPACITY` : problem-sized temporaries above this bound are
+ *          allocated on the heap and freed when their scope ends, instead of being kept by every thread for the
+ *          life of the process. `trim()` gives the block back down to its initial capacity.
+ *
+ *          Memory returned by the arena of a thread must only be used while the scope that allocated it is alive
+ *          and must not be retained by another thread after that.
+ *
+ *          @section Definitions
+ *             - `Mark` : Position of the cursor, scopes rewind the arena to the mark taken at their construction.
+ */
+
+class NArena {
+
+public:
+
+    struct Mark {
+        size_t offset;
+        size_t overflows;
+    };
+
+    /**
+     * @brief Arena of the calling thread.
+     */
+    static NArena &local();
+
+    ~NArena();
+
+    NArena(const NArena &) = delete;
+
+    NArena &operator=(const NArena &) = delete;
+
+    // ALLOCATION
+
+    /**
+     * @param size number of bytes.
+     * @param alignment power of two, at most `NALIGNED_ALLOCATOR_ALIGNMENT`.
+     * @brief Allocate `size` bytes aligned on `alignment` bytes.
+     * @details Throws `std::bad_alloc` if the heap is exhausted.
+     */
+    void *allocate(size_t size, size_t alignment = NALIGNED_ALLOCATOR_ALIGNMENT);
+
+    /**
+     * @brief Current position of the arena, to be given back to `rewind()`.
+     */
+    Mark mark();
+
+    /**
+     * @param mark position returned by the matching call to `mark()`.
+     * @brief Free all the memory allocated since `mark` was taken.
+     * @details Marks must be rewound in reverse order, `NArenaScope` does it automatically.
+     */
+    void rewind(const Mark &mark);
+
+    /**
+     * @brief Shrink the block back to `NARENA_INITIAL_CAPACITY` and reset the peak usage.
+     * @details Does nothing while a scope of the arena is alive.
+     */
+    void trim();
+
+    // GETTERS
+
+    /**
+     * @brief Number of blocks requested to the heap by this arena since its creation.
+     */
+    inline size_t heapAllocations() const { return _heap_allocations; }
+
+    /**
+     * @brief Number of buffers served by this arena since its creation.
+     */
+    inline size_t allocations() const { return _allocations; }
+
+    /**
+     * @brief Number of bytes currently allocated, overflows are counted with their worst alignment padding.
+     */
+    inline size_t used() const { return _offset + _overflow_size; }
+
+    /**
+     * @brief Greatest number of bytes allocated at once since the creation of this arena or its last trim.
+     */
+    inline size_t peak() const { return _peak; }
+
+    /**
+     * @brief Size in bytes of the block of this arena.
+     */
+    inline size_t capacity() const { return _capacity; }
+
+    /**
+     * @brief Number of scopes of this arena currently alive.
+     */
+    inline size_t depth() const { return _depth; }
+
+protected:
+
+    NArena();
+
+    void *heapAllocate(size_t size);
+
+    void reserve(size_t capacity);
+
+    char *_block{};
+
+    size_t _capacity{};
+
+    size_t _offset{};
+
+    size_t _depth{};
+
+    std::vector<std::pair<void *, size_t>> _overflows{};
+
+    size_t _overflow_size{};
+
+    size_t _peak{};
+
+    size_t _heap_allocations{};
+
+    size_t _allocations{};
+};
+
+/**
+ * @class   NArenaScope
+ * @brief   Lifetime of the scratch buffers allocated in the arena of the calling thread.
+ *
+ * @details The scope marks the arena of the calling thread at its construction and rewinds it at its destruction.
+ *          Containers using `NArenaAllocator` must be declared after the scope in which they are allocated.
+ */
+
+class NArenaScope {
+
+public:
+
+    NArenaScope() : _arena(NArena::local()), _mark(_arena.mark()) {}
+
+    ~NArenaScope() { _arena.rewind(_mark); }
+
+    NArenaScope(const NArenaScope &) = delete;
+
+    NArenaScope &operator=(const NArenaScope &) = delete;
+
+protected:
+
+    NArena &_arena;
+
+    NArena::Mark _mark;
+};
+
+/**
+ * @class   NArenaAllocator
+ * @brief   Standard allocator serving memory from the arena of the calling thread.
+ *
+ * @details Deallocation does nothing, the memory is given back when the enclosing `NArenaScope` ends. A container
+ *          using this allocator must therefore be destroyed before the end of the scope and must not grow on another
+ *          thread than the one which created it.
+ *
+ *          It must not grow either while a scope nested in its own is alive, since the memory would be given back
+ *          when the nested scope ends. The allocator records the arena and the depth at which it was created and
+ *          asserts both when allocating.
+ *
+ *          @section Definitions
+ *             - `Alignment` : Power of two lower or equal to `NALIGNED_ALLOCATOR_ALIGNMENT`.
+ */
+
+template<typename T, size_t Alignment = NALIGNED_ALLOCATOR_ALIGNMENT>
+class NArenaAllocator {
+
+public:
+
+    static_assert((Alignment & (Alignment - 1)) == 0 && Alignment <= NALIGNED_ALLOCATOR_ALIGNMENT,
+                  "Alignment must be a power of two lower or equal to NALIGNED_ALLOCATOR_ALIGNMENT");
+
+    typedef T value_type;
+
+    template<typename U>
+    struct rebind {
+        typedef NArenaAllocator<U, Alignment> other;
+    };
+
+    template<typename, size_t> friend class NArenaAllocator;
+
+    NArenaAllocator() : _arena(&NArena::local()), _depth(_arena->depth()) {}
+
+    template<typename U>
+    NArenaAllocator(const NArenaAllocator<U, Alignment> &a) : _arena(a._arena), _depth(a._depth) {}
+
+    T *allocate(size_t n) {
+        assert(&NArena::local() == _arena && _arena->depth() == _depth);
+
+        if (n > std::numeric_limits<size_t>::max() / sizeof(T)) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T *>(_arena->allocate(n * sizeof(T), Alignment));
+    }
+
+    void deallocate(T *, size_t) {}
+
+    template<typename U>
+    inline friend bool operator==(const NArenaAllocator<T, Alignment> &, const NArenaAllocator<U, Alignment> &) {
+        return true;
+    }
+
+    template<typename U>
+    inline friend bool operator!=(const NArenaAllocator<T, Alignment> &, const NArenaAllocator<U, Alignment> &) {
+        return false;
+    }
+
+protected:
+
+    NArena *_arena;
+
+    size_t _depth;
+};
+
+/** @} */
+
+#endif //MATHTOOLKIT_NARENA_H
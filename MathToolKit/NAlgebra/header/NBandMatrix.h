@@ -0,0 +1,177 @@
+//
+// Created on 17/10/2026.
+//
+
+#ifndef MATHTOOLKIT_NBANDMATRIX_H
+#define MATHTOOLKIT_NBANDMATRIX_H
+
+#include "thirdparty.h"
+#include <NPMatrix.h>
+
+/**
+ * @ingroup NAlgebra
+ * @{
+ * @class   NBandMatrix
+ * @date    17/10/2026
+ * @brief   Square matrix whose non-zero coefficients lie on \f$ kl \f$ sub-diagonals, the diagonal and \f$ ku \f$
+ *          super-diagonals.
+ *
+ * @details Only the band is stored, using \f$ n (kl + ku + 1) \f$ coefficients instead of \f$ n^2 \f$ for a
+ *          `NPMatrix`. The storage is the one of `NBlas` banded kernels, see @ref BandKernel. The band of a
+ *          tridiagonal matrix of order \f$ 10^6 \f$ takes 24 MB and is solved in \f$ O(n) \f$.
+ *
+ *          The generators `ndiag()` and `nscalar()` take the same arguments as their `NPMatrix` counterparts and
+ *          `NPMatrix` converts to and from `NBandMatrix`, see `NBandMatrix(const NPMatrix &)` and `dense()`.
+ *
+ *          `solve()` uses Thomas algorithm for diagonally dominant tridiagonal matrices and banded \f$ LU \f$ with
+ *          partial pivoting otherwise, or if Thomas algorithm meets a small pivot. The factorization is computed in
+ *          the `NArena` of the calling thread and is not kept, since for narrow bands it costs as much as the solve
+ *          itself.
+ *
+ *          @section Definitions
+ *             - `n`  : Order of the matrix.
+ *             - `kl` : Number of sub-diagonals.
+ *             - `ku` : Number of super-diagonals.
+ */
+
+template<typename T, typename A = NAlignedAllocator<T>>
+class NBandMatrix {
+
+    static_assert(std::is_floating_point<T>::value, "NBandMatrix requires a floating point type");
+
+public:
+
+    // CONSTRUCTION
+
+    /**
+     * @brief Construct a \f$ n \times n \f$ zero matrix with \f$ kl \f$ sub-diagonals and \f$ ku \f$ super-diagonals.
+     */
+    explicit NBandMatrix(size_t n = 0, size_t kl = 0, size_t ku = 0);
+
+    /**
+     * @brief Construct the band of `m` with \f$ kl \f$ sub-diagonals and \f$ ku \f$ super-diagonals, coefficients of
+     * `m` outside of the band are ignored.
+     */
+    NBandMatrix(const NPMatrix<T, A> &m, size_t kl, size_t ku);
+
+    /**
+     * @brief Construct a band matrix from `m` using the smallest band containing all the non-zero coefficients.
+     */
+    explicit NBandMatrix(const NPMatrix<T, A> &m);
+
+    // GETTERS
+
+    inline size_t n() const { return _n; }
+
+    inline size_t kl() const { return _kl; }
+
+    inline size_t ku() const { return _ku; }
+
+    /**
+     * @brief Number of coefficients stored for each row, \f$ kl + ku + 1 \f$.
+     */
+    inline size_t ld() const { return _kl + _ku + 1; }
+
+    inline const T *data() const { return _data.data(); }
+
+    inline T *data() { return _data.data(); }
+
+    inline bool isInBand(size_t i, size_t j) const { return i < _n && j < _n && j + _kl >= i && j <= i + _ku; }
+
+    // CONVERSION
+
+    /**
+     * @brief Dense `NPMatrix` representation of this matrix.
+     */
+    NPMatrix<T, A> dense() const;
+
+    string str() const;
+
+    // ALGEBRA
+
+    /**
+     * @param x vector of dimension \f$ n \f$.
+     * @param y receives \f$ A x \f$, resized if it has a different dimension.
+     * @brief Banded matrix vector product in \f$ O(n (kl + ku)) \f$.
+     * @return Reference to `y`.
+     */
+    NVector<T, A> &product(const NVector<T, A> &x, NVector<T, A> &y) const;
+
+    /**
+     * @param u right-hand side of dimension \f$ n \f$, overwritten with the solution.
+     * @brief Solve \f$ Ax = u \f$ in \f$ O(n kl (kl + ku)) \f$.
+     * @details `u` is left unchanged if the matrix is singular.
+     * @return Reference to `u`.
+     */
+    NVector<T, A> &solve(NVector<T, A> &u) const;
+
+    /**
+     * @brief Determinant computed using banded \f$ LU \f$ factorization.
+     */
+    T det() const;
+
+    // OPERATORS
+
+    inline friend NVector<T, A> operator*(const NBandMatrix<T, A> &a, const NVector<T, A> &x) {
+        NVector<T, A> y(a.n());
+        return a.product(x, y);
+    }
+
+    inline friend NVector<T, A> operator%(const NBandMatrix<T, A> &a, NVector<T, A> u) { return a.solve(u); }
+
+    friend bool operator==(const NBandMatrix<T, A> &a, const NBandMatrix<T, A> &b) {
+        return a.dense() == b.dense();
+    }
+
+    friend bool operator!=(const NBandMatrix<T, A> &a, const NBandMatrix<T, A> &b) { return !(a == b); }
+
+    friend ostream &operator<<(ostream &os, const NBandMatrix<T, A> &a) { return os << a.str(); }
+
+    // BI-DIMENSIONAL ACCESSORS
+
+    inline T &operator()(size_t i, size_t j) {
+        assert(isInBand(i, j));
+        return _data[i * ld() + j + _kl - i];
+    }
+
+    inline T operator()(size_t i, size_t j) const {
+        assert(i < _n && j < _n);
+        return isInBand(i, j) ? _data[i * ld() + j + _kl - i] : T(0);
+    }
+
+    // STATIC GENERATORS
+
+    /**
+     * @brief Band matrix built from its diagonals, see `NPMatrix::ndiag()`.
+     */
+    static NBandMatrix<T, A> ndiag(const vector<NVector<T, A>> &data);
+
+    /**
+     * @brief Band matrix with constant diagonals, see `NPMatrix::nscalar()`.
+     */
+    static NBandMatrix<T, A> nscalar(const vector<T> &scalars, size_t n);
+
+protected:
+
+    /**
+     * @brief `true` if \f$ |A_{ii}| \geq |A_{i(i-1)}| + |A_{i(i+1)}| \f$ for all rows of a tridiagonal matrix.
+     */
+    bool isDiagonallyDominant() const;
+
+    size_t _n;
+
+    size_t _kl;
+
+    size_t _ku;
+
+    vector<T, A> _data;
+};
+
+/**
+ * Real band matrix
+ */
+typedef NBandMatrix<double_t> band_t;
+
+/** @} */
+
+#endif //MATHTOOLKIT_NBANDMATRIX_H
@@ -0,0 +1,190 @@
+//
+// Created on 17/10/2026.
+//
+
+#ifndef MATHTOOLKIT_NBATCHMATRIX_H
+#define MATHTOOLKIT_NBATCHMATRIX_H
+
+#include "thirdparty.h"
+#include <NPMatrix.h>
+
+/**
+ * Number of matrices interleaved in a group of `NBatchMatrix`, processed together by the batched operations.
+ */
+#define NBATCHMATRIX_LANES 8
+
+/**
+ * @ingroup NAlgebra
+ * @{
+ * @class   NBatchMatrix
+ * @date    17/10/2026
+ * @brief   Batch of independent small matrices of the same dimension stored in an interleaved layout.
+ *
+ * @details The matrices are gathered by groups of `NBATCHMATRIX_LANES`. Inside a group, the coefficients
+ *          \f$ a_{ij} \f$ of all the matrices are consecutive, so that coefficient \f$ (i, j) \f$ of matrix `k` is
+ *          stored at index \f$ ((k / L) np + ip + j) L + k \bmod L \f$ where \f$ L \f$ is the number of lanes.
+ *
+ *          The batched operations process the matrices of a group in lockstep : each arithmetic operation of the
+ *          algorithm is applied to the \f$ L \f$ matrices at once by a loop over contiguous lanes that the compiler
+ *          turns into SIMD instructions. Pivoting is done independently in each lane. The groups are distributed
+ *          between the workers of `NThreadPool` when the batch is large enough, and the scratch memory is taken
+ *          from `NArena`, so that a batched operation performs no heap allocation.
+ *
+ *          This is intended for tens of thousands of matrices of order 3 to 16, for which a `NPMatrix` per system
+ *          spends most of its time in allocations and loop overheads.
+ *
+ *          The last group is padded with identity matrices, or zero matrices if they are not square, whose results
+ *          are discarded.
+ *
+ *          As for `NLU`, a matrix is considered singular if a pivot lower than `EPSILON` is encountered. Only
+ *          instantiated for real types.
+ *
+ *          @section Definitions
+ *             - `count` : Number of matrices of the batch.
+ *             - `n`     : Number of rows of each matrix.
+ *             - `p`     : Number of columns of each matrix.
+ */
+
+template<typename T, typename A = NAlignedAllocator<T>>
+class NBatchMatrix {
+
+public:
+
+    // CONSTRUCTION
+
+    /**
+     * @brief Construct a batch of `count` zero matrices of size \f$ n \times p \f$.
+     */
+    NBatchMatrix(size_t count = 0, size_t n = 0, size_t p = 0);
+
+    /**
+     * @param matrices matrices of the same dimension, at least one.
+     */
+    explicit NBatchMatrix(const vector<NPMatrix<T, A>> &matrices);
+
+    // GETTERS
+
+    inline size_t count() const { return _count; }
+
+    inline size_t n() const { return _n; }
+
+    inline size_t p() const { return _p; }
+
+    /**
+     * @brief Number of groups of `NBATCHMATRIX_LANES` matrices.
+     */
+    inline size_t groups() const { return (_count + NBATCHMATRIX_LANES - 1) / NBATCHMATRIX_LANES; }
+
+    inline const T *data() const { return _data.data(); }
+
+    inline T *data() { return _data.data(); }
+
+    /**
+     * @brief Copy of the matrix `k` of the batch.
+     */
+    NPMatrix<T, A> matrix(size_t k) const;
+
+    // SETTERS
+
+    /**
+     * @param m matrix of size \f$ n \times p \f$.
+     * @brief Copy `m` into the matrix `k` of the batch.
+     */
+    void setMatrix(size_t k, const NPMatrix<T, A> &m);
+
+    // CONVERSION
+
+    std::string str() const;
+
+    // ALGEBRA
+
+    /**
+     * @param b batch of `count()` right-hand sides with \f$ n \f$ rows, overwritten with the solutions.
+     * @brief Solve \f$ A_k X_k = B_k \f$ for all the matrices of the batch using Gaussian elimination with partial
+     * pivoting.
+     * @details The right-hand sides of the singular matrices are left unchanged.
+     * @return `false` if at least one of the matrices is singular.
+     */
+    bool solveBatched(NBatchMatrix<T, A> &b) const;
+
+    /**
+     * @param dets receives the determinants of the matrices, resized if it has a different dimension.
+     * @brief Compute the determinants in \f$ O(n^3) \f$ per matrix, `0` for singular matrices.
+     * @return Reference to `dets`.
+     */
+    NVector<T, A> &detBatched(NVector<T, A> &dets) const;
+
+    /**
+     * @param inv receives the inverses \f$ A_k^{-1} \f$, reshaped if it has a different dimension.
+     * @brief Invert all the matrices of the batch, the inverses of the singular matrices are left unchanged.
+     * @return `false` if at least one of the matrices is singular.
+     */
+    bool invBatched(NBatchMatrix<T, A> &inv) const;
+
+    /**
+     * @param b batch of `count()` matrices with \f$ p \f$ rows.
+     * @param c receives the products \f$ A_k B_k \f$, reshaped if it has a different dimension, distinct from
+     * `this` and `b`.
+     * @return Reference to `c`.
+     */
+    NBatchMatrix<T, A> &gemmBatched(const NBatchMatrix<T, A> &b, NBatchMatrix<T, A> &c) const;
+
+    // OPERATORS
+
+    inline friend NBatchMatrix<T, A> operator*(const NBatchMatrix<T, A> &a, const NBatchMatrix<T, A> &b) {
+        NBatchMatrix<T, A> c(a.count(), a.n(), b.p());
+        return a.gemmBatched(b, c);
+    }
+
+    friend std::ostream &operator<<(std::ostream &os, const NBatchMatrix<T, A> &m) { return os << m.str(); }
+
+    /**
+     * @brief Coefficient \f$ (i, j) \f$ of the matrix `k`.
+     */
+    inline T &operator()(size_t k, size_t i, size_t j) {
+        assert(k < _count && i < _n && j < _p);
+        return _data[index(k, i, j)];
+    }
+
+    inline T operator()(size_t k, size_t i, size_t j) const {
+        assert(k < _count && i < _n && j < _p);
+        return _data[index(k, i, j)];
+    }
+
+protected:
+
+    inline size_t index(size_t k, size_t i, size_t j) const {
+        return ((k / NBATCHMATRIX_LANES) * _n * _p + i * _p + j) * NBATCHMATRIX_LANES + k % NBATCHMATRIX_LANES;
+    }
+
+    /**
+     * @brief Give the dimensions of `this` batch to `m` if it has different ones.
+     */
+    void fit(NBatchMatrix<T, A> &m, size_t p) const;
+
+    /**
+     * @param q number of columns of the right-hand sides.
+     * @brief Solve \f$ A_k X_k = B_k \f$ for the matrices of the group `g`, writing back only the non-singular ones.
+     * @details `b` is `nullptr` if only the determinants are required. If `identity` is `true` the right-hand
+     * sides are initialized to the identity instead of being read from `b`.
+     * @return `false` if at least one of the matrices of the group is singular.
+     */
+    bool eliminate(size_t g, size_t q, T *b, bool identity, T *dets) const;
+
+    size_t _count;
+
+    size_t _n;
+
+    size_t _p;
+
+    vector<T, A> _data;
+};
+
+/**
+ * Real batch of matrices
+ */
+typedef NBatchMatrix<double_t> batch_t;
+
+/** @} */
+
+#endif //MATHTOOLKIT_NBATCHMATRIX_H
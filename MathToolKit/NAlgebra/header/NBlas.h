@@ -0,0 +1,553 @@
+#ifndef MATHTOOLKIT_NBLAS_H
+#define MATHTOOLKIT_NBLAS_H
+
+#include "thirdparty.h"
+#include <NThreadPool.h>
+
+/**
+ * Height of the register block computed by the micro-kernel.
+ */
+#define NBLAS_MR 4
+
+/**
+ * Width of the register block computed by the micro-kernel.
+ */
+#define NBLAS_NR 8
+
+/**
+ * Number of rows of the left operand packed at once, the packed panel is designed to stay in L2 cache.
+ */
+#define NBLAS_MC 128
+
+/**
+ * Depth of the packed panels, a `NBLAS_KC x NBLAS_NR` micro-panel is designed to stay in L1 cache.
+ */
+#define NBLAS_KC 256
+
+/**
+ * Number of columns of the right operand packed at once.
+ */
+#define NBLAS_NC 2048
+
+/**
+ * Number of columns of the panels factorized at once in blocked factorizations.
+ */
+#define NBLAS_NB 64
+
+/**
+ * Number of columns below which the panels of the QR factorization are factorized without recursion.
+ */
+#define NBLAS_QR_LEAF 4
+
+/**
+ * Number of rows and columns below which blocks are transposed without recursion, see `NCpuKernels::transpose`.
+ */
+#define NBLAS_TRANSPOSE_LEAF 32
+
+/**
+ * Minimum number of multiply-add operations from which products are computed using `NThreadPool`.
+ */
+#define NBLAS_PARALLEL_MIN_OPS 262144
+
+/**
+ * @ingroup NAlgebra
+ * @{
+ * @class   NBlas
+ * @date    17/10/2026
+ * @brief   Dense linear algebra kernels working directly on row-major storage.
+ *
+ * @details Kernels operate on raw pointers. A block is described by a pointer to its first element \f$ A_{00} \f$
+ *          and a leading dimension `ld` which is the distance between two consecutive rows in the underlying array.
+ *          This allows `NPMatrix` to run kernels on sub-matrices selected with browse indices without copying them.
+ *
+ *          @section GEMMKernel Matrix product
+ *
+ *          The matrix product is computed using the classic packed panels algorithm :
+ *              - The right operand is split into `NBLAS_KC x NBLAS_NC` panels, copied in a contiguous buffer
+ *              ordered by micro-panels of `NBLAS_NR` columns.
+ *              - The left operand is split into `NBLAS_MC x NBLAS_KC` panels, copied in a contiguous buffer
+ *              ordered by micro-panels of `NBLAS_MR` rows.
+ *              - A micro-kernel computes a `NBLAS_MR x NBLAS_NR` block of the result keeping it in registers while
+ *              streaming through the two packed micro-panels.
+ *
+ *          Packing also pads incomplete micro-panels with `0` so that the micro-kernel never checks bounds.
+ *          The packed panels are allocated in the `NArena` of the thread which packs them.
+ *
+ *          @section Parallelism
+ *
+ *          When the number of multiply-add operations exceeds `NBLAS_PARALLEL_MIN_OPS`, the rows of the result are
+ *          split in blocks distributed over the workers of `NThreadPool`. Each worker packs its own panels of the left
+ *          operand while the packed panel of the right operand is shared.
+ *
+ *          The strided variant of `gemm()` reads the operands with arbitrary row and column strides, so that a
+ *          transposed operand \f$ A^T \f$ is read in place by swapping the strides of \f$ A \f$ : packing copies
+ *          it anyway, the transposition costs nothing more than the packing.
+ *
+ *          @section TransposeKernel Transposition
+ *
+ *          Out of place transpositions split recursively the larger dimension of the block in two halves, until it
+ *          fits in `NBLAS_TRANSPOSE_LEAF` rows and columns. The recursion is cache-oblivious : whatever the size of
+ *          the caches, at some depth both the read and the written block fit in it. The leaves are transposed by
+ *          a SIMD kernel of `NCpu` for `double_t`, which exchanges \f$ 8 \times 8 \f$ blocks in AVX-512 registers
+ *          (\f$ 4 \times 4 \f$ with AVX2), so that every load and store is a full vector. Halves are cut on
+ *          multiples of `NBLAS_NR` to keep whole SIMD blocks in the leaves.
+ *
+ *          Square blocks are transposed in place by the same recursion, each off-diagonal pair of blocks being
+ *          exchanged through a leaf buffer on the stack. A contiguous rectangular \f$ n \times p \f$ matrix is
+ *          transposed in place by following the cycles of the permutation \f$ k \mapsto k n \bmod (np - 1) \f$
+ *          which sends the coefficient of index \f$ k = i p + j \f$ to \f$ j n + i \f$. The coefficients already
+ *          moved are marked in a bit set, which takes \f$ np / 8 \f$ bytes of the `NArena` instead of a second
+ *          copy of the matrix.
+ *
+ *          @section GEMVKernel Matrix vector product
+ *
+ *          The products \f$ A x \f$ and \f$ A^T x \f$ stream the rows of \f$ A \f$ in place, without copy. For
+ *          `double_t`, the SIMD kernels of `NCpu` process four rows at once so that each load of \f$ x \f$, or of
+ *          \f$ y \f$ for the transposed product, is shared by four rows. Large products are split over the workers of
+ *          `NThreadPool` by blocks of rows for `gemv()` and by blocks of columns for `gemvT()`, so that no reduction of
+ *          partial results is needed. The transposed product also walks the columns by blocks of `NBLAS_NC` so that
+ *          the block of \f$ y \f$ being updated stays in cache.
+ *
+ *          @section Reductions
+ *
+ *          For `double_t` the dot product, squared norm and squared distance are computed by explicit SIMD kernels
+ *          using four independent accumulators. Large vectors are split in blocks of `NTHREADPOOL_MIN_SIZE`
+ *          coordinates reduced by the workers of `NThreadPool`, one partial sum per block, and the partial sums are
+ *          added in block order. The result therefore does not depend on the number of workers. Other scalar types
+ *          use a sequential loop.
+ *
+ *          @section Dispatch
+ *
+ *          For `double_t` the micro-kernel, `dot()`, `dist2()` and `axpy()` are bound at runtime by `NCpu` to the best
+ *          implementation supported by the processor. For `AESByte`, `axpy()` uses the \f$ GF(2^8) \f$ kernel of
+ *          `NCpu` and `gemm()` is computed as a sequence of `axpy()` on the rows of the result, which does not require
+ *          packing. Other scalar types use portable loops.
+ *
+ *          @section LUKernel LU factorization
+ *
+ *          The \f$ LU \f$ factorization with partial pivoting uses a right-looking blocked algorithm. At each step
+ *          a panel of `NBLAS_NB` columns is factorized using unblocked elimination, the corresponding block row of
+ *          \f$ U \f$ is obtained by a triangular solve and the trailing sub-matrix is updated using `gemm()`.
+ *          Thus most of the operations are performed by the matrix product kernel.
+ *
+ *          @section TRSMKernel Triangular solves
+ *
+ *          Triangular systems with several right-hand sides \f$ B \f$ of size \f$ n \times m \f$ are solved by blocks
+ *          of `NBLAS_NB` rows. The diagonal block is solved by substitution where each step is an `axpy()` on a whole
+ *          row of \f$ B \f$, then the remaining rows are updated at once using `gemm()`. `getrs()` splits the
+ *          columns of \f$ B \f$ over the workers of `NThreadPool` when the system is large enough, the columns being
+ *          independent.
+ *
+ *          @section CholeskyKernel Cholesky factorization
+ *
+ *          The factorization \f$ A = LL^T \f$ of symmetric positive definite matrices follows the same right-looking
+ *          blocked scheme as \f$ LU \f$ without pivoting. The panel below the diagonal block is transposed in the
+ *          `NArena` so that it is obtained by `trsmLower()` on long rows, then only the lower part of the trailing
+ *          sub-matrix is updated by block rows of `NBLAS_NB` using `gemm()` with the transposed panel. It requires half
+ *          the operations and half the memory traffic of the \f$ LU \f$ factorization.
+ *
+ *          @section QRKernel QR factorization
+ *
+ *          The Householder \f$ QR \f$ factorization proceeds by panels of `NBLAS_NB` columns. The reflectors of a
+ *          panel are accumulated in the compact WY form \f$ H_1 ... H_k = I - V T V^T \f$, so that they are applied to
+ *          the trailing columns at once by two `gemm()` with the tall matrix \f$ V \f$. The panel itself is factorized
+ *          recursively : its left half is factorized, applied to its right half as a block reflector, then the right
+ *          half is factorized and the two factors \f$ T \f$ are merged. Thus the factorization of a tall matrix,
+ *          whose panels hold most of the operations, is also performed by the matrix product kernel. The panel is
+ *          transposed in the `NArena` so that each Householder vector is contiguous, panels narrower than
+ *          `NBLAS_QR_LEAF` being factorized column by column with `dot()` and `axpy()`. The products by \f$ V^T \f$
+ *          read \f$ V \f$ in place using the strides of `gemm()`.
+ *
+ *          @section SYTRDKernel Tridiagonal reduction
+ *
+ *          Symmetric matrices are reduced to tridiagonal form by two-sided Householder reflectors, by panels of
+ *          `NBLAS_NB` columns. The reflectors of a panel are accumulated into \f$ V \f$ and \f$ W \f$ so that the
+ *          trailing sub-matrix is updated at once by the two `gemm()` of \f$ A - V W^T - W V^T \f$. Both halves of the
+ *          matrix are kept up to date, so that the rows used by the panel are contiguous and the remaining product
+ *          by the trailing sub-matrix is a `gemv()`, which limits this part to the memory bandwidth.
+ *
+ *          @section BandKernel Banded matrices
+ *
+ *          A matrix with \f$ kl \f$ sub-diagonals and \f$ ku \f$ super-diagonals is stored by rows of
+ *          \f$ kl + ku + 1 \f$ coefficients : \f$ A_{ij} \f$ is `ab[i * ldab + j - i + kl]`. Thus each row of the band is
+ *          contiguous and the diagonal is the column `kl` of the storage. Coefficients of the storage falling outside
+ *          of the matrix are never read. Products, factorizations and solves run in \f$ O(n (kl + ku)) \f$ operations,
+ *          or \f$ O(n kl (kl + ku)) \f$ for the factorization. Rows of a band being short, these kernels use plain loops
+ *          instead of the kernels of `NCpu`.
+ *
+ *          @section SparseKernel Sparse matrices
+ *
+ *          A sparse \f$ n \times p \f$ matrix is stored in compressed sparse row format : the non-zero coefficients
+ *          of row `i` are `values[k]` for `k` in `[rows[i], rows[i + 1])`, lying in the columns `cols[k]`. `rows` has
+ *          \f$ n + 1 \f$ elements and `rows[n]` is the number of stored coefficients. Products are split by rows
+ *          among the threads, each row being processed by a single thread. The transposed product scatters the rows
+ *          in private buffers summed afterwards, which is done only when these buffers are smaller than the matrix.
+ *
+ *          @section Definitions
+ *             - `n`, `p`, `q` : The left operand \f$ A \f$ is \f$ n \times q \f$, the right operand \f$ B \f$ is
+ *             \f$ q \times p \f$ and the result \f$ C \f$ is \f$ n \times p \f$.
+ *             - `lda`, `ldb`, `ldc` : Leading dimensions of \f$ A \f$, \f$ B \f$ and \f$ C \f$.
+ */
+
+template<typename T>
+class NBlas {
+
+public:
+
+    /**
+     * @brief General matrix product \f$ C \leftarrow C + \alpha A B \f$.
+     * @details \f$ C \f$ must not overlap \f$ A \f$ or \f$ B \f$.
+     */
+    static void gemm(size_t n, size_t p, size_t q, T alpha,
+                     const T *a, size_t lda, const T *b, size_t ldb, T *c, size_t ldc);
+
+    /**
+     * @param rsa, csa row and column strides of \f$ A \f$, \f$ A_{ik} \f$ being `a[i * rsa + k * csa]`.
+     * @param rsb, csb row and column strides of \f$ B \f$.
+     * @brief General matrix product \f$ C \leftarrow C + \alpha A B \f$ with strided operands.
+     * @details Transposed operands are read in place, \f$ A^T \f$ being \f$ A \f$ with swapped strides.
+     */
+    static void gemm(size_t n, size_t p, size_t q, T alpha,
+                     const T *a, size_t rsa, size_t csa, const T *b, size_t rsb, size_t csb, T *c, size_t ldc);
+
+    /**
+     * @brief Matrix vector product \f$ y \leftarrow A x \f$ where \f$ A \f$ is \f$ n \times p \f$.
+     * @details \f$ y \f$ must not overlap \f$ x \f$ or \f$ A \f$.
+     */
+    static void gemv(size_t n, size_t p, const T *a, size_t lda, const T *x, T *y);
+
+    /**
+     * @brief Transposed matrix vector product \f$ y \leftarrow A^T x \f$ where \f$ A \f$ is \f$ n \times p \f$.
+     * @details \f$ x \f$ is of size \f$ n \f$ and \f$ y \f$ of size \f$ p \f$. \f$ y \f$ must not overlap \f$ x \f$ or
+     * \f$ A \f$.
+     */
+    static void gemvT(size_t n, size_t p, const T *a, size_t lda, const T *x, T *y);
+
+    /**
+     * @param a \f$ n \times p \f$ matrix \f$ A \f$.
+     * @param b receives the \f$ p \times n \f$ matrix \f$ A^T \f$.
+     * @brief Cache-oblivious transposition \f$ B \leftarrow A^T \f$, see @ref TransposeKernel.
+     * @details \f$ B \f$ must not overlap \f$ A \f$.
+     */
+    static void transpose(size_t n, size_t p, const T *a, size_t lda, T *b, size_t ldb);
+
+    /**
+     * @param a \f$ n \times n \f$ matrix \f$ A \f$, overwritten with \f$ A^T \f$.
+     * @brief In place transposition of a square block.
+     */
+    static void transpose(size_t n, T *a, size_t lda);
+
+    /**
+     * @param a contiguous \f$ n \times p \f$ matrix \f$ A \f$, overwritten with the contiguous \f$ p \times n \f$
+     * matrix \f$ A^T \f$.
+     * @brief In place transposition of a rectangular matrix by cycle following.
+     */
+    static void transpose(size_t n, size_t p, T *a);
+
+    /**
+     * @param kl number of sub-diagonals of \f$ A \f$.
+     * @param ku number of super-diagonals of \f$ A \f$.
+     * @param ab \f$ A \f$ in band storage, see @ref BandKernel.
+     * @brief Banded matrix vector product \f$ y \leftarrow A x \f$ where \f$ A \f$ is \f$ n \times n \f$.
+     * @details \f$ y \f$ must not overlap \f$ x \f$ or \f$ A \f$.
+     */
+    static void gbmv(size_t n, size_t kl, size_t ku, const T *ab, size_t ldab, const T *x, T *y);
+
+    /**
+     * @param rows, cols, values \f$ n \times p \f$ matrix \f$ A \f$ in compressed sparse row format, see
+     * @ref SparseKernel.
+     * @brief Sparse matrix vector product \f$ y \leftarrow A x \f$.
+     * @details \f$ y \f$ must not overlap \f$ x \f$.
+     */
+    static void csrmv(size_t n, const size_t *rows, const size_t *cols, const T *values, const T *x, T *y);
+
+    /**
+     * @param rows, cols, values \f$ n \times p \f$ matrix \f$ A \f$ in compressed sparse row format.
+     * @brief Transposed sparse matrix vector product \f$ y \leftarrow A^T x \f$ where \f$ y \f$ has \f$ p \f$
+     * elements.
+     * @details \f$ y \f$ must not overlap \f$ x \f$.
+     */
+    static void csrmvT(size_t n, size_t p, const size_t *rows, const size_t *cols, const T *values, const T *x, T *y);
+
+    /**
+     * @param rows, cols, values \f$ n \times q \f$ matrix \f$ A \f$ in compressed sparse row format.
+     * @brief Sparse dense product \f$ C \leftarrow A B \f$ where \f$ B \f$ is \f$ q \times p \f$.
+     * @details \f$ C \f$ must not overlap \f$ B \f$.
+     */
+    static void csrmm(size_t n, size_t p, const size_t *rows, const size_t *cols, const T *values, const T *b,
+                      size_t ldb, T *c, size_t ldc);
+
+    /**
+     * @brief Dot product \f$ x \cdot y = x_0 y_0 + ... + x_{(n-1)} y_{(n-1)} \f$.
+     */
+    static T dot(size_t n, const T *x, const T *y);
+
+    /**
+     * @brief Squared euclidean norm \f$ ||x||^2 \f$.
+     */
+    static T norm2(size_t n, const T *x);
+
+    /**
+     * @brief Squared euclidean distance \f$ ||x - y||^2 \f$ computed without storing \f$ x - y \f$.
+     */
+    static T dist2(size_t n, const T *x, const T *y);
+
+    /**
+     * @brief Scaled addition \f$ y \leftarrow y + \alpha x \f$.
+     * @details \f$ y \f$ must not overlap \f$ x \f$.
+     */
+    static void axpy(size_t n, T alpha, const T *x, T *y);
+
+    /**
+     * @param n order of the matrix \f$ A \f$.
+     * @param a pointer to \f$ A \f$, overwritten with \f$ L \f$ and \f$ U \f$ factors.
+     * @param lda leading dimension of \f$ A \f$.
+     * @param perm array of size \f$ n + 1 \f$ initialized with \f$ (0, 1, ..., n) \f$.
+     * @brief In place \f$ LU \f$ factorization with partial pivoting \f$ PA = LU \f$.
+     * @details The strict lower part of \f$ A \f$ is overwritten with \f$ L \f$, whose unit diagonal is not stored,
+     * and the upper part with \f$ U \f$. `perm[i]` receives the index of the original row stored in row `i`
+     * and each pivoting increments `perm[n]`.
+     * @return `false` if a pivot lower than `EPSILON` is encountered. In this case, `a` and `perm` are left partially
+     * factorized.
+     */
+    static bool getrf(size_t n, T *a, size_t lda, size_t *perm);
+
+    /**
+     * @param n order of the matrix \f$ A \f$.
+     * @param m number of right-hand sides.
+     * @param a factors \f$ L \f$ and \f$ U \f$ as computed by `getrf()`.
+     * @param perm permutation computed by `getrf()`.
+     * @param b \f$ n \times m \f$ right-hand sides, overwritten with the solutions.
+     * @brief Solve \f$ AX = B \f$ using the factorization \f$ PA = LU \f$ computed by `getrf()`.
+     */
+    static void getrs(size_t n, size_t m, const T *a, size_t lda, const size_t *perm, T *b, size_t ldb);
+
+    /**
+     * @brief Solve \f$ A^T X = B \f$ using the factorization \f$ A^T = U^T L^T P \f$, see `getrs()`.
+     */
+    static void getrsT(size_t n, size_t m, const T *a, size_t lda, const size_t *perm, T *b, size_t ldb);
+
+    /**
+     * @param n order of the matrix \f$ A \f$.
+     * @param a pointer to \f$ A \f$, its lower part is overwritten with \f$ L \f$.
+     * @param lda leading dimension of \f$ A \f$.
+     * @brief In place Cholesky factorization \f$ A = LL^T \f$ of a symmetric positive definite matrix.
+     * @details Only the lower part of \f$ A \f$ is read and written, \f$ A \f$ is assumed symmetric.
+     * @return `false` if a pivot lower than `EPSILON` is encountered, \f$ A \f$ is then not positive definite and is
+     * left partially factorized.
+     */
+    static bool potrf(size_t n, T *a, size_t lda);
+
+    /**
+     * @param n order of the matrix \f$ A \f$.
+     * @param m number of right-hand sides.
+     * @param a factor \f$ L \f$ as computed by `potrf()`.
+     * @param b \f$ n \times m \f$ right-hand sides, overwritten with the solutions.
+     * @brief Solve \f$ AX = B \f$ using the factorization \f$ A = LL^T \f$ computed by `potrf()`.
+     */
+    static void potrs(size_t n, size_t m, const T *a, size_t lda, T *b, size_t ldb);
+
+    /**
+     * @param n number of rows of \f$ A \f$.
+     * @param p number of columns of \f$ A \f$, \f$ p \leq n \f$.
+     * @param a pointer to \f$ A \f$, overwritten with the reflectors and \f$ R \f$.
+     * @param t receives the triangular factors of the block reflectors, \f$ min(NBLAS\_NB, p) \times p \f$.
+     * @param ldt leading dimension of `t`, at least \f$ p \f$.
+     * @brief In place Householder \f$ QR \f$ factorization \f$ A = QR \f$.
+     * @details The upper part of \f$ A \f$ is overwritten with \f$ R \f$ and its strict lower part with the
+     * Householder vectors, whose unit diagonal is not stored. The factor of the block reflector
+     * \f$ H = I - V T V^T \f$ of the columns `[j, j + NBLAS_NB)` is stored in the columns `[j, j + NBLAS_NB)` of `t`.
+     */
+    static void geqrt(size_t n, size_t p, T *a, size_t lda, T *t, size_t ldt);
+
+    /**
+     * @param n number of rows of \f$ A \f$ and \f$ C \f$.
+     * @param p number of columns of \f$ A \f$.
+     * @param m number of columns of \f$ C \f$.
+     * @param a reflectors as computed by `geqrt()`.
+     * @param t factors of the block reflectors as computed by `geqrt()`.
+     * @param c \f$ n \times m \f$ matrix, overwritten with \f$ Q^T C \f$ if `trans` is `true`, else \f$ QC \f$.
+     * @brief Apply the orthogonal factor \f$ Q \f$ computed by `geqrt()` without forming it.
+     */
+    static void gemqrt(size_t n, size_t p, size_t m, const T *a, size_t lda, const T *t, size_t ldt,
+                       T *c, size_t ldc, bool trans);
+
+    /**
+     * @param n order of the symmetric matrix \f$ A \f$.
+     * @param a pointer to \f$ A \f$, overwritten with the reflectors in its strict lower part below the
+     * sub-diagonal.
+     * @param d receives the \f$ n \f$ diagonal coefficients of \f$ T \f$.
+     * @param e receives the \f$ n - 1 \f$ off-diagonal coefficients of \f$ T \f$.
+     * @param t receives the triangular factors of the block reflectors, \f$ min(NBLAS\_NB, n - 1) \times (n - 1) \f$.
+     * @param ldt leading dimension of `t`, at least \f$ n - 1 \f$.
+     * @brief Householder reduction \f$ A = Q T Q^T \f$ of a symmetric matrix to tridiagonal form.
+     * @details Both parts of \f$ A \f$ are read. The reflectors and `t` are stored as by `geqrt()` for the
+     * \f$ (n - 1) \times (n - 1) \f$ block starting at the second row of \f$ A \f$, so that
+     * `gemqrt(n - 1, n - 1, m, a + lda, lda, t, ldt, c + ldc, ldc, false)` computes \f$ QC \f$, the first row of
+     * \f$ C \f$ being left unchanged.
+     */
+    static void sytrd(size_t n, T *a, size_t lda, T *d, T *e, T *t, size_t ldt);
+
+    /**
+     * @param n order of the matrix \f$ A \f$.
+     * @param kl number of sub-diagonals of \f$ A \f$.
+     * @param ku number of super-diagonals of \f$ A \f$.
+     * @param ab \f$ A \f$ in band storage with \f$ ldab \geq 2 kl + ku + 1 \f$, overwritten with the factors.
+     * @param ipiv array of size \f$ n \f$ receiving the row interchanges, row `k` was swapped with row `ipiv[k]`.
+     * @brief In place banded \f$ LU \f$ factorization with partial pivoting.
+     * @details The \f$ kl \f$ last columns of each row of `ab` receive the fill-in of \f$ U \f$, whose band has
+     * \f$ kl + ku \f$ super-diagonals, they do not need to be initialized.
+     * @return `false` if a pivot lower than `EPSILON` is encountered.
+     */
+    static bool gbtrf(size_t n, size_t kl, size_t ku, T *ab, size_t ldab, size_t *ipiv);
+
+    /**
+     * @param b right-hand side of size \f$ n \f$, overwritten with the solution.
+     * @brief Solve \f$ Ax = b \f$ using the factorization computed by `gbtrf()`.
+     */
+    static void gbtrs(size_t n, size_t kl, size_t ku, const T *ab, size_t ldab, const size_t *ipiv, T *b);
+
+    /**
+     * @param ab tridiagonal matrix \f$ A \f$ in band storage with \f$ kl = ku = 1 \f$.
+     * @param b right-hand side of size \f$ n \f$, overwritten with the solution.
+     * @brief Solve \f$ Ax = b \f$ using Thomas algorithm, Gaussian elimination without pivoting in \f$ O(n) \f$.
+     * @details Stable if \f$ A \f$ is diagonally dominant or symmetric positive definite.
+     * @return `false` if a pivot lower than `EPSILON` is encountered. In this case `b` is not modified.
+     */
+    static bool gtsv(size_t n, const T *ab, size_t ldab, T *b);
+
+    /**
+     * @brief Solve \f$ LX = B \f$ in place where \f$ L \f$ is the lower part of the \f$ n \times n \f$ matrix
+     * \f$ A \f$ and \f$ B \f$ is \f$ n \times m \f$.
+     * @details If `unit` is `true`, the diagonal of \f$ L \f$ is assumed to be `1` and is not read. The upper part of
+     * \f$ A \f$ is not read.
+     */
+    static void trsmLower(size_t n, size_t m, const T *a, size_t lda, T *b, size_t ldb, bool unit = true);
+
+    /**
+     * @brief Solve \f$ L^T X = B \f$ in place where \f$ L \f$ is the lower part of the \f$ n \times n \f$ matrix
+     * \f$ A \f$ and \f$ B \f$ is \f$ n \times m \f$.
+     * @details If `unit` is `true`, the diagonal of \f$ L \f$ is assumed to be `1` and is not read. The strict upper
+     * part of \f$ A \f$ is not read.
+     */
+    static void trsmLowerT(size_t n, size_t m, const T *a, size_t lda, T *b, size_t ldb, bool unit = false);
+
+    /**
+     * @brief Solve \f$ UX = B \f$ in place where \f$ U \f$ is the upper part of the \f$ n \times n \f$ matrix
+     * \f$ A \f$ and \f$ B \f$ is \f$ n \times m \f$.
+     * @details The strict lower part of \f$ A \f$ is not read.
+     */
+    static void trsmUpper(size_t n, size_t m, const T *a, size_t lda, T *b, size_t ldb);
+
+    /**
+     * @brief Solve \f$ U^T X = B \f$ in place where \f$ U \f$ is the upper part of the \f$ n \times n \f$ matrix
+     * \f$ A \f$ and \f$ B \f$ is \f$ n \times m \f$.
+     * @details The strict lower part of \f$ A \f$ is not read.
+     */
+    static void trsmUpperT(size_t n, size_t m, const T *a, size_t lda, T *b, size_t ldb);
+
+protected:
+
+    static void packA(size_t mc, size_t kc, T alpha, const T *a, size_t rsa, size_t csa, T *packed);
+
+    static void packB(size_t kc, size_t nc, const T *b, size_t rsb, size_t csb, T *packed);
+
+    static void macroKernel(size_t mc, size_t nc, size_t kc, const T *packed_a, const T *packed_b, T *c, size_t ldc);
+
+    static void microKernel(size_t kc, const T *packed_a, const T *packed_b, T *c, size_t ldc, size_t mr, size_t nr);
+
+    static void gemvBlock(size_t n, size_t p, const T *a, size_t lda, const T *x, T *y);
+
+    static void gemvTBlock(size_t n, size_t p, const T *a, size_t lda, const T *x, T *y);
+
+    static bool getf2(size_t n, size_t jb, size_t j, T *a, size_t lda, size_t *perm);
+
+    /**
+     * @brief Recursive step of `transpose()`.
+     */
+    static void transposeBlock(size_t n, size_t p, const T *a, size_t lda, T *b, size_t ldb);
+
+    /**
+     * @brief Transposition of a leaf of at most `NBLAS_TRANSPOSE_LEAF` rows and columns.
+     */
+    static void transposeLeaf(size_t n, size_t p, const T *a, size_t lda, T *b, size_t ldb);
+
+    /**
+     * @param x \f$ n \times p \f$ block \f$ X \f$.
+     * @param y \f$ p \times n \f$ block \f$ Y \f$ not overlapping \f$ X \f$.
+     * @brief Exchange \f$ X \leftarrow Y^T \f$ and \f$ Y \leftarrow X^T \f$ recursively.
+     */
+    static void transposeSwap(size_t n, size_t p, T *x, size_t ldx, T *y, size_t ldy);
+
+    static bool potf2(size_t n, T *a, size_t lda);
+
+    /**
+     * @brief Recursive \f$ QR \f$ factorization of a panel, the factor of its block reflector is stored in `t`.
+     * @details The panel is stored by columns, the element \f$ A_{rc} \f$ being `a[c * lda + r]`.
+     */
+    static void geqrt3(size_t n, size_t p, T *a, size_t lda, T *t, size_t ldt);
+
+    /**
+     * @brief Unblocked \f$ QR \f$ factorization of a panel stored by columns as in `geqrt3()`.
+     */
+    static void geqr2(size_t n, size_t p, T *a, size_t lda, T *t, size_t ldt);
+
+    /**
+     * @param x vector of size \f$ n \f$, overwritten with \f$ \beta \f$ followed by the Householder vector
+     * whose first coefficient `1` is not stored.
+     * @brief Generate the Householder reflector \f$ H = I - \tau v v^T \f$ such that \f$ H x = \beta e_1 \f$.
+     * @return \f$ \tau \f$, `0` if \f$ x \f$ is already proportional to \f$ e_1 \f$.
+     */
+    static T larfg(size_t n, T *x);
+
+    /**
+     * @brief Reduce the `nb` first rows and columns of the \f$ m \times m \f$ symmetric matrix \f$ A \f$.
+     * @details The reflectors and the matrix \f$ W \f$ such that the trailing sub-matrix must be updated with
+     * \f$ A - V W^T - W V^T \f$ are stored transposed in `vt` and `wt`, of size \f$ nb \times m \f$.
+     */
+    static void latrd(size_t m, size_t nb, T *a, size_t lda, T *d, T *e, T *t, size_t ldt, T *vt, T *wt);
+
+    /**
+     * @brief Apply the block reflector \f$ H = I - V T V^T \f$, or \f$ H^T \f$ if `trans` is `true`, to the
+     * \f$ n \times m \f$ matrix \f$ C \f$, where \f$ V \f$ is the \f$ n \times k \f$ unit lower trapezoidal
+     * matrix stored in `v`.
+     */
+    static void larfb(size_t n, size_t k, size_t m, const T *v, size_t ldv, const T *t, size_t ldt,
+                      T *c, size_t ldc, bool trans);
+};
+
+template<>
+double_t NBlas<double_t>::dot(size_t n, const double_t *x, const double_t *y);
+
+template<>
+double_t NBlas<double_t>::norm2(size_t n, const double_t *x);
+
+template<>
+double_t NBlas<double_t>::dist2(size_t n, const double_t *x, const double_t *y);
+
+template<>
+void NBlas<double_t>::axpy(size_t n, double_t alpha, const double_t *x, double_t *y);
+
+template<>
+void NBlas<double_t>::gemvBlock(size_t n, size_t p, const double_t *a, size_t lda, const double_t *x, double_t *y);
+
+template<>
+void NBlas<double_t>::gemvTBlock(size_t n, size_t p, const double_t *a, size_t lda, const double_t *x, double_t *y);
+
+template<>
+void NBlas<double_t>::transposeLeaf(size_t n, size_t p, const double_t *a, size_t lda, double_t *b, size_t ldb);
+
+template<>
+void NBlas<double_t>::microKernel(size_t kc, const double_t *packed_a, const double_t *packed_b, double_t *c,
+                                  size_t ldc, size_t mr, size_t nr);
+
+template<>
+void NBlas<AESByte>::axpy(size_t n, AESByte alpha, const AESByte *x, AESByte *y);
+
+template<>
+void NBlas<AESByte>::gemm(size_t n, size_t p, size_t q, AESByte alpha,
+                          const AESByte *a, size_t lda, const AESByte *b, size_t ldb, AESByte *c, size_t ldc);
+
+/** @} */
+
+#endif //MATHTOOLKIT_NBLAS_H
@@ -0,0 +1,106 @@
+//
+// Created on 17/10/2026.
+//
+
+#ifndef MATHTOOLKIT_NCHOLESKY_H
+#define MATHTOOLKIT_NCHOLESKY_H
+
+#include "thirdparty.h"
+#include <NPMatrix.h>
+
+/**
+ * @ingroup NAlgebra
+ * @{
+ * @class   NCholesky
+ * @date    17/10/2026
+ * @brief   Cholesky factorization \f$ A = LL^T \f$ of a symmetric positive definite matrix.
+ *
+ * @details The matrix is factorized once at construction using `NBlas::potrf()`. Only the lower part of the matrix
+ *          is read, it is assumed symmetric. Compared to `NLU`, the factorization requires half the operations and
+ *          the solves need no permutation.
+ *
+ *          Like `NLU`, the factor is immutable and shared by the copies of a `NCholesky`, which can be used
+ *          concurrently from several threads.
+ *
+ *          `NPMatrix` uses this factorization for `det()`, `solve()` and `inv()` instead of `NLU` once `NPMatrix::llt()`
+ *          has succeeded.
+ *
+ *          If a pivot lower than `EPSILON` is encountered, the matrix is not positive definite. In this case only
+ *          `isPositiveDefinite()` is meaningful and `solve()` leaves its argument unchanged.
+ *
+ *          @section Definitions
+ *             - `n` : Order of the factorized matrix \f$ A \f$.
+ */
+
+template<typename T, typename A = NAlignedAllocator<T>>
+class NCholesky {
+
+public:
+
+    // CONSTRUCTION
+
+    /**
+     * @param m symmetric matrix to factorize, its browse indices select the block to factorize.
+     */
+    explicit NCholesky(const NPMatrix<T, A> &m);
+
+    /**
+     * @param m view on a symmetric block to factorize.
+     */
+    explicit NCholesky(const NMatrixView<const T> &m);
+
+    // GETTERS
+
+    inline size_t n() const { return _llt->n(); }
+
+    inline bool isPositiveDefinite() const { return _definite; }
+
+    /**
+     * @brief Matrix storing \f$ L \f$ in its lower part, the strict upper part is left unspecified.
+     */
+    inline const NPMatrix<T, A> &factors() const { return *_llt; }
+
+    /**
+     * @brief Lower triangular factor \f$ L \f$.
+     */
+    NPMatrix<T, A> L() const;
+
+    // ALGEBRA
+
+    /**
+     * @brief Determinant of \f$ A \f$, \f$ \prod_i L_{ii}^2 \f$.
+     */
+    T det() const;
+
+    /**
+     * @brief Inverse \f$ A^{-1} \f$.
+     */
+    NPMatrix<T, A> inv() const;
+
+    /**
+     * @param u right-hand side of dimension \f$ n \f$, overwritten with the solution.
+     * @brief Solve \f$ Ax = u \f$.
+     * @return Reference to `u`.
+     */
+    NVector<T, A> &solve(NVector<T, A> &u) const;
+
+    /**
+     * @param b right-hand sides, overwritten with the solutions.
+     * @brief Solve \f$ AX = B \f$ for all the columns of `b` at once.
+     * @details Browse indices of `b` select the right-hand sides, see `NBlas::potrs()`.
+     * @return Reference to `b`.
+     */
+    NPMatrix<T, A> &solve(NPMatrix<T, A> &b) const;
+
+protected:
+
+    void factorize(const NMatrixView<const T> &m);
+
+    shared_ptr<const NPMatrix<T, A>> _llt{};
+
+    bool _definite{};
+};
+
+/** @} */
+
+#endif //MATHTOOLKIT_NCHOLESKY_H
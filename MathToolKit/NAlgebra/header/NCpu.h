@@ -0,0 +1,184 @@
+#ifndef MATHTOOLKIT_NCPU_H
+#define MATHTOOLKIT_NCPU_H
+
+#include "thirdparty.h"
+
+/**
+ * Name of the environment variable used to force the instruction set level, either `scalar`, `sse2`, `avx2` or
+ * `avx512`.
+ */
+#define NCPU_ENV "MATHTOOLKIT_ISA"
+
+/**
+ * @ingroup NAlgebra
+ * @{
+ * @class   NCpuKernels
+ * @date    17/10/2026
+ * @brief   Table of the hot kernels bound by `NCpu` for the selected instruction set.
+ *
+ * @details All kernels work on raw arrays of size `n`, arrays may be unaligned unless specified.
+ */
+
+struct NCpuKernels {
+
+    /**
+     * @brief Dot product \f$ x \cdot y \f$.
+     */
+    double_t (*dot)(size_t n, const double_t *x, const double_t *y);
+
+    /**
+     * @brief Squared distance \f$ ||x - y||^2 \f$.
+     */
+    double_t (*dist2)(size_t n, const double_t *x, const double_t *y);
+
+    /**
+     * @brief Scaled addition \f$ y \leftarrow y + \alpha x \f$.
+     */
+    void (*axpy)(size_t n, double_t alpha, const double_t *x, double_t *y);
+
+    /**
+     * @brief Matrix vector product \f$ y \leftarrow A x \f$ where \f$ A \f$ is \f$ n \times p \f$, see `NBlas::gemv()`.
+     */
+    void (*gemv)(size_t n, size_t p, const double_t *a, size_t lda, const double_t *x, double_t *y);
+
+    /**
+     * @brief Transposed product \f$ y \leftarrow y + A^T x \f$ where \f$ A \f$ is \f$ n \times p \f$.
+     */
+    void (*gemvT)(size_t n, size_t p, const double_t *a, size_t lda, const double_t *x, double_t *y);
+
+    /**
+     * @brief Micro-kernel of `NBlas::gemm()`, see `NBlas::microKernel()`.
+     * @details `packed_b` must be aligned on `NALIGNED_ALLOCATOR_ALIGNMENT` bytes.
+     */
+    void (*gemm)(size_t kc, const double_t *packed_a, const double_t *packed_b, double_t *c, size_t ldc,
+                 size_t mr, size_t nr);
+
+    /**
+     * @brief Transposition \f$ B \leftarrow A^T \f$ of a \f$ n \times p \f$ tile, see `NBlas::transpose()`.
+     * @details Tiles of `NBLAS_TRANSPOSE_LEAF` rows and columns at most are processed by SIMD blocks of
+     * \f$ 8 \times 8 \f$, \f$ 4 \times 4 \f$ or \f$ 2 \times 2 \f$ coefficients exchanged in registers.
+     */
+    void (*transpose)(size_t n, size_t p, const double_t *a, size_t lda, double_t *b, size_t ldb);
+
+    /**
+     * @brief Scaled addition in \f$ GF(2^8) \f$, \f$ y \leftarrow y \oplus \alpha x \f$ using AES polynomial.
+     */
+    void (*gfAxpy)(size_t n, uc_t alpha, const uc_t *x, uc_t *y);
+
+    /**
+     * @brief Dot products \f$ d_k = u_k \cdot v_k \f$ of 3D vectors stored as structure of arrays.
+     * @details `u[0]`, `u[1]` and `u[2]` are the arrays of the `x`, `y` and `z` coordinates.
+     */
+    void (*dot3)(size_t n, const double_t *const *u, const double_t *const *v, double_t *d);
+
+    /**
+     * @brief Vector products \f$ u_k \leftarrow u_k \times v_k \f$, see `dot3`.
+     */
+    void (*cross3)(size_t n, double_t *const *u, const double_t *const *v);
+
+    /**
+     * @brief Norms \f$ r_k = ||u_k|| \f$, see `dot3`.
+     */
+    void (*norm3)(size_t n, const double_t *const *u, double_t *r);
+
+    /**
+     * @brief Normalization \f$ u_k \leftarrow u_k / ||u_k|| \f$ of the non-zero vectors, see `dot3`.
+     */
+    void (*normalize3)(size_t n, double_t *const *u);
+};
+
+/**
+ * @class   NCpu
+ * @brief   Runtime detection of the instruction sets supported by the processor.
+ *
+ * @details The processor is queried using `cpuid` the first time `instance()` is called. The best instruction set
+ *          level supported by both the processor and the operating system is selected and the corresponding kernels
+ *          are bound in a `NCpuKernels` table. Thus a single binary compiled without `-march` flags uses AVX-512 on
+ *          processors supporting it and falls back to AVX2 or SSE2 on older ones.
+ *
+ *          The level can be lowered using the `MATHTOOLKIT_ISA` environment variable or `setLevel()` in order to
+ *          benchmark kernels or reproduce results bit to bit between machines. A level higher than `maxLevel()` is
+ *          clamped to `maxLevel()`.
+ *
+ *          The \f$ GF(2^8) \f$ kernels use GFNI instructions at level `AVX512` if available, else byte shuffles.
+ *
+ *          @section Definitions
+ *             - `Level` : Instruction set level, each level implies the previous ones.
+ */
+
+class NCpu {
+
+public:
+
+    enum Level {
+        Scalar, SSE2, AVX2, AVX512
+    };
+
+    /**
+     * @brief Unique instance of the dispatcher.
+     */
+    static NCpu &instance();
+
+    NCpu(const NCpu &) = delete;
+
+    NCpu &operator=(const NCpu &) = delete;
+
+    // GETTERS
+
+    /**
+     * @brief Level of the kernels currently bound.
+     */
+    inline Level level() const { return _level; }
+
+    /**
+     * @brief Best level supported by the processor.
+     */
+    inline Level maxLevel() const { return _max_level; }
+
+    /**
+     * @brief `true` if the processor supports Galois field new instructions.
+     */
+    inline bool hasGFNI() const { return _gfni; }
+
+    inline const NCpuKernels &kernels() const { return _kernels; }
+
+    // SETTERS
+
+    /**
+     * @param level requested level, clamped to `maxLevel()`.
+     * @brief Bind the kernels of a given level.
+     * @details Must not be called while a kernel is running.
+     */
+    void setLevel(Level level);
+
+    // CONVERSION
+
+    static std::string levelName(Level level);
+
+    /**
+     * @param name case sensitive name of the level as returned by `levelName()`.
+     * @param level receives the level if `name` is valid.
+     * @return `false` if `name` is not a valid level name.
+     */
+    static bool parseLevel(const std::string &name, Level &level);
+
+protected:
+
+    NCpu();
+
+    void detect();
+
+    Level _level;
+
+    Level _max_level;
+
+    bool _gfni;
+
+    bool _avx512bw;
+
+    NCpuKernels _kernels;
+};
+
+/** @} */
+
+#endif //MATHTOOLKIT_NCPU_H
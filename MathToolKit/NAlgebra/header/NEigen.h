@@ -0,0 +1,176 @@
+//
+// Created on 17/10/2026.
+//
+
+#ifndef MATHTOOLKIT_NEIGEN_H
+#define MATHTOOLKIT_NEIGEN_H
+
+#include "thirdparty.h"
+#include <NPMatrix.h>
+
+/**
+ * Order below which tridiagonal eigenproblems are solved by the implicit \f$ QL \f$ algorithm instead of being split.
+ */
+#define NEIGEN_DC_MIN_ORDER 32
+
+/**
+ * Maximum number of iterations of the implicit \f$ QL \f$ algorithm and of the secular equation solver per eigenvalue.
+ */
+#define NEIGEN_MAX_ITERATIONS 64
+
+/**
+ * Gap relative to the norm of \f$ T \f$ below which consecutive eigenvalues are considered as clustered by the inverse
+ * iteration, their eigenvectors being orthogonalized against each other. LAPACK's `dstein` uses the same value.
+ */
+#define NEIGEN_STEIN_SEPARATION 1e-3
+
+/**
+ * Maximum number of inverse iterations per eigenvector.
+ */
+#define NEIGEN_STEIN_MAX_ITERATIONS 5
+
+/**
+ * Number of inverse iterations performed once the growth of an eigenvector shows that it has converged.
+ */
+#define NEIGEN_STEIN_EXTRA_ITERATIONS 2
+
+/**
+ * @ingroup NAlgebra
+ * @{
+ * @class   NEigen
+ * @date    17/10/2026
+ * @brief   Eigenvalues and eigenvectors of a symmetric matrix \f$ A = V \Lambda V^T \f$.
+ *
+ * @details The decomposition is computed once at construction in three steps :
+ *              - \f$ A \f$ is reduced to a tridiagonal matrix \f$ T = Q^T A Q \f$ by `NBlas::sytrd()`.
+ *              - The eigenpairs of \f$ T \f$ are computed. For the whole spectrum, the divide and conquer algorithm
+ *              splits \f$ T \f$ in two halves by a rank one modification, solves them recursively and merges their
+ *              eigenpairs by solving the secular equation. The eigenvectors are then updated by a matrix product,
+ *              so that most of the operations are performed by `NBlas::gemm()`. Problems of order lower than
+ *              `NEIGEN_DC_MIN_ORDER` are solved by the implicit \f$ QL \f$ algorithm. When only \f$ k \f$ pairs are
+ *              requested, their eigenvalues are isolated by bisection using Sturm sequences and their eigenvectors
+ *              computed by inverse iteration in \f$ O(nk) \f$.
+ *              - The eigenvectors of \f$ T \f$ are transformed back to the ones of \f$ A \f$ by applying \f$ Q \f$
+ *              with `NBlas::gemqrt()`.
+ *
+ *          Only the lower part of the matrix is read. The eigenvalues are sorted in ascending order and the column
+ *          \f$ i \f$ of `vectors()` is the unit eigenvector associated to `values()(i)`.
+ *
+ *          Only instantiated for real types.
+ *
+ *          @section Definitions
+ *             - `n`         : Order of the matrix.
+ *             - `k`         : Number of eigenpairs computed.
+ *             - `selection` : Which end of the spectrum is computed when \f$ k < n \f$.
+ */
+
+template<typename T, typename A = NAlignedAllocator<T>>
+class NEigen {
+
+public:
+
+    enum Selection {
+        Smallest, Largest
+    };
+
+    // CONSTRUCTION
+
+    /**
+     * @param m symmetric matrix, its browse indices select the block to decompose.
+     * @param vectors `false` to compute the eigenvalues only.
+     * @brief Compute the whole spectrum.
+     */
+    explicit NEigen(const NPMatrix<T, A> &m, bool vectors = true);
+
+    /**
+     * @param m symmetric matrix, its browse indices select the block to decompose.
+     * @param k number of eigenpairs, \f$ 1 \leq k \leq n \f$.
+     * @param selection `Smallest` or `Largest` eigenvalues.
+     * @param vectors `false` to compute the eigenvalues only.
+     * @brief Compute the \f$ k \f$ smallest or largest eigenpairs.
+     */
+    NEigen(const NPMatrix<T, A> &m, size_t k, Selection selection, bool vectors = true);
+
+    // GETTERS
+
+    inline size_t n() const { return _n; }
+
+    inline size_t k() const { return _k; }
+
+    /**
+     * @brief Eigenvalues in ascending order.
+     */
+    inline const NVector<T, A> &values() const { return _values; }
+
+    /**
+     * @brief \f$ n \times k \f$ matrix whose columns are the unit eigenvectors, empty if they were not computed.
+     */
+    inline const NPMatrix<T, A> &vectors() const { return _vectors; }
+
+    /**
+     * @brief `false` if an iteration did not converge, the results are then inaccurate.
+     */
+    inline bool isConverged() const { return _converged; }
+
+protected:
+
+    void compute(const NMatrixView<const T> &m, size_t il, size_t iu, bool vectors);
+
+    /**
+     * @param d diagonal of \f$ T \f$, overwritten with the eigenvalues.
+     * @param e \f$ n - 1 \f$ off-diagonal coefficients of \f$ T \f$, destroyed.
+     * @param z receives the eigenvectors, not computed if `nullptr`.
+     * @brief Implicit \f$ QL \f$ algorithm, the eigenvalues are not sorted.
+     * @return `false` if an eigenvalue did not converge within `NEIGEN_MAX_ITERATIONS`.
+     */
+    static bool steqr(size_t n, T *d, T *e, T *z, size_t ldz);
+
+    /**
+     * @brief Divide and conquer algorithm, see `steqr()`.
+     */
+    static bool stedc(size_t n, T *d, T *e, T *z, size_t ldz);
+
+    /**
+     * @param m order of the first half.
+     * @param beta off-diagonal coefficient coupling the halves.
+     * @brief Eigenpairs of \f$ diag(D_1, D_2) + |\beta| z z^T \f$ where \f$ z \f$ is made of the last row of
+     * \f$ Z_1 \f$ and of the first row of \f$ Z_2 \f$, multiplied by the sign of \f$ \beta \f$.
+     */
+    static bool merge(size_t n, size_t m, T beta, T *d, T *z, size_t ldz);
+
+    /**
+     * @param d \f$ k \f$ poles in ascending order.
+     * @param rho, z weights of the secular equation \f$ 1 + \rho \sum z_j^2 / (d_j - \lambda) = 0 \f$.
+     * @param i index of the root, lying in \f$ (d_i, d_{i + 1}) \f$.
+     * @param origin receives the index \f$ o \f$ of the closest pole.
+     * @param tau receives \f$ \lambda - d_o \f$, which keeps the distances to the poles accurate.
+     * @return `false` if the root did not converge within `NEIGEN_MAX_ITERATIONS`.
+     */
+    static bool secular(size_t k, const T *d, const T *z, T rho, size_t i, size_t &origin, T &tau);
+
+    /**
+     * @brief Eigenvalues of indices \f$ [il, iu) \f$ of \f$ T \f$ by bisection, stored in `w`.
+     */
+    static void stebz(size_t n, const T *d, const T *e, size_t il, size_t iu, T *w);
+
+    /**
+     * @brief Eigenvectors of \f$ T \f$ for the \f$ k \f$ eigenvalues `w` by inverse iteration, stored in the
+     * columns of `z`.
+     * @return `false` if an eigenvector did not converge within `NEIGEN_STEIN_MAX_ITERATIONS`.
+     */
+    static bool stein(size_t n, const T *d, const T *e, size_t k, const T *w, T *z, size_t ldz);
+
+    size_t _n{};
+
+    size_t _k{};
+
+    NVector<T, A> _values{};
+
+    NPMatrix<T, A> _vectors{};
+
+    bool _converged{};
+};
+
+/** @} */
+
+#endif //MATHTOOLKIT_NEIGEN_H
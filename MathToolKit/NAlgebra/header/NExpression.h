@@ -0,0 +1,360 @@
+#ifndef MATHTOOLKIT_NEXPRESSION_H
+#define MATHTOOLKIT_NEXPRESSION_H
+
+#include "thirdparty.h"
+#include <NMatrixView.h>
+#include <NThreadPool.h>
+
+/**
+ * @ingroup NAlgebra
+ * @{
+ * @class   NExpr
+ * @date    17/10/2026
+ * @brief   Lazy element-wise expression on `NVector` or `NPMatrix` objects.
+ *
+ * @details The sum `+` and the difference `-` of two `NVector` or `NPMatrix` lvalues do not compute their result.
+ *          They return an expression which stores a tree of operations whose leaves are read-only views on the
+ *          operands. Operators `+`, `-`, `* s` and `/ s` applied to an expression extend the tree. The expression is
+ *          evaluated in a single loop when it is converted to the result type `R`, or when it is assigned to an
+ *          existing object using `=`, `+=` or `-=`. In the later case no memory is allocated.
+ *
+ *          For example `u = x + y - z` reads `x`, `y` and `z` once and writes `u` once without any temporary vector.
+ *
+ *          Leaves never refer to a temporary: when an operand is a temporary `R` the operation is computed
+ *          immediately into it and the operator returns a value. Products by a scalar of a plain `R` are computed
+ *          immediately too, so `auto m = 2 * a` is a matrix independent of `a`.
+ *
+ *          An expression can neither be copied nor moved, so that `auto e = a + b` does not compile instead of keeping
+ *          references to `a` and `b`. Browse indices of the operands are taken into account and reset when the
+ *          leaves are created.
+ *
+ *          An expression converts implicitly to `R`, so any function taking a `R` can be called with an expression.
+ *
+ *          @section Definitions
+ *             - `R` : Result type of the expression, `NVector<T>` or `NPMatrix<T>`. Vectors are seen as
+ *             \f$ 1 \times n \f$ matrices.
+ *             - `E` : Type of the node of the expression tree, `NLeafExpr`, `NUnaryExpr`, `NScalarExpr` or
+ *             `NBinaryExpr`.
+ */
+
+template<typename R, typename E>
+class NExpr;
+
+// OPERATIONS
+
+struct NAddOp {
+    template<typename T>
+    static inline T apply(const T &x, const T &y) { return T(x + y); }
+};
+
+struct NSubOp {
+    template<typename T>
+    static inline T apply(const T &x, const T &y) { return T(x - y); }
+};
+
+struct NMulOp {
+    template<typename T>
+    static inline T apply(const T &x, const T &s) { return T(x * s); }
+};
+
+struct NDivOp {
+    template<typename T>
+    static inline T apply(const T &x, const T &s) { return T(x / s); }
+};
+
+struct NOppOp {
+    template<typename T>
+    static inline T apply(const T &x) { return T(x * T(-1)); }
+};
+
+struct NCopyOp {
+    template<typename T>
+    static inline void assign(T &x, const T &y) { x = y; }
+};
+
+struct NAddAssignOp {
+    template<typename T>
+    static inline void assign(T &x, const T &y) { x = T(x + y); }
+};
+
+struct NSubAssignOp {
+    template<typename T>
+    static inline void assign(T &x, const T &y) { x = T(x - y); }
+};
+
+// NODES
+
+template<typename T>
+class NLeafExpr {
+
+public:
+
+    typedef T scalar_t;
+
+    explicit NLeafExpr(const NMatrixView<const T> &m) : _m(m) {}
+
+    inline T operator()(size_t i, size_t j) const { return _m.data()[i * _m.ld() + j]; }
+
+    inline size_t n() const { return _m.n(); }
+
+    inline size_t p() const { return _m.p(); }
+
+    /**
+     * @brief `true` if the leaf overlaps `m` without being element-wise aligned with it.
+     */
+    inline bool aliases(const NMatrixView<const T> &m) const {
+        if (_m.n() == 0 || _m.p() == 0 || m.n() == 0 || m.p() == 0) {
+            return false;
+        }
+        if (_m.data() == m.data() && _m.ld() == m.ld()) {
+            return false;
+        }
+        const T *end = _m.data() + (_m.n() - 1) * _m.ld() + _m.p(), *m_end = m.data() + (m.n() - 1) * m.ld() + m.p();
+        return _m.data() < m_end && m.data() < end;
+    }
+
+protected:
+
+    NMatrixView<const T> _m;
+};
+
+template<typename E, typename Op>
+class NUnaryExpr {
+
+public:
+
+    typedef typename E::scalar_t scalar_t;
+
+    explicit NUnaryExpr(const E &e) : _e(e) {}
+
+    inline scalar_t operator()(size_t i, size_t j) const { return Op::apply(_e(i, j)); }
+
+    inline size_t n() const { return _e.n(); }
+
+    inline size_t p() const { return _e.p(); }
+
+    inline bool aliases(const NMatrixView<const scalar_t> &m) const { return _e.aliases(m); }
+
+protected:
+
+    E _e;
+};
+
+template<typename E, typename Op>
+class NScalarExpr {
+
+public:
+
+    typedef typename E::scalar_t scalar_t;
+
+    NScalarExpr(const E &e, scalar_t s) : _e(e), _s(s) {}
+
+    inline scalar_t operator()(size_t i, size_t j) const { return Op::apply(_e(i, j), _s); }
+
+    inline size_t n() const { return _e.n(); }
+
+    inline size_t p() const { return _e.p(); }
+
+    inline bool aliases(const NMatrixView<const scalar_t> &m) const { return _e.aliases(m); }
+
+protected:
+
+    E _e;
+
+    scalar_t _s;
+};
+
+template<typename E1, typename E2, typename Op>
+class NBinaryExpr {
+
+public:
+
+    typedef typename E1::scalar_t scalar_t;
+
+    NBinaryExpr(const E1 &e1, const E2 &e2) : _e1(e1), _e2(e2) {
+        assert(e1.n() == e2.n() && e1.p() == e2.p());
+    }
+
+    inline scalar_t operator()(size_t i, size_t j) const { return Op::apply(_e1(i, j), _e2(i, j)); }
+
+    inline size_t n() const { return _e1.n(); }
+
+    inline size_t p() const { return _e1.p(); }
+
+    inline bool aliases(const NMatrixView<const scalar_t> &m) const { return _e1.aliases(m) || _e2.aliases(m); }
+
+protected:
+
+    E1 _e1;
+
+    E2 _e2;
+};
+
+// EXPRESSION
+
+template<typename R, typename E>
+class NExpr {
+
+public:
+
+    typedef typename R::value_type scalar_t;
+
+    NExpr(const E &e) : _e(e) {}
+
+    NExpr(const NExpr &) = delete;
+
+    NExpr &operator=(const NExpr &) = delete;
+
+    inline const E &node() const { return _e; }
+
+    inline size_t n() const { return _e.n(); }
+
+    inline size_t p() const { return _e.p(); }
+
+    inline scalar_t operator()(size_t i, size_t j) const { return _e(i, j); }
+
+    /**
+     * @name Evaluation
+     * @brief Evaluate the expression into `m` which must have the same size.
+     * @details If `m` overlaps an operand of the expression in a way that would corrupt the result, the expression
+     * is first evaluated in a temporary buffer.
+     * @{
+     */
+
+    inline void assignTo(const NMatrixView<scalar_t> &m) const { evalTo<NCopyOp>(m); }
+
+    inline void addTo(const NMatrixView<scalar_t> &m) const { evalTo<NAddAssignOp>(m); }
+
+    inline void subTo(const NMatrixView<scalar_t> &m) const { evalTo<NSubAssignOp>(m); }
+
+    /** @} */
+
+protected:
+
+    template<typename Op, typename Node>
+    static void evalNode(const Node &e, const NMatrixView<scalar_t> &m) {
+        const size_t p = m.p();
+        scalar_t *data = m.data();
+        const size_t ld = m.ld();
+
+        NThreadPool::instance().parallelFor(0, m.n() * p, NTHREADPOOL_MIN_SIZE, [&](size_t k1, size_t k2) {
+            size_t i = k1 / p, j = k1 % p;
+            for (size_t k = k1; k < k2; ++k) {
+                Op::assign(data[i * ld + j], e(i, j));
+                if (++j == p) {
+                    j = 0;
+                    ++i;
+                }
+            }
+        });
+    }
+
+    template<typename Op>
+    void evalTo(const NMatrixView<scalar_t> &m) const {
+        assert(m.n() == n() && m.p() == p());
+
+        if (!_e.aliases(m)) {
+            evalNode<Op>(_e, m);
+            return;
+        }
+
+        std::vector<scalar_t> buffer(m.n() * m.p());
+        NMatrixView<scalar_t> tmp(buffer.data(), m.n(), m.p());
+        evalNode<NCopyOp>(_e, tmp);
+        evalNode<Op>(NLeafExpr<scalar_t>(tmp), m);
+    }
+
+    E _e;
+};
+
+/** @} */
+
+template<typename X>
+struct NIdentity {
+    typedef X type;
+};
+
+// OPERATORS
+
+template<typename R, typename E1, typename E2>
+inline NExpr<R, NBinaryExpr<E1, E2, NAddOp>> operator+(const NExpr<R, E1> &a, const NExpr<R, E2> &b) {
+    return {NBinaryExpr<E1, E2, NAddOp>(a.node(), b.node())};
+}
+
+template<typename R, typename E1, typename E2>
+inline NExpr<R, NBinaryExpr<E1, E2, NSubOp>> operator-(const NExpr<R, E1> &a, const NExpr<R, E2> &b) {
+    return {NBinaryExpr<E1, E2, NSubOp>(a.node(), b.node())};
+}
+
+template<typename R, typename E>
+inline NExpr<R, NBinaryExpr<E, NLeafExpr<typename R::value_type>, NAddOp>>
+operator+(const NExpr<R, E> &a, const typename NIdentity<R>::type &b) {
+    return {NBinaryExpr<E, NLeafExpr<typename R::value_type>, NAddOp>(a.node(), b.expr().node())};
+}
+
+template<typename R, typename E>
+inline NExpr<R, NBinaryExpr<NLeafExpr<typename R::value_type>, E, NAddOp>>
+operator+(const typename NIdentity<R>::type &a, const NExpr<R, E> &b) {
+    return {NBinaryExpr<NLeafExpr<typename R::value_type>, E, NAddOp>(a.expr().node(), b.node())};
+}
+
+template<typename R, typename E>
+inline NExpr<R, NBinaryExpr<E, NLeafExpr<typename R::value_type>, NSubOp>>
+operator-(const NExpr<R, E> &a, const typename NIdentity<R>::type &b) {
+    return {NBinaryExpr<E, NLeafExpr<typename R::value_type>, NSubOp>(a.node(), b.expr().node())};
+}
+
+template<typename R, typename E>
+inline NExpr<R, NBinaryExpr<NLeafExpr<typename R::value_type>, E, NSubOp>>
+operator-(const typename NIdentity<R>::type &a, const NExpr<R, E> &b) {
+    return {NBinaryExpr<NLeafExpr<typename R::value_type>, E, NSubOp>(a.expr().node(), b.node())};
+}
+
+template<typename R, typename E>
+inline R operator+(const NExpr<R, E> &a, typename NIdentity<R>::type &&b) {
+    b += a;
+    return std::move(b);
+}
+
+template<typename R, typename E>
+inline R operator+(typename NIdentity<R>::type &&a, const NExpr<R, E> &b) {
+    a += b;
+    return std::move(a);
+}
+
+template<typename R, typename E>
+inline R operator-(const NExpr<R, E> &a, typename NIdentity<R>::type &&b) {
+    b = a - b;
+    return std::move(b);
+}
+
+template<typename R, typename E>
+inline R operator-(typename NIdentity<R>::type &&a, const NExpr<R, E> &b) {
+    a -= b;
+    return std::move(a);
+}
+
+template<typename R, typename E>
+inline NExpr<R, NUnaryExpr<E, NOppOp>> operator-(const NExpr<R, E> &a) {
+    return {NUnaryExpr<E, NOppOp>(a.node())};
+}
+
+template<typename R, typename E>
+inline NExpr<R, NScalarExpr<E, NMulOp>> operator*(typename NIdentity<typename R::value_type>::type s,
+                                                   const NExpr<R, E> &a) {
+    return {NScalarExpr<E, NMulOp>(a.node(), s)};
+}
+
+template<typename R, typename E>
+inline NExpr<R, NScalarExpr<E, NMulOp>> operator*(const NExpr<R, E> &a,
+                                                   typename NIdentity<typename R::value_type>::type s) {
+    return {NScalarExpr<E, NMulOp>(a.node(), s)};
+}
+
+template<typename R, typename E>
+inline NExpr<R, NScalarExpr<E, NDivOp>> operator/(const NExpr<R, E> &a,
+                                                   typename NIdentity<typename R::value_type>::type s) {
+    return {NScalarExpr<E, NDivOp>(a.node(), s)};
+}
+
+#endif //MATHTOOLKIT_NEXPRESSION_H
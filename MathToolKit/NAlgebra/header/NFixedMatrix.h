@@ -0,0 +1,376 @@
+//
+// Created on 17/10/2026.
+//
+
+#ifndef MATHTOOLKIT_NFIXEDMATRIX_H
+#define MATHTOOLKIT_NFIXEDMATRIX_H
+
+#include "thirdparty.h"
+#include <NFixedVector.h>
+#include <NPMatrix.h>
+
+template<typename T, size_t N, size_t M>
+class NFixedMatrix;
+
+/**
+ * @ingroup NAlgebra
+ * @{
+ * @class   NFixedInverse
+ * @brief   Closed-form determinant and inverse of the square fixed size matrices of order \f$ N \leq 4 \f$.
+ * @details The inverse is the adjugate matrix divided by the determinant. It is computed without pivoting, the
+ *          matrix is assumed to be well conditioned.
+ */
+
+template<typename T, size_t N>
+struct NFixedInverse {
+    static_assert(N >= 1 && N <= 4, "Closed-form determinant and inverse are only available for N <= 4");
+};
+
+template<typename T>
+struct NFixedInverse<T, 1> {
+    static inline T det(const NFixedMatrix<T, 1, 1> &a) { return a(0, 0); }
+
+    static inline NFixedMatrix<T, 1, 1> inv(const NFixedMatrix<T, 1, 1> &a) { return {{T(1) / a(0, 0)}}; }
+};
+
+template<typename T>
+struct NFixedInverse<T, 2> {
+    static inline T det(const NFixedMatrix<T, 2, 2> &a) { return a(0, 0) * a(1, 1) - a(0, 1) * a(1, 0); }
+
+    static inline NFixedMatrix<T, 2, 2> inv(const NFixedMatrix<T, 2, 2> &a) {
+        T d = T(1) / det(a);
+        return {{a(1, 1) * d,  -a(0, 1) * d},
+                {-a(1, 0) * d, a(0, 0) * d}};
+    }
+};
+
+template<typename T>
+struct NFixedInverse<T, 3> {
+    static inline T det(const NFixedMatrix<T, 3, 3> &a) {
+        return a(0, 0) * (a(1, 1) * a(2, 2) - a(1, 2) * a(2, 1))
+               - a(0, 1) * (a(1, 0) * a(2, 2) - a(1, 2) * a(2, 0))
+               + a(0, 2) * (a(1, 0) * a(2, 1) - a(1, 1) * a(2, 0));
+    }
+
+    static inline NFixedMatrix<T, 3, 3> inv(const NFixedMatrix<T, 3, 3> &a) {
+        NFixedMatrix<T, 3, 3> res;
+        res(0, 0) = a(1, 1) * a(2, 2) - a(1, 2) * a(2, 1);
+        res(0, 1) = a(0, 2) * a(2, 1) - a(0, 1) * a(2, 2);
+        res(0, 2) = a(0, 1) * a(1, 2) - a(0, 2) * a(1, 1);
+        res(1, 0) = a(1, 2) * a(2, 0) - a(1, 0) * a(2, 2);
+        res(1, 1) = a(0, 0) * a(2, 2) - a(0, 2) * a(2, 0);
+        res(1, 2) = a(0, 2) * a(1, 0) - a(0, 0) * a(1, 2);
+        res(2, 0) = a(1, 0) * a(2, 1) - a(1, 1) * a(2, 0);
+        res(2, 1) = a(0, 1) * a(2, 0) - a(0, 0) * a(2, 1);
+        res(2, 2) = a(0, 0) * a(1, 1) - a(0, 1) * a(1, 0);
+        return res / (a(0, 0) * res(0, 0) + a(0, 1) * res(1, 0) + a(0, 2) * res(2, 0));
+    }
+};
+
+template<typename T>
+struct NFixedInverse<T, 4> {
+
+    /**
+     * @brief Determinant expanded using the \f$ 2 \times 2 \f$ minors of the two first and two last rows.
+     */
+    static inline T det(const NFixedMatrix<T, 4, 4> &a) {
+        T s[6], c[6];
+        minors(a, s, c);
+        return s[0] * c[5] - s[1] * c[4] + s[2] * c[3] + s[3] * c[2] - s[4] * c[1] + s[5] * c[0];
+    }
+
+    static inline NFixedMatrix<T, 4, 4> inv(const NFixedMatrix<T, 4, 4> &a) {
+        T s[6], c[6];
+        minors(a, s, c);
+        T d = T(1) / (s[0] * c[5] - s[1] * c[4] + s[2] * c[3] + s[3] * c[2] - s[4] * c[1] + s[5] * c[0]);
+
+        NFixedMatrix<T, 4, 4> res;
+        res(0, 0) = (a(1, 1) * c[5] - a(1, 2) * c[4] + a(1, 3) * c[3]) * d;
+        res(0, 1) = (-a(0, 1) * c[5] + a(0, 2) * c[4] - a(0, 3) * c[3]) * d;
+        res(0, 2) = (a(3, 1) * s[5] - a(3, 2) * s[4] + a(3, 3) * s[3]) * d;
+        res(0, 3) = (-a(2, 1) * s[5] + a(2, 2) * s[4] - a(2, 3) * s[3]) * d;
+        res(1, 0) = (-a(1, 0) * c[5] + a(1, 2) * c[2] - a(1, 3) * c[1]) * d;
+        res(1, 1) = (a(0, 0) * c[5] - a(0, 2) * c[2] + a(0, 3) * c[1]) * d;
+        res(1, 2) = (-a(3, 0) * s[5] + a(3, 2) * s[2] - a(3, 3) * s[1]) * d;
+        res(1, 3) = (a(2, 0) * s[5] - a(2, 2) * s[2] + a(2, 3) * s[1]) * d;
+        res(2, 0) = (a(1, 0) * c[4] - a(1, 1) * c[2] + a(1, 3) * c[0]) * d;
+        res(2, 1) = (-a(0, 0) * c[4] + a(0, 1) * c[2] - a(0, 3) * c[0]) * d;
+        res(2, 2) = (a(3, 0) * s[4] - a(3, 1) * s[2] + a(3, 3) * s[0]) * d;
+        res(2, 3) = (-a(2, 0) * s[4] + a(2, 1) * s[2] - a(2, 3) * s[0]) * d;
+        res(3, 0) = (-a(1, 0) * c[3] + a(1, 1) * c[1] - a(1, 2) * c[0]) * d;
+        res(3, 1) = (a(0, 0) * c[3] - a(0, 1) * c[1] + a(0, 2) * c[0]) * d;
+        res(3, 2) = (-a(3, 0) * s[3] + a(3, 1) * s[1] - a(3, 2) * s[0]) * d;
+        res(3, 3) = (a(2, 0) * s[3] - a(2, 1) * s[1] + a(2, 2) * s[0]) * d;
+        return res;
+    }
+
+protected:
+
+    static inline void minors(const NFixedMatrix<T, 4, 4> &a, T *s, T *c) {
+        s[0] = a(0, 0) * a(1, 1) - a(1, 0) * a(0, 1);
+        s[1] = a(0, 0) * a(1, 2) - a(1, 0) * a(0, 2);
+        s[2] = a(0, 0) * a(1, 3) - a(1, 0) * a(0, 3);
+        s[3] = a(0, 1) * a(1, 2) - a(1, 1) * a(0, 2);
+        s[4] = a(0, 1) * a(1, 3) - a(1, 1) * a(0, 3);
+        s[5] = a(0, 2) * a(1, 3) - a(1, 2) * a(0, 3);
+
+        c[5] = a(2, 2) * a(3, 3) - a(3, 2) * a(2, 3);
+        c[4] = a(2, 1) * a(3, 3) - a(3, 1) * a(2, 3);
+        c[3] = a(2, 1) * a(3, 2) - a(3, 1) * a(2, 2);
+        c[2] = a(2, 0) * a(3, 3) - a(3, 0) * a(2, 3);
+        c[1] = a(2, 0) * a(3, 2) - a(3, 0) * a(2, 2);
+        c[0] = a(2, 0) * a(3, 1) - a(3, 0) * a(2, 1);
+    }
+};
+
+/**
+ * @class   NFixedMatrix
+ * @date    17/10/2026
+ * @brief   \f$ N \times M \f$ matrix whose dimensions are known at compile time.
+ *
+ * @details The coefficients are stored inline by rows, so that a `NFixedMatrix` performs no heap allocation. It is
+ *          meant for the small matrices of geometry such as \f$ 3 \times 3 \f$ rotations and \f$ 4 \times 4 \f$
+ *          homogeneous transforms, for which `NPMatrix` would allocate, keep browse indices and a factorization cache.
+ *          The operations are unrolled using `NUnroll`.
+ *
+ *          `det()` and `inv()` use closed-form expressions for square matrices of order \f$ N \leq 4 \f$, see
+ *          `NFixedInverse`.
+ *
+ *          Conversion to `NPMatrix` is made using `matrix()`, conversion from `NPMatrix` using the explicit
+ *          constructor.
+ *
+ *          @section Definitions
+ *             - `N` : Number of rows.
+ *             - `M` : Number of columns.
+ */
+
+template<typename T, size_t N, size_t M>
+class NFixedMatrix {
+
+public:
+
+    // CONSTRUCTION
+
+    /**
+     * @brief Construct the zero matrix.
+     */
+    NFixedMatrix() : _data() {}
+
+    /**
+     * @param rows coefficients given row by row, missing coefficients are set to `0`.
+     */
+    NFixedMatrix(std::initializer_list<std::initializer_list<T>> rows) : _data() {
+        assert(rows.size() <= N);
+        size_t i = 0;
+        for (const auto &row : rows) {
+            assert(row.size() <= M);
+            std::copy(row.begin(), row.end(), _data + M * i++);
+        }
+    }
+
+    /**
+     * @param m \f$ N \times M \f$ matrix.
+     */
+    template<typename A>
+    explicit NFixedMatrix(const NPMatrix<T, A> &m) : _data() {
+        assert(m.n() == N && m.p() == M);
+        for (size_t i = 0; i < N; ++i) {
+            for (size_t j = 0; j < M; ++j) {
+                _data[M * i + j] = m(i, j);
+            }
+        }
+    }
+
+    // GETTERS
+
+    static constexpr size_t n() { return N; }
+
+    static constexpr size_t p() { return M; }
+
+    inline const T *data() const { return _data; }
+
+    inline T *data() { return _data; }
+
+    inline NFixedVector<T, M> row(size_t i) const {
+        assert(i < N);
+        NFixedVector<T, M> u;
+        NUnroll<M>::apply([&](size_t j) { u[j] = _data[M * i + j]; });
+        return u;
+    }
+
+    inline NFixedVector<T, N> col(size_t j) const {
+        assert(j < M);
+        NFixedVector<T, N> u;
+        NUnroll<N>::apply([&](size_t i) { u[i] = _data[M * i + j]; });
+        return u;
+    }
+
+    // CONVERSION
+
+    /**
+     * @brief Copy of this matrix as a `NPMatrix`.
+     */
+    template<typename A = NAlignedAllocator<T>>
+    NPMatrix<T, A> matrix() const {
+        NPMatrix<T, A> m(N, M);
+        std::copy(_data, _data + N * M, m.data());
+        return m;
+    }
+
+    std::string str() const {
+        std::stringstream stream;
+        for (size_t i = 0; i < N; ++i) {
+            stream << "\n" << row(i);
+        }
+        return stream.str();
+    }
+
+    // ALGEBRA
+
+    inline NFixedMatrix<T, M, N> trans() const {
+        NFixedMatrix<T, M, N> res;
+        NUnroll<N * M>::apply([&](size_t k) { res(k % M, k / M) = _data[k]; });
+        return res;
+    }
+
+    inline T det() const {
+        static_assert(N == M, "Determinant is only defined for square matrices");
+        return NFixedInverse<T, N>::det(*this);
+    }
+
+    inline NFixedMatrix<T, N, M> inv() const {
+        static_assert(N == M, "Inverse is only defined for square matrices");
+        return NFixedInverse<T, N>::inv(*this);
+    }
+
+    inline T distance(const NFixedMatrix<T, N, M> &a) const {
+        T dist = T(0);
+        NUnroll<N * M>::apply([&](size_t k) { dist += (_data[k] - a._data[k]) * (_data[k] - a._data[k]); });
+        return std::sqrt(dist);
+    }
+
+    inline T norm() const { return distance(NFixedMatrix<T, N, M>()); }
+
+    // OPERATORS
+
+    inline NFixedMatrix<T, N, M> &operator+=(const NFixedMatrix<T, N, M> &a) {
+        NUnroll<N * M>::apply([&](size_t k) { _data[k] += a._data[k]; });
+        return *this;
+    }
+
+    inline NFixedMatrix<T, N, M> &operator-=(const NFixedMatrix<T, N, M> &a) {
+        NUnroll<N * M>::apply([&](size_t k) { _data[k] -= a._data[k]; });
+        return *this;
+    }
+
+    inline NFixedMatrix<T, N, M> &operator*=(T s) {
+        NUnroll<N * M>::apply([&](size_t k) { _data[k] *= s; });
+        return *this;
+    }
+
+    inline NFixedMatrix<T, N, M> &operator/=(T s) {
+        NUnroll<N * M>::apply([&](size_t k) { _data[k] /= s; });
+        return *this;
+    }
+
+    inline friend NFixedMatrix<T, N, M> operator+(NFixedMatrix<T, N, M> a, const NFixedMatrix<T, N, M> &b) {
+        return a += b;
+    }
+
+    inline friend NFixedMatrix<T, N, M> operator-(NFixedMatrix<T, N, M> a, const NFixedMatrix<T, N, M> &b) {
+        return a -= b;
+    }
+
+    inline friend NFixedMatrix<T, N, M> operator-(NFixedMatrix<T, N, M> a) { return a *= T(-1); }
+
+    inline friend NFixedMatrix<T, N, M> operator*(T s, NFixedMatrix<T, N, M> a) { return a *= s; }
+
+    inline friend NFixedMatrix<T, N, M> operator*(NFixedMatrix<T, N, M> a, T s) { return a *= s; }
+
+    inline friend NFixedMatrix<T, N, M> operator/(NFixedMatrix<T, N, M> a, T s) { return a /= s; }
+
+    inline friend NFixedVector<T, N> operator*(const NFixedMatrix<T, N, M> &a, const NFixedVector<T, M> &u) {
+        NFixedVector<T, N> res;
+        NUnroll<N>::apply([&](size_t i) {
+            NUnroll<M>::apply([&](size_t j) { res[i] += a._data[M * i + j] * u[j]; });
+        });
+        return res;
+    }
+
+    template<size_t P>
+    inline friend NFixedMatrix<T, N, P> operator*(const NFixedMatrix<T, N, M> &a, const NFixedMatrix<T, M, P> &b) {
+        NFixedMatrix<T, N, P> res;
+        NUnroll<N>::apply([&](size_t i) {
+            NUnroll<M>::apply([&](size_t k) {
+                NUnroll<P>::apply([&](size_t j) { res(i, j) += a._data[M * i + k] * b(k, j); });
+            });
+        });
+        return res;
+    }
+
+    /**
+     * @brief Solve \f$ Ax = u \f$ using the closed-form inverse.
+     */
+    inline friend NFixedVector<T, N> operator%(const NFixedMatrix<T, N, M> &a, const NFixedVector<T, N> &u) {
+        return a.inv() * u;
+    }
+
+    inline friend T operator!(const NFixedMatrix<T, N, M> &a) { return a.norm(); }
+
+    inline friend T operator/(const NFixedMatrix<T, N, M> &a, const NFixedMatrix<T, N, M> &b) {
+        return a.distance(b);
+    }
+
+    inline friend bool operator==(const NFixedMatrix<T, N, M> &a, const NFixedMatrix<T, N, M> &b) {
+        return a.distance(b) <= EPSILON;
+    }
+
+    inline friend bool operator!=(const NFixedMatrix<T, N, M> &a, const NFixedMatrix<T, N, M> &b) {
+        return !(a == b);
+    }
+
+    friend std::ostream &operator<<(std::ostream &os, const NFixedMatrix<T, N, M> &a) { return os << a.str(); }
+
+    // BI-DIMENSIONAL ACCESSORS
+
+    inline T &operator()(size_t i, size_t j) {
+        assert(i < N && j < M);
+        return _data[M * i + j];
+    }
+
+    inline T operator()(size_t i, size_t j) const {
+        assert(i < N && j < M);
+        return _data[M * i + j];
+    }
+
+    // STATIC FUNCTIONS
+
+    inline static NFixedMatrix<T, N, M> zeros() { return NFixedMatrix<T, N, M>(); }
+
+    inline static NFixedMatrix<T, N, M> eye() {
+        NFixedMatrix<T, N, M> res;
+        NUnroll<(N < M) ? N : M>::apply([&](size_t k) { res._data[M * k + k] = T(1); });
+        return res;
+    }
+
+protected:
+
+    T _data[N * M];
+};
+
+/**
+ * Real \f$ 2 \times 2 \f$ matrix
+ */
+typedef NFixedMatrix<double_t, 2, 2> mat2_t;
+/**
+ * Real \f$ 3 \times 3 \f$ matrix
+ */
+typedef NFixedMatrix<double_t, 3, 3> mat3_t;
+/**
+ * Real \f$ 4 \times 4 \f$ matrix
+ */
+typedef NFixedMatrix<double_t, 4, 4> mat4_t;
+
+/** @} */
+
+#endif //MATHTOOLKIT_NFIXEDMATRIX_H
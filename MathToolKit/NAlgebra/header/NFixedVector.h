@@ -0,0 +1,242 @@
+//
+// Created on 17/10/2026.
+//
+
+#ifndef MATHTOOLKIT_NFIXEDVECTOR_H
+#define MATHTOOLKIT_NFIXEDVECTOR_H
+
+#include "thirdparty.h"
+#include <NVector.h>
+
+/**
+ * @ingroup NAlgebra
+ * @{
+ * @class   NUnroll
+ * @brief   Call `f(0)`, ..., `f(K - 1)` without loop, used to unroll the operations of fixed size objects.
+ */
+
+template<size_t K>
+struct NUnroll {
+    template<typename F>
+    static inline void apply(F &&f) {
+        NUnroll<K - 1>::apply(f);
+        f(K - 1);
+    }
+};
+
+template<>
+struct NUnroll<0> {
+    template<typename F>
+    static inline void apply(F &&) {}
+};
+
+/**
+ * @class   NFixedVector
+ * @date    17/10/2026
+ * @brief   Vector of \f$ \mathbb{K}^N \f$ whose dimension is known at compile time.
+ *
+ * @details The coordinates are stored inline, so that a `NFixedVector` performs no heap allocation and an array of
+ *          vectors is a single contiguous block of \f$ N \f$ times the number of vectors coordinates. The operations
+ *          are unrolled using `NUnroll` and defined in this header so that they can be inlined.
+ *
+ *          Unlike `NVector`, there are no browse indices nor expression templates. The semantic of the operators is
+ *          the one of `NVector`, in particular `==` compares the distance of the vectors to `EPSILON`.
+ *
+ *          Conversion to `NVector` is made using `vector()`, conversion from `NVector` using the explicit constructor.
+ *
+ *          @section Definitions
+ *             - `N` : Dimension of the vector.
+ */
+
+template<typename T, size_t N>
+class NFixedVector {
+
+public:
+
+    // CONSTRUCTION
+
+    /**
+     * @brief Construct the zero vector.
+     */
+    NFixedVector() : _data() {}
+
+    /**
+     * @param coords coordinates of the vector, missing coordinates are set to `0`.
+     */
+    NFixedVector(std::initializer_list<T> coords) : _data() {
+        assert(coords.size() <= N);
+        std::copy(coords.begin(), coords.end(), _data);
+    }
+
+    /**
+     * @param u vector of dimension \f$ N \f$.
+     */
+    template<typename A>
+    explicit NFixedVector(const NVector<T, A> &u) : _data() {
+        assert(u.dim() == N);
+        std::copy(u.data(), u.data() + N, _data);
+    }
+
+    // GETTERS
+
+    static constexpr size_t dim() { return N; }
+
+    inline const T *data() const { return _data; }
+
+    inline T *data() { return _data; }
+
+    inline const T *begin() const { return _data; }
+
+    inline T *begin() { return _data; }
+
+    inline const T *end() const { return _data + N; }
+
+    inline T *end() { return _data + N; }
+
+    // CONVERSION
+
+    /**
+     * @brief Copy of this vector as a `NVector`.
+     */
+    template<typename A = NAlignedAllocator<T>>
+    NVector<T, A> vector() const {
+        NVector<T, A> u(N);
+        std::copy(_data, _data + N, u.data());
+        return u;
+    }
+
+    std::string str() const {
+        std::stringstream stream;
+
+        stream << '(';
+        for (size_t k = 0; k < N; ++k) {
+            stream << (_data[k] >= 0 ? ' ' : '-') << std::abs(_data[k]);
+        }
+        stream << " )";
+        return stream.str();
+    }
+
+    // ALGEBRA
+
+    inline T dotProduct(const NFixedVector<T, N> &u) const {
+        T dot = T(0);
+        NUnroll<N>::apply([&](size_t k) { dot += _data[k] * u._data[k]; });
+        return dot;
+    }
+
+    inline T norm() const { return std::sqrt(dotProduct(*this)); }
+
+    inline T distance(const NFixedVector<T, N> &u) const {
+        T dist = T(0);
+        NUnroll<N>::apply([&](size_t k) { dist += (_data[k] - u._data[k]) * (_data[k] - u._data[k]); });
+        return std::sqrt(dist);
+    }
+
+    inline bool isNull() const { return norm() <= EPSILON; }
+
+    inline bool isEqual(const NFixedVector<T, N> &u) const { return distance(u) <= EPSILON; }
+
+    // OPERATORS
+
+    inline NFixedVector<T, N> &operator+=(const NFixedVector<T, N> &u) {
+        NUnroll<N>::apply([&](size_t k) { _data[k] += u._data[k]; });
+        return *this;
+    }
+
+    inline NFixedVector<T, N> &operator-=(const NFixedVector<T, N> &u) {
+        NUnroll<N>::apply([&](size_t k) { _data[k] -= u._data[k]; });
+        return *this;
+    }
+
+    inline NFixedVector<T, N> &operator*=(T s) {
+        NUnroll<N>::apply([&](size_t k) { _data[k] *= s; });
+        return *this;
+    }
+
+    inline NFixedVector<T, N> &operator/=(T s) {
+        NUnroll<N>::apply([&](size_t k) { _data[k] /= s; });
+        return *this;
+    }
+
+    inline friend NFixedVector<T, N> operator+(NFixedVector<T, N> u, const NFixedVector<T, N> &v) { return u += v; }
+
+    inline friend NFixedVector<T, N> operator-(NFixedVector<T, N> u, const NFixedVector<T, N> &v) { return u -= v; }
+
+    inline friend NFixedVector<T, N> operator-(NFixedVector<T, N> u) { return u *= T(-1); }
+
+    inline friend NFixedVector<T, N> operator*(T s, NFixedVector<T, N> u) { return u *= s; }
+
+    inline friend NFixedVector<T, N> operator*(NFixedVector<T, N> u, T s) { return u *= s; }
+
+    inline friend NFixedVector<T, N> operator/(NFixedVector<T, N> u, T s) { return u /= s; }
+
+    inline friend T operator|(const NFixedVector<T, N> &u, const NFixedVector<T, N> &v) { return u.dotProduct(v); }
+
+    inline friend T operator!(const NFixedVector<T, N> &u) { return u.norm(); }
+
+    inline friend T operator/(const NFixedVector<T, N> &u, const NFixedVector<T, N> &v) { return u.distance(v); }
+
+    inline friend bool operator==(const NFixedVector<T, N> &u, const NFixedVector<T, N> &v) { return u.isEqual(v); }
+
+    inline friend bool operator==(const NFixedVector<T, N> &u, T s) { return s < EPSILON && u.isNull(); }
+
+    inline friend bool operator==(T s, const NFixedVector<T, N> &u) { return u == s; }
+
+    inline friend bool operator!=(const NFixedVector<T, N> &u, const NFixedVector<T, N> &v) { return !(u == v); }
+
+    inline friend bool operator!=(const NFixedVector<T, N> &u, T s) { return !(u == s); }
+
+    inline friend bool operator!=(T s, const NFixedVector<T, N> &u) { return !(u == s); }
+
+    friend std::ostream &operator<<(std::ostream &os, const NFixedVector<T, N> &u) { return os << u.str(); }
+
+    inline T &operator[](size_t k) { return _data[k]; }
+
+    inline T operator[](size_t k) const { return _data[k]; }
+
+    inline T &operator()(size_t k) {
+        assert(k < N);
+        return _data[k];
+    }
+
+    inline T operator()(size_t k) const {
+        assert(k < N);
+        return _data[k];
+    }
+
+    // STATIC FUNCTIONS
+
+    inline static NFixedVector<T, N> zeros() { return NFixedVector<T, N>(); }
+
+    inline static NFixedVector<T, N> ones() { return scalar(T(1)); }
+
+    inline static NFixedVector<T, N> scalar(T s) {
+        NFixedVector<T, N> u;
+        NUnroll<N>::apply([&](size_t k) { u._data[k] = s; });
+        return u;
+    }
+
+    inline static NFixedVector<T, N> cano(size_t k) {
+        assert(k < N);
+        NFixedVector<T, N> u;
+        u._data[k] = T(1);
+        return u;
+    }
+
+protected:
+
+    T _data[N];
+};
+
+/**
+ * Real vector of dimension 2
+ */
+typedef NFixedVector<double_t, 2> vec2_t;
+/**
+ * Real vector of dimension 4
+ */
+typedef NFixedVector<double_t, 4> vec4_t;
+
+/** @} */
+
+#endif //MATHTOOLKIT_NFIXEDVECTOR_H
@@ -0,0 +1,173 @@
+//
+// Created on 17/10/2026.
+//
+
+#ifndef MATHTOOLKIT_NKRYLOV_H
+#define MATHTOOLKIT_NKRYLOV_H
+
+#include "thirdparty.h"
+#include <NLinearOperator.h>
+#include <NPreconditioner.h>
+
+/**
+ * Default relative tolerance \f$ ||b - Ax|| \leq tol \cdot ||b|| \f$ of `NKrylov`.
+ */
+#define NKRYLOV_TOLERANCE 1e-10
+
+/**
+ * Default number of iterations between two restarts of `NKrylov::gmres()`.
+ */
+#define NKRYLOV_GMRES_RESTART 30
+
+/**
+ * @ingroup NAlgebra
+ * @{
+ * @class   NKrylov
+ * @date    17/10/2026
+ * @brief   Krylov subspace iterative solvers for \f$ Ax = b \f$ : Conjugate Gradient, BiCGSTAB and GMRES.
+ *
+ * @details The matrix is only accessed through the products \f$ y = A x \f$ of a `NLinearOperator`, so that
+ *          `NPMatrix`, `NBandMatrix`, `NSparseMatrix` and matrix-free operators can be solved alike. An optional
+ *          `NPreconditioner` reduces the number of iterations, it is applied on the left for `cg()` and on the right
+ *          for `bicgstab()` and `gmres()` so that the residuals recorded are always the ones of the original system.
+ *
+ *          The work vectors are members of the solver. They are allocated on the first solve and reused by the
+ *          following ones as long as the dimension does not change, so that a solver kept across the steps of a
+ *          simulation performs no allocation.
+ *
+ *          After a solve, `iterations()` gives the number of iterations performed and `residuals()` the history of
+ *          the relative residual norms \f$ ||b - Ax_k|| / ||b|| \f$, starting with the one of the initial guess.
+ *          For `gmres()` the residuals between restarts are the estimates given by the Givens rotations.
+ *
+ *          Only instantiated for real types.
+ *
+ *          @section Definitions
+ *             - `tol`      : Relative tolerance on the residual.
+ *             - `max_iter` : Maximum number of iterations, \f$ n \f$ if `0`.
+ *             - `restart`  : Dimension of the Krylov subspaces built by GMRES before restarting.
+ */
+
+template<typename T, typename A = NAlignedAllocator<T>>
+class NKrylov {
+
+public:
+
+    // CONSTRUCTION
+
+    explicit NKrylov(T tol = T(NKRYLOV_TOLERANCE), size_t max_iter = 0, size_t restart = NKRYLOV_GMRES_RESTART);
+
+    // GETTERS
+
+    inline T tolerance() const { return _tol; }
+
+    inline size_t maxIterations() const { return _max_iter; }
+
+    inline size_t restart() const { return _restart; }
+
+    /**
+     * @brief Number of iterations performed by the last solve.
+     */
+    inline size_t iterations() const { return _iterations; }
+
+    /**
+     * @brief Relative residual norms of the iterates of the last solve.
+     */
+    inline const vector<T> &residuals() const { return _residuals; }
+
+    /**
+     * @brief `true` if the last solve reached the tolerance.
+     */
+    inline bool isConverged() const { return _converged; }
+
+    // SETTERS
+
+    inline void setTolerance(T tol) { _tol = tol; }
+
+    inline void setMaxIterations(size_t max_iter) { _max_iter = max_iter; }
+
+    inline void setRestart(size_t restart) {
+        assert(restart > 0);
+        _restart = restart;
+    }
+
+    // SOLVERS
+
+    /**
+     * @param a symmetric positive definite operator.
+     * @param b right-hand side of dimension \f$ n \f$.
+     * @param x initial guess of dimension \f$ n \f$, overwritten with the solution.
+     * @param m symmetric positive definite preconditioner, none if `nullptr`.
+     * @brief Solve \f$ Ax = b \f$ using the preconditioned Conjugate Gradient method.
+     * @return `true` if the tolerance was reached.
+     */
+    bool cg(const NLinearOperator<T, A> &a, const NVector<T, A> &b, NVector<T, A> &x,
+            const NPreconditioner<T, A> *m = nullptr);
+
+    /**
+     * @param a invertible operator.
+     * @brief Solve \f$ Ax = b \f$ using the Bi-Conjugate Gradient Stabilized method, see `cg()`.
+     * @details Requires two products per iteration and a constant memory of 8 vectors.
+     * @return `true` if the tolerance was reached.
+     */
+    bool bicgstab(const NLinearOperator<T, A> &a, const NVector<T, A> &b, NVector<T, A> &x,
+                  const NPreconditioner<T, A> *m = nullptr);
+
+    /**
+     * @param a invertible operator.
+     * @brief Solve \f$ Ax = b \f$ using the restarted Generalized Minimal Residual method, see `cg()`.
+     * @details Requires one product per iteration and a memory of `restart() + 3` vectors.
+     * @return `true` if the tolerance was reached.
+     */
+    bool gmres(const NLinearOperator<T, A> &a, const NVector<T, A> &b, NVector<T, A> &x,
+               const NPreconditioner<T, A> *m = nullptr);
+
+protected:
+
+    /**
+     * @brief Reset the statistics for the right-hand side `b` and provide `count` work vectors of its dimension.
+     * @return Maximum number of iterations of the solve.
+     */
+    size_t prepare(const NVector<T, A> &b, size_t count);
+
+    /**
+     * @brief Compute \f$ r \leftarrow b - Ax \f$ and return \f$ ||r|| \f$.
+     */
+    T residual(const NLinearOperator<T, A> &a, const NVector<T, A> &b, const NVector<T, A> &x, NVector<T, A> &r,
+               NVector<T, A> &ax) const;
+
+    /**
+     * @brief Append `r_norm` to the history and update the convergence status.
+     * @return `true` if the tolerance is reached.
+     */
+    bool record(T r_norm);
+
+    /**
+     * @brief Compute \f$ z \leftarrow M^{-1} r \f$, copy `r` if `m` is `nullptr`.
+     */
+    static void precondition(const NPreconditioner<T, A> *m, const NVector<T, A> &r, NVector<T, A> &z);
+
+    T _tol;
+
+    size_t _max_iter;
+
+    size_t _restart;
+
+    size_t _iterations{};
+
+    bool _converged{};
+
+    T _b_norm{};
+
+    vector<T> _residuals{};
+
+    vector<NVector<T, A>> _work{};
+
+    /**
+     * @brief Hessenberg matrix of GMRES stored by columns, Givens rotations and residual estimates.
+     */
+    vector<T> _h{}, _cs{}, _sn{}, _g{};
+};
+
+/** @} */
+
+#endif //MATHTOOLKIT_NKRYLOV_H
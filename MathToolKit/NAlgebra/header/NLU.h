@@ -0,0 +1,162 @@
+//
+// Created on 17/10/2026.
+//
+
+#ifndef MATHTOOLKIT_NLU_H
+#define MATHTOOLKIT_NLU_H
+
+#include "thirdparty.h"
+#include <NPMatrix.h>
+
+/**
+ * Maximum number of iterations of the condition number estimator of `NLU::rcond()`.
+ */
+#define NLU_RCOND_MAX_ITER 5
+
+/**
+ * @ingroup NAlgebra
+ * @{
+ * @class   NLU
+ * @date    17/10/2026
+ * @brief   \f$ LU \f$ factorization with partial pivoting \f$ PA = LU \f$ of a square matrix.
+ *
+ * @details The matrix is factorized once at construction using `NBlas::getrf()`, the factors are then immutable.
+ *          Copies of a `NLU` share the same factors, so that a factorization can be passed by value, stored in
+ *          containers and used concurrently from several threads without being copied nor recomputed. The const
+ *          methods never call `NPMatrix` getters on the shared factors since they reset its browse indices.
+ *
+ *          `NPMatrix` caches its factorization as a `NLU`, copying a matrix shares the factors of the source, see
+ *          `NPMatrix::lu()`.
+ *
+ *          If a pivot lower than `EPSILON` is encountered, the matrix is considered singular. In this case only
+ *          `isSingular()`, `det()` and `rcond()` are meaningful, they return `true`, `0` and `0`.
+ *          `solve()` then leaves its argument unchanged.
+ *
+ *          @section Definitions
+ *             - `n`    : Order of the factorized matrix \f$ A \f$.
+ *             - `perm` : Permutation \f$ P \f$, row `i` of \f$ PA \f$ is row `perm[i]` of \f$ A \f$.
+ */
+
+template<typename T, typename A = NAlignedAllocator<T>>
+class NLU {
+
+public:
+
+    // CONSTRUCTION
+
+    /**
+     * @param m square matrix to factorize, its browse indices select the block to factorize.
+     */
+    explicit NLU(const NPMatrix<T, A> &m);
+
+    /**
+     * @param m view on a square block to factorize.
+     */
+    explicit NLU(const NMatrixView<const T> &m);
+
+    // GETTERS
+
+    inline size_t n() const { return _n; }
+
+    inline bool isSingular() const { return _singular; }
+
+    /**
+     * @brief Matrix storing \f$ L \f$ in its strict lower part and \f$ U \f$ in its upper part.
+     */
+    inline const NPMatrix<T, A> &factors() const { return *_lu; }
+
+    /**
+     * @brief Permutation \f$ P \f$ of size \f$ n + 1 \f$, `perm()[n] - n` is the number of row swaps.
+     */
+    inline const vector<size_t> &perm() const { return *_perm; }
+
+    /**
+     * @brief Unit lower triangular factor \f$ L \f$.
+     */
+    NPMatrix<T, A> L() const;
+
+    /**
+     * @brief Upper triangular factor \f$ U \f$.
+     */
+    NPMatrix<T, A> U() const;
+
+    // ALGEBRA
+
+    /**
+     * @brief Determinant of \f$ A \f$ computed in \f$ O(n) \f$.
+     */
+    T det() const;
+
+    /**
+     * @brief Estimation of the reciprocal condition number \f$ 1 / (||A||_1 ||A^{-1}||_1) \f$.
+     * @details \f$ ||A^{-1}||_1 \f$ is estimated using Hager's algorithm as refined by Higham, it requires a few
+     * solves in \f$ O(n^2) \f$. The result is close to `0` for an ill-conditioned matrix and `1` for an orthogonal
+     * one. Only meaningful for floating point types.
+     */
+    T rcond() const;
+
+    /**
+     * @brief Inverse \f$ A^{-1} \f$.
+     */
+    NPMatrix<T, A> inv() const;
+
+    /**
+     * @param u right-hand side of dimension \f$ n \f$, overwritten with the solution.
+     * @brief Solve \f$ Ax = u \f$.
+     * @return Reference to `u`.
+     */
+    NVector<T, A> &solve(NVector<T, A> &u) const;
+
+    /**
+     * @param b right-hand sides, overwritten with the solutions.
+     * @brief Solve \f$ AX = B \f$ for all the columns of `b` at once.
+     * @details Browse indices of `b` select the right-hand sides, see `NBlas::getrs()`.
+     * @return Reference to `b`.
+     */
+    NPMatrix<T, A> &solve(NPMatrix<T, A> &b) const;
+
+    /**
+     * @param u right-hand side of dimension \f$ n \f$, overwritten with the solution.
+     * @brief Solve \f$ A^T x = u \f$ with the factors of \f$ A \f$, without transposing them.
+     * @return Reference to `u`.
+     */
+    NVector<T, A> &transSolve(NVector<T, A> &u) const;
+
+    /**
+     * @param b right-hand sides, overwritten with the solutions.
+     * @brief Solve \f$ A^T X = B \f$ for all the columns of `b` at once, see `NBlas::getrsT()`.
+     * @return Reference to `b`.
+     */
+    NPMatrix<T, A> &transSolve(NPMatrix<T, A> &b) const;
+
+protected:
+
+    void factorize(const NMatrixView<const T> &m);
+
+    /**
+     * @brief Solve \f$ Ax = b \f$ where `b` and `x` are distinct arrays of size \f$ n \f$.
+     */
+    void solve(const T *b, T *x) const;
+
+    /**
+     * @brief Solve \f$ A^T x = b \f$ in place using \f$ A^T = U^T L^T P \f$.
+     */
+    void transSolve(T *x) const;
+
+    shared_ptr<const NPMatrix<T, A>> _lu{};
+
+    shared_ptr<const vector<size_t>> _perm{};
+
+    size_t _n{};
+
+    /**
+     * @brief \f$ ||A||_1 \f$, maximum absolute column sum of the factorized matrix.
+     */
+    T _norm{};
+
+    bool _singular{};
+};
+
+/** @} */
+
+#endif //MATHTOOLKIT_NLU_H
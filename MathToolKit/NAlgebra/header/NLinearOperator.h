@@ -0,0 +1,73 @@
+//
+// Created on 17/10/2026.
+//
+
+#ifndef MATHTOOLKIT_NLINEAROPERATOR_H
+#define MATHTOOLKIT_NLINEAROPERATOR_H
+
+#include "thirdparty.h"
+#include <NVector.h>
+
+/**
+ * @ingroup NAlgebra
+ * @{
+ * @class   NLinearOperator
+ * @date    17/10/2026
+ * @brief   Square linear operator \f$ A \f$ of \f$ \mathbb{K}^n \f$ known only through the product \f$ y = A x \f$.
+ *
+ * @details Iterative solvers of `NKrylov` never access the coefficients of the matrix, so they take this operator
+ *          instead. It is implicitly constructed from any matrix type providing `n()` and
+ *          `product(const NVector &x, NVector &y)`, such as `NPMatrix`, `NBandMatrix` and `NSparseMatrix`, or from
+ *          a function for matrix-free problems.
+ *
+ *          The operator refers to the matrix it is built from without copying it, the matrix must outlive the
+ *          operator.
+ *
+ *          @section Definitions
+ *             - `Product` : Function computing \f$ y \leftarrow A x \f$, `y` having dimension \f$ n \f$.
+ */
+
+template<typename T, typename A = NAlignedAllocator<T>>
+class NLinearOperator {
+
+public:
+
+    typedef std::function<void(const NVector<T, A> &, NVector<T, A> &)> Product;
+
+    // CONSTRUCTION
+
+    /**
+     * @param n dimension of the space.
+     * @param product function computing \f$ y \leftarrow A x \f$.
+     */
+    NLinearOperator(size_t n, Product product) : _n(n), _product(std::move(product)) {}
+
+    /**
+     * @param m square matrix providing `n()` and `product()`, referenced by the operator.
+     */
+    template<typename M, typename = typename std::enable_if<!std::is_same<M, NLinearOperator<T, A>>::value>::type>
+    NLinearOperator(const M &m) :
+            _n(m.n()),
+            _product([&m](const NVector<T, A> &x, NVector<T, A> &y) { m.product(x, y); }) {}
+
+    // GETTERS
+
+    inline size_t n() const { return _n; }
+
+    // OPERATORS
+
+    /**
+     * @brief Compute \f$ y \leftarrow A x \f$.
+     */
+    inline void operator()(const NVector<T, A> &x, NVector<T, A> &y) const { _product(x, y); }
+
+protected:
+
+    size_t _n;
+
+    Product _product;
+};
+
+/** @} */
+
+#endif //MATHTOOLKIT_NLINEAROPERATOR_H
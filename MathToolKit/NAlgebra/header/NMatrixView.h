@@ -0,0 +1,332 @@
+#ifndef MATHTOOLKIT_NMATRIXVIEW_H
+#define MATHTOOLKIT_NMATRIXVIEW_H
+
+#include "thirdparty.h"
+#include <NVectorView.h>
+#include <NBlas.h>
+
+/**
+ * @ingroup NAlgebra
+ * @{
+ * @class   NMatrixView
+ * @date    17/10/2026
+ * @brief   Non-owning view on a block of a row-major matrix.
+ *
+ * @details A view is a pointer to the first component \f$ A_{00} \f$, a number of rows \f$ n \f$, a number of columns
+ *          \f$ p \f$ and a leading dimension `ld` which is the distance between two consecutive rows in memory.
+ *          Any block of a `NPMatrix` can be seen as a view, see `NPMatrix::view()`.
+ *
+ *          Unlike sub-matrices selected using browse indices, views do not modify the state of the viewed matrix.
+ *          Operations are performed in place on the viewed block and never allocate, except `det()` and `solve()`
+ *          which factorize a private copy of the block.
+ *
+ *          A `NMatrixView<const T>` is a read-only view. Read-only views can be used concurrently by several threads.
+ *          A `NMatrixView<T>` converts implicitly to `NMatrixView<const T>`.
+ *
+ *          @section Definitions
+ *             - `n`, `p` : Number of rows and columns of the view.
+ *             - `ld` : Leading dimension of the view \f$ ld \geq p \f$.
+ */
+
+template<typename T>
+class NMatrixView {
+
+public:
+
+    typedef typename std::remove_const<T>::type scalar_t;
+
+    /**
+     * @param data pointer to \f$ A_{00} \f$.
+     * @param n number of rows.
+     * @param p number of columns.
+     * @param ld leading dimension, `0` is interpreted as `p`.
+     * @brief Construct a view on raw memory.
+     */
+    explicit NMatrixView(T *data = nullptr, size_t n = 0, size_t p = 0, size_t ld = 0) :
+            _data(data), _n(n), _p(p), _ld(ld > 0 ? ld : p) {}
+
+    /**
+     * @brief Construct a read-only view from a mutable view.
+     */
+    template<typename U, typename = typename std::enable_if<std::is_convertible<U *, T *>::value>::type>
+    NMatrixView(const NMatrixView<U> &m) : _data(m.data()), _n(m.n()), _p(m.p()), _ld(m.ld()) {}
+
+    // GETTERS
+
+    inline T *data() const { return _data; }
+
+    inline size_t n() const { return _n; }
+
+    inline size_t p() const { return _p; }
+
+    inline size_t ld() const { return _ld; }
+
+    inline bool isSquare() const { return _n == _p; }
+
+    inline bool isContiguous() const { return _ld == _p; }
+
+    /**
+     * @brief `true` if the view is square and \f$ |A_{ij} - A_{ji}| \leq \epsilon (|A_{ij}| + |A_{ji}|) \f$ for all
+     * \f$ i, j \f$, where \f$ \epsilon \f$ is the machine epsilon of `T`.
+     */
+    bool isSymmetric() const {
+        if (!isSquare()) {
+            return false;
+        }
+
+        const scalar_t eps = std::numeric_limits<scalar_t>::epsilon();
+        for (size_t i = 1; i < _n; ++i) {
+            for (size_t j = 0; j < i; ++j) {
+                const scalar_t &x = _data[i * _ld + j], &y = _data[j * _ld + i];
+                if (abs(x - y) > eps * (abs(x) + abs(y))) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    // ACCESS
+
+    /**
+     * @brief Access to component \f$ A_{ij} \f$.
+     */
+    inline T &operator()(size_t i, size_t j) const {
+        assert(i < _n && j < _p);
+        return _data[i * _ld + j];
+    }
+
+    /**
+     * @brief View on the block \f$ (A_{ij})_{i_1 \leq i \leq i_2, j_1 \leq j \leq j_2} \f$.
+     */
+    inline NMatrixView<T> operator()(size_t i1, size_t j1, size_t i2, size_t j2) const {
+        assert(i1 <= i2 && i2 < _n && j1 <= j2 && j2 < _p);
+        return NMatrixView<T>(_data + i1 * _ld + j1, i2 - i1 + 1, j2 - j1 + 1, _ld);
+    }
+
+    /**
+     * @brief View on the row \f$ R_i \f$.
+     */
+    inline NVectorView<T> row(size_t i) const {
+        assert(i < _n);
+        return NVectorView<T>(_data + i * _ld, _p, 1);
+    }
+
+    /**
+     * @brief View on the column \f$ C_j \f$.
+     */
+    inline NVectorView<T> col(size_t j) const {
+        assert(j < _p);
+        return NVectorView<T>(_data + j, _n, _ld);
+    }
+
+    // ALGEBRA
+
+    /**
+     * @name Algebra
+     * @brief In place operations on the viewed block.
+     * @details Only available on mutable views. Operands must have the same size and must not overlap the viewed
+     * block unless they are equal to it.
+     * @{
+     */
+
+    inline NMatrixView<T> &operator+=(const NMatrixView<const scalar_t> &m) {
+        return forEach(m, [](scalar_t &x, const scalar_t &y) { x += y; });
+    }
+
+    inline NMatrixView<T> &operator-=(const NMatrixView<const scalar_t> &m) {
+        return forEach(m, [](scalar_t &x, const scalar_t &y) { x -= y; });
+    }
+
+    inline NMatrixView<T> &operator*=(scalar_t s) { return forEach([s](scalar_t &x) { x *= s; }); }
+
+    inline NMatrixView<T> &operator/=(scalar_t s) { return forEach([s](scalar_t &x) { x /= s; }); }
+
+    inline NMatrixView<T> &fill(scalar_t s) { return forEach([s](scalar_t &x) { x = s; }); }
+
+    /**
+     * @brief Copy the components of `m` into the viewed block.
+     */
+    inline NMatrixView<T> &assign(const NMatrixView<const scalar_t> &m) {
+        return forEach(m, [](scalar_t &x, const scalar_t &y) { x = y; });
+    }
+
+    /**
+     * @param a left operand \f$ n \times q \f$.
+     * @param b right operand \f$ q \times p \f$.
+     * @param alpha scalar multiplying the product.
+     * @brief Accumulate a matrix product \f$ A \leftarrow A + \alpha M_a M_b \f$ using `NBlas::gemm()`.
+     * @details The viewed block must not overlap `a` nor `b`.
+     */
+    NMatrixView<T> &addProduct(const NMatrixView<const scalar_t> &a, const NMatrixView<const scalar_t> &b,
+                               scalar_t alpha = scalar_t(1)) {
+        assert(a.n() == _n && b.p() == _p && a.p() == b.n());
+
+        NBlas<scalar_t>::gemm(_n, _p, a.p(), alpha, a.data(), a.ld(), b.data(), b.ld(), _data, _ld);
+        return *this;
+    }
+
+    /**
+     * @brief Transpose a square block in place using `NBlas::transpose()`.
+     */
+    NMatrixView<T> &trans() {
+        assert(isSquare());
+
+        NBlas<scalar_t>::transpose(_n, _data, _ld);
+        return *this;
+    }
+
+    /** @} */
+
+    /**
+     * @param x vector of dimension \f$ p \f$.
+     * @param y vector of dimension \f$ n \f$, receives the result.
+     * @brief Matrix vector product \f$ y \leftarrow A x \f$.
+     * @details `y` must not overlap `x` nor the viewed block.
+     */
+    void prod(const NVectorView<const scalar_t> &x, NVectorView<scalar_t> y) const {
+        assert(x.dim() == _p && y.dim() == _n);
+
+        if (x.isContiguous() && y.isContiguous()) {
+            NBlas<scalar_t>::gemv(_n, _p, _data, _ld, x.data(), y.data());
+            return;
+        }
+        for (size_t i = 0; i < _n; ++i) {
+            y(i) = row(i).dot(x);
+        }
+    }
+
+    /**
+     * @param x vector of dimension \f$ n \f$.
+     * @param y vector of dimension \f$ p \f$, receives the result.
+     * @brief Transposed matrix vector product \f$ y \leftarrow A^T x \f$.
+     * @details `y` must not overlap `x` nor the viewed block.
+     */
+    void transProd(const NVectorView<const scalar_t> &x, NVectorView<scalar_t> y) const {
+        assert(x.dim() == _n && y.dim() == _p);
+
+        if (x.isContiguous() && y.isContiguous()) {
+            NBlas<scalar_t>::gemvT(_n, _p, _data, _ld, x.data(), y.data());
+            return;
+        }
+        for (size_t j = 0; j < _p; ++j) {
+            y(j) = col(j).dot(x);
+        }
+    }
+
+    /**
+     * @brief Trace of the viewed block \f$ A_{00} + A_{11} + ... \f$.
+     */
+    scalar_t trace() const {
+        scalar_t trace = 0;
+        for (size_t i = 0; i < std::min(_n, _p); ++i) {
+            trace += _data[i * _ld + i];
+        }
+        return trace;
+    }
+
+    /**
+     * @brief Determinant of the viewed block using \f$ LU \f$ factorization of a copy.
+     * @return `0` if the block is singular.
+     */
+    scalar_t det() const {
+        assert(isSquare());
+
+        std::vector<scalar_t> lu;
+        std::vector<size_t> perm;
+        if (!factorize(lu, perm)) {
+            return scalar_t(0);
+        }
+
+        scalar_t det = ((perm[_n] - _n) % 2 == 0) ? scalar_t(1) : scalar_t(-1);
+        for (size_t i = 0; i < _n; ++i) {
+            det *= lu[i * _n + i];
+        }
+        return det;
+    }
+
+    /**
+     * @param u second member of the system, overwritten with the solution.
+     * @brief Solve the linear system \f$ A x = u \f$ in place using \f$ LU \f$ factorization of a copy.
+     * @return `false` if the block is singular. In this case `u` is not modified.
+     */
+    bool solve(NVectorView<scalar_t> u) const {
+        assert(isSquare() && u.dim() == _n);
+
+        std::vector<scalar_t> lu;
+        std::vector<size_t> perm;
+        if (!factorize(lu, perm)) {
+            return false;
+        }
+
+        std::vector<scalar_t> x(_n);
+        for (size_t i = 0; i < _n; ++i) {
+            x[i] = u(perm[i]);
+        }
+        for (size_t i = 0; i < _n; ++i) {
+            for (size_t k = 0; k < i; ++k) {
+                x[i] -= lu[i * _n + k] * x[k];
+            }
+        }
+        for (size_t i = _n; i-- > 0;) {
+            for (size_t k = i + 1; k < _n; ++k) {
+                x[i] -= lu[i * _n + k] * x[k];
+            }
+            x[i] /= lu[i * _n + i];
+        }
+        for (size_t i = 0; i < _n; ++i) {
+            u(i) = x[i];
+        }
+        return true;
+    }
+
+protected:
+
+    bool factorize(std::vector<scalar_t> &lu, std::vector<size_t> &perm) const {
+        lu.resize(_n * _n);
+        perm.resize(_n + 1);
+        for (size_t i = 0; i < _n; ++i) {
+            std::copy(_data + i * _ld, _data + i * _ld + _n, lu.begin() + i * _n);
+            perm[i] = i;
+        }
+        perm[_n] = _n;
+        return NBlas<scalar_t>::getrf(_n, lu.data(), _n, perm.data());
+    }
+
+    template<typename BinaryOp>
+    NMatrixView<T> &forEach(const NMatrixView<const scalar_t> &m, BinaryOp binary_op) {
+        assert(_n == m.n() && _p == m.p());
+
+        for (size_t i = 0; i < _n; ++i) {
+            scalar_t *x = _data + i * _ld;
+            const scalar_t *y = m.data() + i * m.ld();
+            for (size_t j = 0; j < _p; ++j) {
+                binary_op(x[j], y[j]);
+            }
+        }
+        return *this;
+    }
+
+    template<typename UnaryOp>
+    NMatrixView<T> &forEach(UnaryOp unary_op) {
+        for (size_t i = 0; i < _n; ++i) {
+            scalar_t *x = _data + i * _ld;
+            for (size_t j = 0; j < _p; ++j) {
+                unary_op(x[j]);
+            }
+        }
+        return *this;
+    }
+
+    T *_data;
+
+    size_t _n;
+
+    size_t _p;
+
+    size_t _ld;
+};
+
+/** @} */
+
+#endif //MATHTOOLKIT_NMATRIXVIEW_H
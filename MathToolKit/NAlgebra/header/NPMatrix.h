@@ -3,6 +3,7 @@
 
 #include "thirdparty.h"
 #include <NVector.h>
+#include <NMatrixView.h>
 
 /**
  * @ingroup NAlgebra
@@ -14,8 +15,8 @@
  * @brief   Representation of dense matrices of arbitrary size in a template field `T`.
  *
  * @details The matrix components are stored in a linear form using the index transformation \f$ k = p i + j \f$.
- *          The underlying `std::vector<T>` is represented as `t[p * i + j]`.
- *          The underlying `NVector<T>` is \f$ (A_{00}, A_{01}, ..., A_{0(P - 1)}, A_{10}, ..., A_{1(P - 1)}, ..., A_{(N-1)0}, ...) \f$.
+ *          The underlying `std::vector<T, A>` is represented as `t[p * i + j]`.
+ *          The underlying `NVector<T, A>` is \f$ (A_{00}, A_{01}, ..., A_{0(P - 1)}, A_{10}, ..., A_{1(P - 1)}, ..., A_{(N-1)0}, ...) \f$.
  *
  *          @section Features
  *
@@ -26,11 +27,54 @@
  *
  *          The \f$ LU \f$ decomposition is stored as a property if the matrix is inversible. It is auto-updated only when needed.
  *          It allow to compute inverse, determinant and other inversion related operations more efficiently.
+ *          The decomposition is held as a `NLU` shared by the copies of the matrix, copying a matrix never copies its
+ *          factors. Use `lu()` to factorize once and reuse the factors independently of the matrix.
+ *
+ *          The Cholesky decomposition \f$ LL^T \f$ of `NCholesky` costs half the operations of \f$ LU \f$ but is only
+ *          used on demand : once `llt()` has factorized a symmetric positive definite matrix, `det()`, `solve()`,
+ *          `inv()` and `%` use these factors instead of \f$ LU \f$ until the matrix is modified.
+ *
+ *          @subsection QRDecomp QR Decomposition
+ *
+ *          Rectangular matrices with more rows than columns are factorized by `qr()` into a `NQR`, which gives the
+ *          least squares solutions of overdetermined systems, see `leastSquares()`.
+ *
+ *          @subsection EigenDecomp Eigen Decomposition
+ *
+ *          The eigenvalues and eigenvectors of symmetric real matrices are computed by `NEigen`, either for the whole
+ *          spectrum or for a few eigenpairs at one of its ends.
+ *
+ *          @subsection SVDDecomp Singular Value Decomposition
+ *
+ *          The singular value decomposition of real matrices is computed by `NSVD`, either in full by the Jacobi
+ *          algorithm or truncated to a given rank by a randomized algorithm.
+ *
+ *          @subsection TransMat Transposition
+ *
+ *          `trans()` transposes the matrix in place, while `transposed()` returns a lazy `NTransposed` view whose
+ *          products and solves read the matrix in place, so that \f$ A^T B \f$ never forms \f$ A^T \f$.
+ *
+ *          @subsection PowMat Powers and exponential
+ *
+ *          `operator^=()` raises the matrix to an integer power by binary exponentiation : the successive squares and
+ *          the partial product ping-pong between work buffers allocated once in the `NArena`, so that \f$ A^k \f$ costs
+ *          at most \f$ 2 log_2(k) \f$ products and no allocation per step.
+ *
+ *          `expm()` computes the exponential \f$ e^A \f$ by scaling and squaring with the Padé approximants of
+ *          Higham, reusing the same squaring buffers.
  *
  *          @subsection FuncOp Sub-range operators
  *
  *          The `NPMatrix` class provides a function operator similar to @ref FuncOpVec
  *
+ *          @subsection AllocMat Storage allocator
+ *
+ *          The storage is allocated using the allocator `A` of the underlying vector, see @ref AllocVec.
+ *
+ *          The temporaries of in place operations such as products, powers and copies of sub-matrices are allocated
+ *          in the `NArena` of the calling thread instead of the heap. In particular `operator*=()` allocates nothing
+ *          once the arena has grown to the size of the product.
+ *
  *          @section Definitions
  *
  *          All along this page we will use the following definitions :
@@ -48,9 +92,38 @@
 
 using namespace std;
 
+template<typename T, typename A>
+class NLU;
+
+template<typename T, typename A>
+class NCholesky;
+
+template<typename T, typename A>
+class NQR;
+
+template<typename T, typename A>
+class NEigen;
+
+template<typename T, typename A>
+class NSVD;
+
+template<typename T, typename A>
+class NTransposed;
+
+template<typename T, typename A = NAlignedAllocator<T>>
+class NPMatrix : public NVector<T, A> {
 
-template<typename T>
-class NPMatrix : public NVector<T> {
+    template<typename, typename> friend class NLU;
+
+    template<typename, typename> friend class NCholesky;
+
+    template<typename, typename> friend class NQR;
+
+    template<typename, typename> friend class NEigen;
+
+    template<typename, typename> friend class NSVD;
+
+    template<typename, typename> friend class NTransposed;
 
     enum Parts {
         Row, Col
@@ -63,7 +136,9 @@ public:
      *
      * @brief Construct a \f$ n \times p \f$ matrix initialized with `NVector(size_t dim)` constructor.
      */
-    explicit NPMatrix(size_t n = 0, size_t p = 0) : NPMatrix(NVector<T>(n * pIfNotNull(n, p)), n, pIfNotNull(n, p)) {}
+    explicit NPMatrix(size_t n = 0, size_t p = 0) : NVector<T, A>(n * pIfNotNull(n, p)), _n(n), _p(pIfNotNull(n, p)) {
+        setDefaultBrowseIndices();
+    }
 
     /**
      * @param data bi-dimensional `std::vector` source.
@@ -72,7 +147,7 @@ public:
      * is copied into `this` matrix using `copy()`.
      */
 
-    NPMatrix(const vector<vector<T> > &data) : NPMatrix(NVector<T>(data.size() * data[0].size()), data.size(),
+    NPMatrix(const vector<vector<T> > &data) : NPMatrix(NVector<T, A>(data.size() * data[0].size()), data.size(),
                                                         data[0].size()) {
         copy(data);
     };
@@ -82,7 +157,7 @@ public:
      * @param m `NPMatrix` source.
      * @brief Construct a matrix by using `copy()` method.
      */
-    NPMatrix(const NPMatrix<T> &m) : NPMatrix(NVector<T>(0), 0, 0) {
+    NPMatrix(const NPMatrix<T, A> &m) : NPMatrix(NVector<T, A>(0), 0, 0) {
         copy(m);
     };
 
@@ -100,17 +175,33 @@ public:
      * @details The matrix is of size \f$ n \times p =  q \f$ with \f$ p = q / n \f$. Resulting `p` is computed
      * using integer division so if reminder is not null a part of `u` will be truncated.
      */
-    explicit NPMatrix(const NVector<T> &u, size_t n = 1) : NPMatrix(u, n, u.dim() / n) {}
+    explicit NPMatrix(const NVector<T, A> &u, size_t n = 1) : NPMatrix(u, n, u.dim() / n) {}
 
     /**
      * @param vectors bi-dimensional `std::vector` source.
-     * @brief Construct a \f$ n \times p \f$ matrix using a `vector<NVector<T>>`.`
+     * @brief Construct a \f$ n \times p \f$ matrix using a `vector<NVector<T, A>>`.`
      * All the vectors must have the same dimension.
-     * @details Convert `vectors` and uses @ref NPMatrix(const vector<vector<T> > &data) "bi-dimensional array constructor".
+     * @details The rows are copied using `setRows()`.
      */
 
-    explicit NPMatrix(const vector<NVector<T> > &vectors) : NPMatrix(
-            vector<vector<T>>(vectors.begin(), vectors.end())) {}
+    explicit NPMatrix(const vector<NVector<T, A> > &vectors) : NPMatrix(vectors.size(), vectors[0].dim()) {
+        setRows(vectors);
+    }
+
+    /**
+     * @param m `NMatrixView` source.
+     * @brief Construct a \f$ n \times p \f$ matrix by copying the components of a view.
+     */
+    explicit NPMatrix(const NMatrixView<const T> &m) : NPMatrix(m.n(), m.p()) { view().assign(m); }
+
+    explicit NPMatrix(const NMatrixView<T> &m) : NPMatrix(NMatrixView<const T>(m)) {}
+
+    /**
+     * @param e `NExpr` source.
+     * @brief Construct a matrix by evaluating an expression.
+     */
+    template<typename E>
+    NPMatrix(const NExpr<NPMatrix<T, A>, E> &e) : NPMatrix(e.n(), e.p()) { e.assignTo(view()); }
 
     ~NPMatrix() { lupClear(); }
 
@@ -136,20 +227,20 @@ public:
 
     vector<vector<T>> array() const;
 
-    inline NPMatrix<T>& resizeRow(size_t n) {
-        std::vector<T>::resize(n * _p);
+    inline NPMatrix<T, A>& resizeRow(size_t n) {
+        std::vector<T, A>::resize(n * _p);
         _n = n;
         return clean();
     }
 
-    inline NPMatrix<T>& resizeCol(size_t p) {
-        NPMatrix<T> temp{_n , p};
+    inline NPMatrix<T, A>& resizeCol(size_t p) {
+        NPMatrix<T, A> temp{_n , p};
         temp(0, 0, _n - 1 , (_p < p ? _p : p) - 1) = (*this)(0, 0, _n - 1, (_p < p ? _p : p) - 1);
         *this = temp;
         return *this;
     }
 
-    inline NPMatrix<T>& resize(size_t n, size_t p) {
+    inline NPMatrix<T, A>& resize(size_t n, size_t p) {
         resizeCol(p);
         resizeRow(n);
         return *this;
@@ -169,6 +260,8 @@ public:
 
     bool isDiagonal() const;
 
+    bool isSymmetric() const;
+
     // GETTERS
 
     /**
@@ -198,15 +291,15 @@ public:
 
     /**
      *
-     * @brief \f$ i^{th} \f$ row of the matrix as a `NVector<T>`.
+     * @brief \f$ i^{th} \f$ row of the matrix as a `NVector<T, A>`.
      */
-    NVector<T> row(size_t i) const;
+    NVector<T, A> row(size_t i) const;
 
     /**
      *
-     * @brief \f$ j^{th} \f$ column the matrix as a `NVector<T>`.
+     * @brief \f$ j^{th} \f$ column the matrix as a `NVector<T, A>`.
      */
-    NVector<T> col(size_t j) const;
+    NVector<T, A> col(size_t j) const;
 
     /**
      *
@@ -221,43 +314,131 @@ public:
      *
      * @return Returns an array containing the rows of the matrix as `NVector`.
      */
-    vector<NVector<T> > rows(size_t i1 = 0, size_t i2 = MAX_SIZE) const;
+    vector<NVector<T, A> > rows(size_t i1 = 0, size_t i2 = MAX_SIZE) const;
 
     /**
      *
      * @param j1 First column to be taken.
      * @param j2 Last column to be taken \f$ j_1 \leq j_2 \f$.
-     * @brief Create an array containing the columns of the matrix in the form of `std::vector<NVector<T>>`.
+     * @brief Create an array containing the columns of the matrix in the form of `std::vector<NVector<T, A>>`.
      *
      * @details The behavior of `cols()` is the analog to `rows()`.
      *
      * @return Returns an array containing the column of the matrix as `NVector`.
      */
-    vector<NVector<T> > cols(size_t j1 = 0, size_t j2 = MAX_SIZE) const;
+    vector<NVector<T, A> > cols(size_t j1 = 0, size_t j2 = MAX_SIZE) const;
 
     /**
      * @brief Create a new matrix containing upper part of this matrix.
      * @return Returns upper part of this matrix. The lower part contains `0`.
      */
-    NPMatrix<T> upper() const;
+    NPMatrix<T, A> upper() const;
 
     /**
      * @brief Create a new matrix containing lower part of this matrix.
      * @return Returns lower part of this matrix. The upper part contains `0`.
      */
-    NPMatrix<T> lower() const;
+    NPMatrix<T, A> lower() const;
 
     /**
      *
      * @brief \f$ L \f$ matrix of \f$ LU \f$ decomposition of the matrix.
      */
-    NPMatrix<T> lupL() const;
+    NPMatrix<T, A> lupL() const;
 
     /**
      *
      * @brief \f$ U \f$ matrix of \f$ LU \f$ decomposition of the matrix.
      */
-    NPMatrix<T> lupU() const;
+    NPMatrix<T, A> lupU() const;
+
+    /**
+     *
+     * @brief \f$ LU \f$ decomposition of the matrix.
+     * @details The returned `NLU` shares the factors cached by the matrix, it stays valid after the matrix is
+     * modified or destroyed. Requires to include `NLU.h`.
+     */
+    NLU<T, A> lu() const;
+
+    /**
+     *
+     * @brief Cholesky decomposition \f$ LL^T \f$ of the matrix, which is assumed symmetric.
+     * @details If the whole matrix is positive definite, the factorization is cached and used by `det()`,
+     * `solve()` and `inv()` instead of \f$ LU \f$. Else it is returned without being cached, check
+     * `NCholesky::isPositiveDefinite()` before using it. Requires to include `NCholesky.h`.
+     */
+    NCholesky<T, A> llt() const;
+
+    /**
+     *
+     * @brief Householder \f$ QR \f$ decomposition of the matrix, which must have at least as many rows as columns.
+     * @details The factorization is not cached. Only defined for floating point types. Requires to include `NQR.h`.
+     */
+    template<typename U = T>
+    NQR<U, A> qr() const;
+
+    /**
+     *
+     * @param u right-hand side \f$ b \f$ of dimension \f$ n \f$, replaced by the solution of dimension \f$ p \f$.
+     * @brief Least squares solution \f$ x \f$ minimizing \f$ ||Ax - b|| \f$ using the \f$ QR \f$ decomposition.
+     * @details Use it instead of solving the normal equations \f$ A^T A x = A^T b \f$, whose condition number is
+     * the square of the one of \f$ A \f$. The matrix must have full rank, see `NQR`. Only defined for floating point
+     * types. Requires to include `NQR.h`.
+     * @return Reference to `u`.
+     */
+    template<typename U = T>
+    NVector<U, A> &leastSquares(NVector<U, A> &u) const;
+
+    /** @} */
+
+    /**
+     * @name Views
+     * @brief Non-owning views on blocks of the matrix.
+     * @details Views ignore and never modify browse indices so read-only views can be shared between threads.
+     * For example `a.view(0, 0, 1, 1)` is a view on the \f$ 2 \times 2 \f$ upper-left block. See `NMatrixView` for
+     * more details.
+     *
+     * Mutable views clear the \f$ LU \f$ decomposition of the matrix when they are created, modifying the matrix
+     * through a view after calling `det()` or `%` requires to create a new view.
+     * @{
+     */
+
+    inline NMatrixView<T> view() {
+        lupClear();
+        return NMatrixView<T>(this->data(), _n, _p, _p);
+    }
+
+    inline NMatrixView<const T> view() const { return NMatrixView<const T>(this->data(), _n, _p, _p); }
+
+    inline NMatrixView<T> view(size_t i1, size_t j1, size_t i2, size_t j2) {
+        assert(i1 <= i2 && j1 <= j2 && isValidIndex(i2, j2));
+        lupClear();
+        return NMatrixView<T>(this->data() + vectorIndex(i1, j1), i2 - i1 + 1, j2 - j1 + 1, _p);
+    }
+
+    inline NMatrixView<const T> view(size_t i1, size_t j1, size_t i2, size_t j2) const {
+        assert(i1 <= i2 && j1 <= j2 && isValidIndex(i2, j2));
+        return NMatrixView<const T>(this->data() + vectorIndex(i1, j1), i2 - i1 + 1, j2 - j1 + 1, _p);
+    }
+
+    /**
+     * @brief Leaf of expression on the block selected by browse indices, see `NExpr`.
+     * @details Browse indices are reset.
+     */
+    inline NExpr<NPMatrix<T, A>, NLeafExpr<T>> expr() const {
+        NLeafExpr<T> leaf{this->empty() ? NMatrixView<const T>() :
+                          NMatrixView<const T>(this->data() + vectorIndex(_i1, _j1), _i2 - _i1 + 1, _j2 - _j1 + 1, _p)};
+        setDefaultBrowseIndices();
+        return {leaf};
+    }
+
+    inline NVectorView<T> rowView(size_t i) { return view(i, 0, i, _p - 1).row(0); }
+
+    inline NVectorView<const T> rowView(size_t i) const { return view(i, 0, i, _p - 1).row(0); }
+
+    inline NVectorView<T> colView(size_t j) { return view(0, j, _n - 1, j).col(0); }
+
+    inline NVectorView<const T> colView(size_t j) const { return view(0, j, _n - 1, j).col(0); }
 
     /** @} */
 
@@ -278,7 +459,7 @@ public:
      * @brief Set row with given vector.
      * @details The dimension of the vector must be inferior or equal to the number of columns.
      */
-    NPMatrix<T> &setRow(const NVector<T> &u, size_t i1);
+    NPMatrix<T, A> &setRow(const NVector<T, A> &u, size_t i1);
 
     /**
      * @param u source `NVector`.
@@ -286,21 +467,21 @@ public:
      * @brief Set column with given vector.
      * @details Same behavior as `setRow()`.
      */
-    NPMatrix<T> &setCol(const NVector<T> &u, size_t j1);
+    NPMatrix<T, A> &setCol(const NVector<T, A> &u, size_t j1);
 
     /**
      *
-     * @param vectors   Rows to set on the matrix. `std::vector` of `NVector<T>`.
+     * @param vectors   Rows to set on the matrix. `std::vector` of `NVector<T, A>`.
      *
      * @param i1        First row to set.
      * @brief           Replace the components of the matrix with the array of vectors.
      *
      * @details         The input `vectors` must verify the following conditions :
-     *                  - The length of each `NVector<T>` must be inferior or equal to the number of columns.
+     *                  - The length of each `NVector<T, A>` must be inferior or equal to the number of columns.
      *                  - The total size of vectors must be inferior or equal to the number of rows.
      *
      *                  If `i1 + vectors.size()` is greater than `n` Then the algorithm truncate the
-     *                  array of `NVector<T>`.
+     *                  array of `NVector<T, A>`.
      *
      *                  If the size of `vectors` is \f$ n \times q \f$ than the `setRows(vectors)` will return :
      *
@@ -316,18 +497,18 @@ public:
      *                  \f]
      *                  Where \f$ v_{ij} \f$ represents `vectors[i](j)`.
      */
-    NPMatrix<T> &setRows(const vector<NVector<T>> &vectors, size_t i1 = 0);
+    NPMatrix<T, A> &setRows(const vector<NVector<T, A>> &vectors, size_t i1 = 0);
 
     /**
      *
-     * @param vectors   Rows to set on the matrix. `std::vector` of `NVector<T>`.
+     * @param vectors   Rows to set on the matrix. `std::vector` of `NVector<T, A>`.
      *
      * @param j1        Start index to set row.
      * @brief           Replace the components of the matrix with the array of vectors.
      *
      * @details         The behavior of `setCols()` is analog to `setRows()`.
      */
-    NPMatrix<T> &setCols(const vector<NVector<T>> &vectors, size_t j1 = 0);
+    NPMatrix<T, A> &setCols(const vector<NVector<T, A>> &vectors, size_t j1 = 0);
 
     /** @} */
 
@@ -350,10 +531,10 @@ public:
      * @param j2 second col indices to swap
      * @brief Swap \f$ A_{i_1j_1} \f$ and \f$ A_{i_2j_2} \f$.
      */
-    inline NPMatrix<T> &swap(size_t i1, size_t j1, size_t i2, size_t j2) {
+    inline NPMatrix<T, A> &swap(size_t i1, size_t j1, size_t i2, size_t j2) {
         assert(isValidIndex(i1, j1) && isValidIndex(i2, j2));
 
-        NVector<T>::swap(vectorIndex(i1, j1), vectorIndex(i2, j2));
+        NVector<T, A>::swap(vectorIndex(i1, j1), vectorIndex(i2, j2));
         lupClear();
         return *this;
     }
@@ -364,7 +545,7 @@ public:
      * @param i2 second row indices to swap
      * @brief Swap \f$ R_{i_1} \f$ and \f$ R_{i_2} \f$.
      */
-    inline NPMatrix<T> &swapRow(size_t i1, size_t i2) { return swap(Row, i1, i2); }
+    inline NPMatrix<T, A> &swapRow(size_t i1, size_t i2) { return swap(Row, i1, i2); }
 
     /**
      *
@@ -372,7 +553,7 @@ public:
      * @param j2 second col indices to swap
      * @brief Swap \f$ C_{j_1} \f$ and \f$ C_{j_2} \f$.
      */
-    inline NPMatrix<T> &swapCol(size_t j1, size_t j2) { return swap(Col, j1, j2); }
+    inline NPMatrix<T, A> &swapCol(size_t j1, size_t j2) { return swap(Col, j1, j2); }
 
 
     // SHIFT
@@ -393,7 +574,7 @@ public:
      *                  \f]
      *
      */
-    inline NPMatrix<T> &shiftRow(size_t i, long iterations = 1) { return shift(Row, i, iterations); }
+    inline NPMatrix<T, A> &shiftRow(size_t i, long iterations = 1) { return shift(Row, i, iterations); }
 
     /**
      *
@@ -403,7 +584,7 @@ public:
      * @details The behavior is analog to `shiftRow()`. If `iterations` is positive,
      * shift is powered to the up, else to the bottom.
      */
-    inline NPMatrix<T> &shiftCol(size_t j, long iterations = 1) { return shift(Col, j, iterations); }
+    inline NPMatrix<T, A> &shiftCol(size_t j, long iterations = 1) { return shift(Col, j, iterations); }
 
     /** @} */
 
@@ -418,10 +599,35 @@ public:
      */
 
     /**
-     * @brief Transposed matrix.
-     * @return Value of transposed \f$ A^\top \f$.
+     * @brief Transpose this matrix in place.
+     * @details The whole matrix is transposed by `NBlas::transpose()` without allocating a second matrix, by cycle
+     * following if it is not square. If browse indices are set, the selected block must be square and is
+     * transposed within the matrix.
+     * @return Reference to `this` matrix \f$ A^T \f$.
+     */
+    NPMatrix<T, A> & trans();
+
+    /**
+     * @brief Lazy transposed \f$ A^T \f$ of the block selected by browse indices, see `NTransposed`.
+     * @details Browse indices are reset. Products and solves by the result read \f$ A \f$ in place.
+     */
+    inline NTransposed<T, A> transposed() const { return NTransposed<T, A>(*this); }
+
+    /**
+     * @brief Exponential \f$ e^A \f$ of this matrix computed in place.
+     * @details \f$ A \f$ is scaled by \f$ 2^{-s} \f$ so that its \f$ 1 \f$-norm is lower than
+     * \f$ \theta_{13} \approx 5.37 \f$, \f$ e^{2^{-s} A} \f$ is approximated by the Padé approximant
+     * \f$ [m/m] = (V - U)^{-1} (V + U) \f$ with \f$ m \in \{3, 5, 7, 9, 13\} \f$ the smallest degree accurate to the
+     * unit roundoff for this norm, then squared \f$ s \f$ times. If browse indices are set, the selected block must be
+     * square and is replaced by its exponential. Only defined for real types. \f$ O(n^3) \f$.
+     *
+     * \f$ s \f$ is bounded by the `max_exponent` of `T`, below which any finite norm gets lower than \f$ 1 \f$. If
+     * \f$ V - U \f$ is singular, \f$ A \f$ is halved once more and the approximant recomputed, since it tends to
+     * \f$ b_0 I \f$. If it stays singular, which only happens for non-finite coefficients, the block is filled with
+     * `NaN`.
+     * @return Reference to `this` matrix \f$ e^A \f$.
      */
-    NPMatrix<T> & trans();
+    NPMatrix<T, A> &expm();
 
     /**
      *
@@ -437,7 +643,7 @@ public:
      * and \f$ M \f$ columns. \f$ A \f$ and \f$ M \f$ must have the same number of rows.
      * @return Returns the value of shifted matrix \f$ [ A | M ] \f$.
      */
-    NPMatrix<T> shifted(const NPMatrix<T> &m) const;
+    NPMatrix<T, A> shifted(const NPMatrix<T, A> &m) const;
 
     /**
      * @brief Apply Gauss Jordan elimination on matrix to calculate inverse without using \f$ LU \f$ decomposition.
@@ -445,7 +651,7 @@ public:
      * the matrix is inversible, than the inverse of the matrix is on the right part of the matrix. \f$ O(n^3) \f$.
      * @return Reference to `*this` the shifted matrix.
      */
-    NPMatrix<T> &reduce();
+    NPMatrix<T, A> &reduce();
 
     /**
      * @brief determinant of this matrix \f$ det(A) \f$. Using the \f$ LU \f$ decomposition \f$ O(n) \f$.
@@ -453,6 +659,26 @@ public:
      */
     T det() const;
 
+    /**
+     * @param x vector of dimension \f$ p \f$.
+     * @param y receives \f$ A x \f$.
+     * @brief Matrix vector product \f$ y \leftarrow A x \f$ computed in place, without temporary.
+     * @details If `y` has default browse indices it is resized to \f$ n \f$ when needed, else the result is written in
+     * its browsed range which must be of dimension \f$ n \f$. Browse indices of `this` matrix select the block \f$ A \f$.
+     * `y` must not be `x`. \f$ O(np) \f$.
+     * @return Reference to `y`.
+     */
+    NVector<T, A> &product(const NVector<T, A> &x, NVector<T, A> &y) const;
+
+    /**
+     * @param x vector of dimension \f$ n \f$.
+     * @param y receives \f$ A^T x \f$.
+     * @brief Transposed matrix vector product \f$ y \leftarrow A^T x \f$ computed without transposing the matrix.
+     * @details Browse indices behave as in `product()`. `y` must not be `x`. \f$ O(np) \f$.
+     * @return Reference to `y`.
+     */
+    NVector<T, A> &transProduct(const NVector<T, A> &x, NVector<T, A> &y) const;
+
     /** @} */
 
     /**
@@ -470,27 +696,62 @@ public:
 
     // ALGEBRAICAL OPERATORS
 
-    inline friend NPMatrix<T> operator+(NPMatrix<T> a, const NPMatrix<T> &b) {
+    /**
+     * @brief Element-wise operations.
+     * @details Sums and differences of two lvalues are evaluated lazily, see `NExpr`. A temporary operand is reused
+     * to store the result. Products by a scalar are computed immediately, the product of an expression is lazy.
+     */
+    inline friend NExpr<NPMatrix<T, A>, NBinaryExpr<NLeafExpr<T>, NLeafExpr<T>, NAddOp>>
+    operator+(const NPMatrix<T, A> &a, const NPMatrix<T, A> &b) {
+        return {NBinaryExpr<NLeafExpr<T>, NLeafExpr<T>, NAddOp>(a.expr().node(), b.expr().node())};
+    }
+
+    inline friend NPMatrix<T, A> operator+(NPMatrix<T, A> &&a, const NPMatrix<T, A> &b) {
         a += b;
-        return a;
+        return std::move(a);
+    }
+
+    inline friend NPMatrix<T, A> operator+(const NPMatrix<T, A> &a, NPMatrix<T, A> &&b) {
+        b += a;
+        return std::move(b);
     }
 
-    inline friend NPMatrix<T> operator-(NPMatrix<T> a, const NPMatrix<T> &b) {
+    inline friend NPMatrix<T, A> operator+(NPMatrix<T, A> &&a, NPMatrix<T, A> &&b) {
+        a += b;
+        return std::move(a);
+    }
+
+    inline friend NExpr<NPMatrix<T, A>, NBinaryExpr<NLeafExpr<T>, NLeafExpr<T>, NSubOp>>
+    operator-(const NPMatrix<T, A> &a, const NPMatrix<T, A> &b) {
+        return {NBinaryExpr<NLeafExpr<T>, NLeafExpr<T>, NSubOp>(a.expr().node(), b.expr().node())};
+    }
+
+    inline friend NPMatrix<T, A> operator-(NPMatrix<T, A> &&a, const NPMatrix<T, A> &b) {
         a -= b;
-        return a;
+        return std::move(a);
+    }
+
+    inline friend NPMatrix<T, A> operator-(const NPMatrix<T, A> &a, NPMatrix<T, A> &&b) {
+        b = a - b;
+        return std::move(b);
+    }
+
+    inline friend NPMatrix<T, A> operator-(NPMatrix<T, A> &&a, NPMatrix<T, A> &&b) {
+        a -= b;
+        return std::move(a);
     }
 
-    inline friend NPMatrix<T> operator-(NPMatrix<T> m) {
+    inline friend NPMatrix<T, A> operator-(NPMatrix<T, A> m) {
         m.opp();
         return m;
     }
 
-    inline friend NPMatrix<T> operator*(T s, NPMatrix<T> m) {
+    inline friend NPMatrix<T, A> operator*(T s, NPMatrix<T, A> m) {
         m *= s;
         return m;
     }
 
-    inline friend NPMatrix<T> operator*(NPMatrix<T> m, T s) { return s * m; }
+    inline friend NPMatrix<T, A> operator*(NPMatrix<T, A> m, T s) { return s * m; }
 
     /**
      * @brief Usual matrix multiplication
@@ -498,23 +759,23 @@ public:
      * @return value of \f$ A B \f$.
      */
 
-    inline friend NPMatrix<T> operator*(NPMatrix<T> a, const NPMatrix<T> &b) {
+    inline friend NPMatrix<T, A> operator*(NPMatrix<T, A> a, const NPMatrix<T, A> &b) {
         a *= (&a != &b ? b : a);
         return a;
     }
 
     /**
      * @brief Usual matrix vector product (linear mapping).
-     * @details The number of rows of m must be equal to the dimension of \f$ v \f$.
-     * Natural \f$ O(n^2) \f$ linear mapping is used.
+     * @details The number of columns of m must be equal to the dimension of \f$ v \f$. Computed using `product()`.
      * @return value of \f$ M v \f$.
      */
-    inline friend NVector<T> operator*(const NPMatrix<T> &m, NVector<T> v) {
-        m.vectorProduct(v);
-        return v;
+    inline friend NVector<T, A> operator*(const NPMatrix<T, A> &m, const NVector<T, A> &v) {
+        NVector<T, A> res;
+        m.product(v, res);
+        return res;
     }
 
-    inline friend NPMatrix<T> operator/(NPMatrix<T> m, T s) {
+    inline friend NPMatrix<T, A> operator/(NPMatrix<T, A> m, T s) {
         m /= s;
         return m;
     }
@@ -528,7 +789,7 @@ public:
      * If \f$ exp < 0 \f$ we calculate the power of the inverse matrix using `inv()` method.
      * @return value of \f$ M^{exp} \f$ exponentiated matrix.
      */
-    inline friend NPMatrix<T> operator^(NPMatrix<T> m, long exp) {
+    inline friend NPMatrix<T, A> operator^(NPMatrix<T, A> m, long exp) {
         m ^= exp;
         return m;
     }
@@ -541,16 +802,29 @@ public:
      * This algorithm uses \f$ LU \f$ decomposition.
      * @return Value of the solution of the system \f$ X \f$.
      */
-    inline friend NVector<T> operator%(const NPMatrix<T> &m, NVector<T> v) {
+    inline friend NVector<T, A> operator%(const NPMatrix<T, A> &m, NVector<T, A> v) {
         v %= m;
         return v;
     }
 
+    /**
+     * @param m matrix of the equation system.
+     * @param b second members of the equation system, one per column.
+     * @brief Solve the linear systems formed by \f$ M \f$ and the columns of \f$ B \f$.
+     * @details The linear system is \f$ MX = B \f$ where \f$ X \f$ is unknown. All the columns are solved at once
+     * using blocked triangular solves on the \f$ LU \f$ decomposition.
+     * @return Value of the solution of the system \f$ X \f$.
+     */
+    inline friend NPMatrix<T, A> operator%(const NPMatrix<T, A> &m, NPMatrix<T, A> b) {
+        b %= m;
+        return b;
+    }
+
 
     // SCALAR PRODUCT BASED OPERATIONS
 
-    friend T operator|(const NPMatrix<T> &a, const NPMatrix<T> &b) {
-        NVector<T> sub_a{a(a._i1, a._j1, a._i2, a._j2)}, sub_b{b(b._i1, b._j1, b._i2, b._j2)};
+    friend T operator|(const NPMatrix<T, A> &a, const NPMatrix<T, A> &b) {
+        NVector<T, A> sub_a{a(a._i1, a._j1, a._i2, a._j2)}, sub_b{b(b._i1, b._j1, b._i2, b._j2)};
         auto res = sub_a | sub_b;
 
         a.setDefaultBrowseIndices();
@@ -558,32 +832,56 @@ public:
         return res;
     }
 
-    friend T operator!(const NPMatrix<T> &m) { return sqrt(m | m); }
+    friend T operator!(const NPMatrix<T, A> &m) { return sqrt(m | m); }
 
-    friend T operator/(const NPMatrix<T> &a, const NPMatrix<T> &b) { return !(a - b); }
+    friend T operator/(const NPMatrix<T, A> &a, const NPMatrix<T, A> &b) { return !(a - b); }
 
     // COMPOUND OPERATORS
 
-    inline NPMatrix<T> &operator+=(const NPMatrix<T> &m) { return add(m); }
+    inline NPMatrix<T, A> &operator+=(const NPMatrix<T, A> &m) { return add(m); }
+
+    inline NPMatrix<T, A> &operator-=(const NPMatrix<T, A> &m) { return sub(m); }
+
+    template<typename E>
+    inline NPMatrix<T, A> &operator+=(const NExpr<NPMatrix<T, A>, E> &e) {
+        e.addTo(browseView());
+        return clean();
+    }
+
+    template<typename E>
+    inline NPMatrix<T, A> &operator-=(const NExpr<NPMatrix<T, A>, E> &e) {
+        e.subTo(browseView());
+        return clean();
+    }
+
+    inline NPMatrix<T, A> &operator+=(const NMatrixView<const T> &m) {
+        browseView() += m;
+        return clean();
+    }
 
-    inline NPMatrix<T> &operator-=(const NPMatrix<T> &m) { return sub(m); }
+    inline NPMatrix<T, A> &operator-=(const NMatrixView<const T> &m) {
+        browseView() -= m;
+        return clean();
+    }
 
-    inline NPMatrix<T> &operator*=(const NPMatrix<T> &m) {
+    inline NPMatrix<T, A> &operator*=(const NPMatrix<T, A> &m) {
         matrixProduct(m);
         setDefaultBrowseIndices();
         m.setDefaultBrowseIndices();
         return *this;
     }
 
-    inline NPMatrix<T> &operator*=(T s) override { return prod(s); }
+    inline NPMatrix<T, A> &operator*=(T s) override { return prod(s); }
+
+    inline friend NVector<T, A> &operator*=(NVector<T, A> &u, const NPMatrix<T, A> &m) { return m.vectorProduct(u); }
 
-    inline friend NVector<T> &operator*=(NVector<T> &u, const NPMatrix<T> &m) { return m.vectorProduct(u); }
+    inline NPMatrix<T, A> &operator/=(T s) override { return div(s); }
 
-    inline NPMatrix<T> &operator/=(T s) override { return div(s); }
+    inline NPMatrix<T, A> &operator^=(long exp) { return pow(exp); }
 
-    inline NPMatrix<T> &operator^=(long exp) { return pow(exp); }
+    inline friend NVector<T, A> &operator%=(NVector<T, A> &u, const NPMatrix<T, A> &m) { return m.solve(u); }
 
-    inline friend NVector<T> &operator%=(NVector<T> &u, const NPMatrix<T> &m) { return m.solve(u); }
+    inline NPMatrix<T, A> &operator%=(const NPMatrix<T, A> &m) { return m.solve(*this); }
 
     /** @} */
 
@@ -620,7 +918,7 @@ public:
      * @param j2 last row to take \f$ p \gt j_2 \geq j_1 \geq 0 \f$ of columns
      * @brief Manipulate sub-matrix.
 
-     * @details This operator is similar to @ref NVector<T>::operator()(size_t, size_t) const "vector sub-range operator".
+     * @details This operator is similar to @ref NVector<T, A>::operator()(size_t, size_t) const "vector sub-range operator".
      * It allows operations on a restricted range of the matrix :
      *         \f[ \begin{bmatrix}
      *             A_{i_1j_1}   & ... & A_{i_2j_1} \\
@@ -642,7 +940,7 @@ public:
 
      *
      */
-    inline NPMatrix<T> operator()(size_t i1, size_t j1, size_t i2, size_t j2) const { return subMatrix(i1, j1, i2, j2); }
+    inline NPMatrix<T, A> operator()(size_t i1, size_t j1, size_t i2, size_t j2) const { return subMatrix(i1, j1, i2, j2); }
 
     /**
      *
@@ -651,19 +949,39 @@ public:
      * except that it sets browse indices. See `NVector` @ref operator()(size_t k1, size_t k2) "operator" for more details.
      * @return reference to `*this`.
      */
-    NPMatrix<T> &operator()(size_t i1, size_t j1, size_t i2, size_t j2);
+    NPMatrix<T, A> &operator()(size_t i1, size_t j1, size_t i2, size_t j2);
 
     /** @} */
 
     // AFFECTATION
 
-    inline NPMatrix<T> &operator=(const NPMatrix<T> &m) {
+    inline NPMatrix<T, A> &operator=(const NPMatrix<T, A> &m) {
         return copy(m);
     }
 
+    /**
+     * @brief Copy the components of a view.
+     * @details If browse indices are set, the components are copied in the selected block which must have the same
+     * size as the view. Else the matrix is resized to the size of the view.
+     */
+    NPMatrix<T, A> &operator=(const NMatrixView<const T> &m);
+
+    /**
+     * @brief Evaluate an expression in place.
+     * @details No memory is allocated unless the matrix must be resized. Browse indices behave as in `operator=()`.
+     */
+    template<typename E>
+    NPMatrix<T, A> &operator=(const NExpr<NPMatrix<T, A>, E> &e) {
+        if (hasDefaultBrowseIndices() && (_n != e.n() || _p != e.p())) {
+            return copy(NPMatrix<T, A>(e));
+        }
+        e.assignTo(browseView());
+        return clean();
+    }
+
     // COMPARAISON OPERATORS
 
-    friend bool operator==(const NPMatrix<T> &a, const NPMatrix<T> &b) {
+    friend bool operator==(const NPMatrix<T, A> &a, const NPMatrix<T, A> &b) {
         bool res = a(a._i1, a._j1, a._i2, a._j2).isEqual(b(b._i1, b._j1, b._i2, b._j2));
 
         a.setDefaultBrowseIndices();
@@ -671,7 +989,7 @@ public:
         return res;
     }
 
-    inline friend bool operator!=(const NPMatrix<T> &a, const NPMatrix<T> &b) { return !(a == b); }
+    inline friend bool operator!=(const NPMatrix<T, A> &a, const NPMatrix<T, A> &b) { return !(a == b); }
 
     // STATIC FUNCTIONS
 
@@ -679,16 +997,16 @@ public:
      *
      * @brief \f$ n \times p \f$ matrix filled with `0`.
      */
-    inline static NPMatrix<T> zeros(size_t n, size_t p = 0) {
-        return NPMatrix<T>(NVector<T>::zeros(n * pIfNotNull(n, p)), n);
+    inline static NPMatrix<T, A> zeros(size_t n, size_t p = 0) {
+        return NPMatrix<T, A>(NVector<T, A>::zeros(n * pIfNotNull(n, p)), n);
     }
 
     /**
      *
      * @brief \f$ n \times p \f$ matrix filled with `1`.
      */
-    inline static NPMatrix<T> ones(size_t n, size_t p = 0) {
-        return NPMatrix<T>(NVector<T>::ones(n * pIfNotNull(n, p)), n);
+    inline static NPMatrix<T, A> ones(size_t n, size_t p = 0) {
+        return NPMatrix<T, A>(NVector<T, A>::ones(n * pIfNotNull(n, p)), n);
     }
 
     /**
@@ -699,8 +1017,8 @@ public:
      * which contains `1` in position \f$ ij \f$ and `0` elsewhere.
      * This matrix is eviqualent to \f$ \delta_{ij} \f$ Kronecker's delta symbol.
      */
-    inline static NPMatrix<T> cano(size_t i, size_t j, size_t n, size_t p = 0) {
-        return NPMatrix<T>(NVector<T>::cano(p * i + j, n * pIfNotNull(n, p)), n);
+    inline static NPMatrix<T, A> cano(size_t i, size_t j, size_t n, size_t p = 0) {
+        return NPMatrix<T, A>(NVector<T, A>::cano(p * i + j, n * pIfNotNull(n, p)), n);
     }
 
     /**
@@ -709,7 +1027,7 @@ public:
      * @brief \f$ n^{th} \f$ order identity matrix
      * @return \f$ Id \f$ identity matrix.
      */
-    static NPMatrix<T> eye(size_t n);
+    static NPMatrix<T, A> eye(size_t n);
 
     /**
      *
@@ -717,7 +1035,7 @@ public:
      * @param n size of the matrix.
      * @brief diagonal \f$ n^{th} \f$ order diagonal matrix filled with data array.
      */
-    static NPMatrix<T> diag(const vector<T> &data, size_t n);
+    static NPMatrix<T, A> diag(const vector<T> &data, size_t n);
 
 
     /**
@@ -727,7 +1045,7 @@ public:
      * @details Scalar matrices are a diagonal matrix filled a unique value.
      * @return \f$ n^{th} \f$ order matrix equal to \f$ s \cdot Id \f$.
      */
-    inline static NPMatrix<T> scalar(T s, size_t n) { return s * NPMatrix<T>::eye(n); }
+    inline static NPMatrix<T, A> scalar(T s, size_t n) { return s * NPMatrix<T, A>::eye(n); }
 
     /**
      *
@@ -754,7 +1072,7 @@ public:
      *
      * @return a n-diagonal matrix filled with `data`.
      */
-    static NPMatrix<T> ndiag(const vector<NVector<T> > &data);
+    static NPMatrix<T, A> ndiag(const vector<NVector<T, A> > &data);
 
 
     /**
@@ -777,17 +1095,17 @@ public:
      * Center diagonal is filled with s1 and the other diagonal are filled with s0.
      * @return  a n-scalar Matrix filled with given `scalars`.
      */
-    static NPMatrix<T> nscalar(const vector<T> &scalars, size_t n);
+    static NPMatrix<T, A> nscalar(const vector<T> &scalars, size_t n);
 
 protected:
 
-    explicit NPMatrix(const NVector<T> &u, size_t n, size_t p, size_t i1 = 0, size_t j1 = 0, size_t i2 = 0, size_t j2 = 0);
+    explicit NPMatrix(const NVector<T, A> &u, size_t n, size_t p, size_t i1 = 0, size_t j1 = 0, size_t i2 = 0, size_t j2 = 0);
 
     // MANIPULATORS
 
-    NPMatrix<T> &swap(Parts element, size_t k1, size_t k2);
+    NPMatrix<T, A> &swap(Parts element, size_t k1, size_t k2);
 
-    NPMatrix<T> &shift(Parts element, size_t k, long iterations);
+    NPMatrix<T, A> &shift(Parts element, size_t k, long iterations);
 
     // MAX/MIN
 
@@ -801,53 +1119,90 @@ protected:
 
     // ALGEBRAICAL OPERATIONS
 
-    NVector<T> &vectorProduct(NVector<T> &u) const;
+    NVector<T, A> &vectorProduct(NVector<T, A> &u) const;
+
+    /**
+     * @brief Prepare `y` to receive a product of dimension `dim`, see `product()`.
+     * @return Pointer to the first component of the browsed range of `y`.
+     */
+    static T *productOutput(NVector<T, A> &y, size_t dim);
+
+    NPMatrix<T, A> &matrixProduct(const NPMatrix<T, A> &m);
+
+    /**
+     * @param b first component of the right operand, a matrix of `_j2 - _j1 + 1` rows.
+     * @param ldb leading dimension of the right operand.
+     * @param p number of columns of the right operand.
+     * @brief Multiply the browsed block by a raw matrix, the product is computed in a scratch buffer.
+     */
+    NPMatrix<T, A> &matrixProduct(const T *b, size_t ldb, size_t p);
+
+    inline NPMatrix<T, A> &add(const NPMatrix<T, A> &m) { return forEach(m, [](T &x, const T &y) { x += y; }); }
+
+    inline NPMatrix<T, A> &sub(const NPMatrix<T, A> &m) { return forEach(m, [](T &x, const T &y) { x -= y; }); }
 
-    NPMatrix<T> &matrixProduct(const NPMatrix<T> &m);
+    inline NPMatrix<T, A> &opp() override { return prod(-1); }
 
-    inline NPMatrix<T> &add(const NPMatrix<T> &m) { return forEach(m, [](T &x, const T &y) { x += y; }); }
+    inline NPMatrix<T, A> &prod(T s) override { return forEach(s, [](T &x, T t) { x *= t; }); }
 
-    inline NPMatrix<T> &sub(const NPMatrix<T> &m) { return forEach(m, [](T &x, const T &y) { x -= y; }); }
+    inline NPMatrix<T, A> &div(T s) override { return forEach(s, [](T &x, T t) { x /= t; }); }
 
-    inline NPMatrix<T> &opp() override { return prod(-1); }
+    NPMatrix<T, A> &pow(long exp);
 
-    inline NPMatrix<T> &prod(T s) override { return forEach(s, [](T &x, T t) { x *= t; }); }
+    /**
+     * @brief Raise the browsed square block to the power `exp` by binary exponentiation.
+     * @details The square of the base and the partial product are computed in arena buffers which are swapped with the
+     * scratch buffer after each product, so that no memory is allocated once the arena has grown.
+     */
+    void binaryPow(unsigned long exp);
 
-    inline NPMatrix<T> &div(T s) override { return forEach(s, [](T &x, T t) { x /= t; }); }
+    NPMatrix<T, A> &inv();
 
-    NPMatrix<T> &pow(long exp);
+    NVector<T, A> &solve(NVector<T, A> &u) const;
 
-    void rPow(long exp);
+    /**
+     * @param b right-hand sides, overwritten with the solutions.
+     * @brief Solve \f$ AX = B \f$ for all the columns of `b` at once using the cached \f$ LU \f$ factors.
+     * @details Browse indices of `b` select the right-hand sides. `b` is left unchanged if `this` matrix is singular.
+     * @return Reference to `b`.
+     */
+    NPMatrix<T, A> &solve(NPMatrix<T, A> &b) const;
 
-    NPMatrix<T> &inv();
+    /**
+     * @brief Solve \f$ A^T x = u \f$ using the cached factors of \f$ A \f$, see `solve()`.
+     */
+    NVector<T, A> &transSolve(NVector<T, A> &u) const;
 
-    NVector<T> &solve(NVector<T> &u) const;
+    /**
+     * @brief Solve \f$ A^T X = B \f$ using the cached factors of \f$ A \f$, see `solve()`.
+     */
+    NPMatrix<T, A> &transSolve(NPMatrix<T, A> &b) const;
 
     // LUP MANAGEMENT
 
     void lupClear() const;
 
-    void lupReset() const;
-
     void lupCopy(const NPMatrix &m) const;
 
     inline void lupSelfCopy() const{ lupCopy(*this);};
 
     void lupUpdate() const;
 
+    size_t factorOrder() const;
+
     // MUTABLE VARIABLES MANAGEMENT
 
-    inline NPMatrix<T> &clean() const {
+    inline NPMatrix<T, A> &clean() const {
         setDefaultBrowseIndices();
         lupClear();
-        return const_cast<NPMatrix<T> &>(*this);
+        return const_cast<NPMatrix<T, A> &>(*this);
     }
 
-    inline NPMatrix<T> &cleanBoth(const NPMatrix<T> &m) const {
+    inline NPMatrix<T, A> &cleanBoth(const NPMatrix<T, A> &m) const {
         setDefaultBrowseIndices();
         m.setDefaultBrowseIndices();
         lupClear();
-        return const_cast<NPMatrix<T> &>(*this);
+        return const_cast<NPMatrix<T, A> &>(*this);
     }
 
     // CHARACTERIZATION
@@ -864,14 +1219,18 @@ protected:
 
     inline static size_t pIfNotNull(size_t n, size_t p) { return p > 0 ? p : n; }
 
-    inline bool matchSizeForProduct(const NVector<T> &u) const { return (u.dim() - 1) == (_j2 - _j1); }
+    inline bool matchSizeForProduct(const NVector<T, A> &u) const { return (u.dim() - 1) == (_j2 - _j1); }
 
-    inline bool matchSizeForProduct(const NPMatrix<T> &m) const { return m._i2 - m._i1 == _j2 - _j1; }
+    inline bool matchSizeForProduct(const NPMatrix<T, A> &m) const { return m._i2 - m._i1 == _j2 - _j1; }
 
-    inline bool hasSameSize(const NPMatrix<T> &m) const {
+    inline bool hasSameSize(const NPMatrix<T, A> &m) const {
         return m._i2 - m._i1 == _i2 - _i1 && m._j2 - m._j1 == _j2 - _j1;
     }
 
+    inline NMatrixView<T> browseView() {
+        return NMatrixView<T>(this->data() + vectorIndex(_i1, _j1), _i2 - _i1 + 1, _j2 - _j1 + 1, _p);
+    }
+
     // SUB MATRIX INDICES MANAGEMENT
 
     bool hasDefaultBrowseIndices() const override;
@@ -880,9 +1239,9 @@ protected:
 
     // AFFECTATION
 
-    NPMatrix<T> &copy(const NPMatrix<T> &m);
+    NPMatrix<T, A> &copy(const NPMatrix<T, A> &m);
 
-    NPMatrix<T> &copy(const vector<vector<T>> &data);
+    NPMatrix<T, A> &copy(const vector<vector<T>> &data);
 
     // INDEX GETTERS
 
@@ -900,16 +1259,77 @@ protected:
 
     // SUB-MATRICES
 
-    NPMatrix<T> subMatrix(size_t i1 = 0, size_t j1 = MAX_SIZE,
+    NPMatrix<T, A> subMatrix(size_t i1 = 0, size_t j1 = MAX_SIZE,
                           size_t i2 = 0, size_t j2 = MAX_SIZE) const;
 
-    NPMatrix<T> &setSubMatrix(const NPMatrix<T> &m);
+    NPMatrix<T, A> &setSubMatrix(const NPMatrix<T, A> &m);
 
     // MANIPULATORS
 
-    NPMatrix<T> &forEach(const NPMatrix<T> &m, const function<void(T &, const T &)> &binary_op);
+    /**
+     * @brief Apply `binary_op(A_ij, M_ij)` to each component of the selected block.
+     * @details When both blocks are made of complete rows, they are contiguous and processed in a single loop.
+     * Otherwise the loop is performed row by row. See `NVector::forEach()`.
+     */
+    template<typename BinaryOp>
+    NPMatrix<T, A> &forEach(const NPMatrix<T, A> &m, BinaryOp binary_op) {
+        assert(hasSameSize(m));
+
+        if (this->empty()) {
+            return cleanBoth(m);
+        }
+
+        const size_t n = _i2 - _i1 + 1, p = _j2 - _j1 + 1, ldx = _p, ldy = m._p;
+        T *x = this->data() + vectorIndex(_i1, _j1);
+        const T *y = m.data() + m.vectorIndex(m._i1, m._j1);
+
+        if (p == ldx && p == ldy) {
+            NThreadPool::instance().parallelFor(0, n * p, NTHREADPOOL_MIN_SIZE, [x, y, binary_op](size_t k1, size_t k2) {
+                for (size_t k = k1; k < k2; ++k) {
+                    binary_op(x[k], y[k]);
+                }
+            });
+        } else {
+            NThreadPool::instance().parallelFor(0, n, NTHREADPOOL_MIN_SIZE / p + 1, [=](size_t i1, size_t i2) {
+                for (size_t i = i1; i < i2; ++i) {
+                    T *x_i = x + i * ldx;
+                    const T *y_i = y + i * ldy;
+                    for (size_t j = 0; j < p; ++j) {
+                        binary_op(x_i[j], y_i[j]);
+                    }
+                }
+            });
+        }
+        return cleanBoth(m);
+    }
 
-    NPMatrix<T> &forEach(T s, const function<void(T &, T)> &binary_op) override;
+    template<typename BinaryOp>
+    NPMatrix<T, A> &forEach(T s, BinaryOp binary_op) {
+        if (this->empty()) {
+            return clean();
+        }
+
+        const size_t n = _i2 - _i1 + 1, p = _j2 - _j1 + 1, ldx = _p;
+        T *x = this->data() + vectorIndex(_i1, _j1);
+
+        if (p == ldx) {
+            NThreadPool::instance().parallelFor(0, n * p, NTHREADPOOL_MIN_SIZE, [x, s, binary_op](size_t k1, size_t k2) {
+                for (size_t k = k1; k < k2; ++k) {
+                    binary_op(x[k], s);
+                }
+            });
+        } else {
+            NThreadPool::instance().parallelFor(0, n, NTHREADPOOL_MIN_SIZE / p + 1, [=](size_t i1, size_t i2) {
+                for (size_t i = i1; i < i2; ++i) {
+                    T *x_i = x + i * ldx;
+                    for (size_t j = 0; j < p; ++j) {
+                        binary_op(x_i[j], s);
+                    }
+                }
+            });
+        }
+        return clean();
+    }
 
     // SIZE
 
@@ -931,19 +1351,128 @@ protected:
     // LU STORAGE
 
     /**
-     * @brief Matrix \f$ A = LU \f$ where \f$ PA = LU \f$ = this.
-     * @details `_a` points to the \f$ A \f$ NMatrix or to `nullptr` if the matrix don't have \f$ LU \f$ decomposition.
+     * @brief \f$ LU \f$ decomposition \f$ PA = LU \f$ of this matrix.
+     * @details `_lu` is `nullptr` until the decomposition is needed. The factors are immutable and shared between
+     * the copies of the matrix.
      */
-    mutable unique_ptr<NPMatrix<T>> _a{};
+    mutable shared_ptr<const NLU<T, A>> _lu{};
 
     /**
-     * @brief permutation vector \f$ P \f$ such as \f$ PA = LU \f$.
-     * @details Represented as `unsigned long` array.
+     * @brief Cholesky decomposition \f$ A = LL^T \f$ of this matrix.
+     * @details `_llt` is set by `llt()` and takes precedence over `_lu`.
      */
-    mutable unique_ptr<vector<size_t>> _perm{};
+    mutable shared_ptr<const NCholesky<T, A>> _llt{};
 };
 /** @} */
 
+/**
+ * @ingroup NAlgebra
+ * @{
+ * @class   NTransposed
+ * @date    17/10/2026
+ * @brief   Lazy transposed \f$ A^T \f$ of a block of `NPMatrix`, returned by `NPMatrix::transposed()`.
+ *
+ * @details The transposed matrix is never formed by the operators :
+ *              - The products `a.transposed() * b`, `a * b.transposed()` and `a.transposed() * b.transposed()` read
+ *              the operands in place using the strided `NBlas::gemm()`, whose packing performs the transposition.
+ *              - The product `a.transposed() * v` is computed by `NBlas::gemvT()`, see `NPMatrix::transProduct()`.
+ *              - The solves `a.transposed() % b` use the factors of \f$ A \f$ cached by the matrix. The \f$ LU \f$
+ *              factors are applied transposed by `NLU::transSolve()`, while a matrix factorized by `NCholesky` is
+ *              symmetric.
+ *
+ *          The view converts implicitly to `NPMatrix`, the transposed matrix being then formed by the
+ *          cache-oblivious `NBlas::transpose()`. As `NExpr`, the view must not outlive the viewed matrix.
+ */
+
+template<typename T, typename A = NAlignedAllocator<T>>
+class NTransposed {
+
+public:
+
+    /**
+     * @param m viewed matrix, its browse indices select the block \f$ A \f$ and are reset.
+     */
+    explicit NTransposed(const NPMatrix<T, A> &m);
+
+    // GETTERS
+
+    inline size_t n() const { return _j2 - _j1 + 1; }
+
+    inline size_t p() const { return _i2 - _i1 + 1; }
+
+    inline T operator()(size_t i, size_t j) const { return _matrix(_i1 + j, _j1 + i); }
+
+    // CONVERSION
+
+    /**
+     * @brief Transposed matrix \f$ A^T \f$.
+     */
+    operator NPMatrix<T, A>() const;
+
+    // OPERATORS
+
+    inline friend NPMatrix<T, A> operator*(const NTransposed<T, A> &a, const NPMatrix<T, A> &b) {
+        return product(a.view(), true, block(b), false);
+    }
+
+    inline friend NPMatrix<T, A> operator*(const NPMatrix<T, A> &a, const NTransposed<T, A> &b) {
+        return product(block(a), false, b.view(), true);
+    }
+
+    inline friend NPMatrix<T, A> operator*(const NTransposed<T, A> &a, const NTransposed<T, A> &b) {
+        return product(a.view(), true, b.view(), true);
+    }
+
+    inline friend NVector<T, A> operator*(const NTransposed<T, A> &a, const NVector<T, A> &v) {
+        NVector<T, A> res;
+        a.select().transProduct(v, res);
+        return res;
+    }
+
+    /**
+     * @brief Solve \f$ A^T x = v \f$, see `NPMatrix::operator%()`.
+     */
+    inline friend NVector<T, A> operator%(const NTransposed<T, A> &a, NVector<T, A> v) { return a.solve(v); }
+
+    /**
+     * @brief Solve \f$ A^T X = B \f$ for all the columns of \f$ B \f$ at once.
+     */
+    inline friend NPMatrix<T, A> operator%(const NTransposed<T, A> &a, NPMatrix<T, A> b) {
+        a.solve(b);
+        return b;
+    }
+
+protected:
+
+    /**
+     * @brief Block of `m` selected by its browse indices, which are reset.
+     */
+    static NMatrixView<const T> block(const NPMatrix<T, A> &m);
+
+    /**
+     * @brief Product \f$ op(A) op(B) \f$ where \f$ op(M) \f$ is \f$ M^T \f$ if `trans` is `true`.
+     */
+    static NPMatrix<T, A> product(const NMatrixView<const T> &a, bool trans_a, const NMatrixView<const T> &b,
+                                  bool trans_b);
+
+    NMatrixView<const T> view() const;
+
+    /**
+     * @brief Viewed matrix with browse indices selecting \f$ A \f$.
+     */
+    const NPMatrix<T, A> &select() const;
+
+    NVector<T, A> &solve(NVector<T, A> &u) const;
+
+    NPMatrix<T, A> &solve(NPMatrix<T, A> &b) const;
+
+    const NPMatrix<T, A> &_matrix;
+
+    size_t _i1, _j1, _i2, _j2;
+};
+
+/** @} */
+
 /**
  * @ingroup NAlgebra
  * @{
@@ -0,0 +1,106 @@
+//
+// Created on 17/10/2026.
+//
+
+#ifndef MATHTOOLKIT_NPRECONDITIONER_H
+#define MATHTOOLKIT_NPRECONDITIONER_H
+
+#include "thirdparty.h"
+#include <NPMatrix.h>
+#include <NSparseMatrix.h>
+
+/**
+ * @ingroup NAlgebra
+ * @{
+ * @class   NPreconditioner
+ * @date    17/10/2026
+ * @brief   Approximation \f$ M \f$ of a matrix \f$ A \f$ whose systems \f$ Mz = r \f$ are cheap to solve.
+ *
+ * @details Used by the solvers of `NKrylov` to reduce the number of iterations. The solve must not modify the
+ *          preconditioner so that it can be shared by concurrent solves.
+ */
+
+template<typename T, typename A = NAlignedAllocator<T>>
+class NPreconditioner {
+
+public:
+
+    virtual ~NPreconditioner() = default;
+
+    /**
+     * @param r vector of dimension \f$ n \f$.
+     * @param z receives \f$ M^{-1} r \f$, has dimension \f$ n \f$ and is distinct from `r`.
+     */
+    virtual void apply(const NVector<T, A> &r, NVector<T, A> &z) const = 0;
+};
+
+/**
+ * @class   NJacobiPreconditioner
+ * @brief   Diagonal preconditioner \f$ M = diag(A) \f$.
+ *
+ * @details Zero coefficients of the diagonal are replaced by `1`.
+ */
+
+template<typename T, typename A = NAlignedAllocator<T>>
+class NJacobiPreconditioner : public NPreconditioner<T, A> {
+
+public:
+
+    /**
+     * @param diag diagonal of \f$ A \f$.
+     */
+    explicit NJacobiPreconditioner(const NVector<T, A> &diag);
+
+    explicit NJacobiPreconditioner(const NPMatrix<T, A> &a);
+
+    explicit NJacobiPreconditioner(const NSparseMatrix<T, A> &a);
+
+    void apply(const NVector<T, A> &r, NVector<T, A> &z) const override;
+
+protected:
+
+    /**
+     * @brief Inverses of the diagonal coefficients.
+     */
+    NVector<T, A> _inv_diag;
+};
+
+/**
+ * @class   NILUPreconditioner
+ * @brief   Incomplete \f$ LU \f$ factorization without fill-in, ILU(0), of a sparse matrix.
+ *
+ * @details \f$ L \f$ and \f$ U \f$ have the sparsity pattern of \f$ A \f$ and are stored in a single
+ *          `NSparseMatrix`, the unit diagonal of \f$ L \f$ being implicit. Computed in \f$ O(nnz^2 / n) \f$ at
+ *          construction. All the diagonal coefficients of \f$ A \f$ must be stored.
+ */
+
+template<typename T, typename A = NAlignedAllocator<T>>
+class NILUPreconditioner : public NPreconditioner<T, A> {
+
+public:
+
+    /**
+     * @param a square sparse matrix with a non-zero diagonal.
+     */
+    explicit NILUPreconditioner(const NSparseMatrix<T, A> &a);
+
+    /**
+     * @brief Matrix storing \f$ L \f$ in its strict lower part and \f$ U \f$ in its upper part.
+     */
+    inline const NSparseMatrix<T, A> &factors() const { return _lu; }
+
+    void apply(const NVector<T, A> &r, NVector<T, A> &z) const override;
+
+protected:
+
+    NSparseMatrix<T, A> _lu;
+
+    /**
+     * @brief Position of the diagonal coefficient of each row in the storage of `_lu`.
+     */
+    vector<size_t> _diag;
+};
+
+/** @} */
+
+#endif //MATHTOOLKIT_NPRECONDITIONER_H
@@ -0,0 +1,140 @@
+//
+// Created on 17/10/2026.
+//
+
+#ifndef MATHTOOLKIT_NQR_H
+#define MATHTOOLKIT_NQR_H
+
+#include "thirdparty.h"
+#include <NPMatrix.h>
+
+/**
+ * @ingroup NAlgebra
+ * @{
+ * @class   NQR
+ * @date    17/10/2026
+ * @brief   Householder \f$ QR \f$ factorization \f$ A = QR \f$ of a \f$ n \times p \f$ matrix with \f$ n \geq p \f$.
+ *
+ * @details The matrix is factorized once at construction using `NBlas::geqrt()`, whose block reflectors make the
+ *          factorization of tall matrices run at the speed of the matrix product. \f$ Q \f$ is never formed : it is
+ *          kept as Householder reflectors and applied to vectors in \f$ O(np) \f$.
+ *
+ *          `leastSquares()` solves overdetermined systems in the least squares sense from \f$ Rx = Q^T b \f$. Unlike
+ *          the normal equations \f$ A^T A x = A^T b \f$, this does not square the condition number of \f$ A \f$.
+ *
+ *          Like `NLU`, the factors are immutable and shared by the copies of a `NQR`, which can be used concurrently
+ *          from several threads.
+ *
+ *          If a diagonal coefficient of \f$ R \f$ is lower than \f$ n \f$ `EPSILON` times the largest one, the matrix is
+ *          considered rank deficient and `isFullRank()` returns `false`. `leastSquares()` requires a full rank matrix,
+ *          it asserts it and leaves its argument unchanged otherwise.
+ *
+ *          Only floating point types are supported, the factorization relies on square roots and on a relative
+ *          rank threshold.
+ *
+ *          @section Definitions
+ *             - `n` : Number of rows of the factorized matrix \f$ A \f$.
+ *             - `p` : Number of columns of the factorized matrix \f$ A \f$.
+ */
+
+template<typename T, typename A = NAlignedAllocator<T>>
+class NQR {
+
+    static_assert(std::is_floating_point<T>::value, "NQR requires a floating point type");
+
+public:
+
+    // CONSTRUCTION
+
+    /**
+     * @param m matrix to factorize with at least as many rows as columns, its browse indices select the block to
+     * factorize.
+     */
+    explicit NQR(const NPMatrix<T, A> &m);
+
+    /**
+     * @param m view on a block to factorize.
+     */
+    explicit NQR(const NMatrixView<const T> &m);
+
+    // GETTERS
+
+    inline size_t n() const { return _n; }
+
+    inline size_t p() const { return _p; }
+
+    inline bool isFullRank() const { return _full_rank; }
+
+    /**
+     * @brief Matrix storing \f$ R \f$ in its upper part and the Householder vectors in its strict lower part.
+     */
+    inline const NPMatrix<T, A> &factors() const { return *_qr; }
+
+    /**
+     * @brief Economy size orthogonal factor, the \f$ n \times p \f$ matrix made of the first columns of \f$ Q \f$.
+     */
+    NPMatrix<T, A> Q() const;
+
+    /**
+     * @brief Upper triangular \f$ p \times p \f$ factor \f$ R \f$.
+     */
+    NPMatrix<T, A> R() const;
+
+    // ALGEBRA
+
+    /**
+     * @param u vector of dimension \f$ n \f$, overwritten with \f$ Q^T u \f$.
+     * @brief Apply \f$ Q^T \f$ in \f$ O(np) \f$.
+     * @return Reference to `u`.
+     */
+    NVector<T, A> &transApply(NVector<T, A> &u) const;
+
+    /**
+     * @param u vector of dimension \f$ n \f$, overwritten with \f$ Q u \f$.
+     * @brief Apply \f$ Q \f$ in \f$ O(np) \f$.
+     * @return Reference to `u`.
+     */
+    NVector<T, A> &apply(NVector<T, A> &u) const;
+
+    /**
+     * @param u right-hand side \f$ b \f$ of dimension \f$ n \f$, replaced by the solution of dimension \f$ p \f$.
+     * @brief Compute \f$ x \f$ minimizing \f$ ||Ax - b|| \f$ in \f$ O(np) \f$.
+     * @details If \f$ n = p \f$, this is the solution of \f$ Ax = b \f$. The matrix must have full rank, check
+     * `isFullRank()` first.
+     * @return Reference to `u`.
+     */
+    NVector<T, A> &leastSquares(NVector<T, A> &u) const;
+
+protected:
+
+    void factorize(const NMatrixView<const T> &m);
+
+    shared_ptr<const NPMatrix<T, A>> _qr{};
+
+    /**
+     * @brief Triangular factors of the block reflectors, see `NBlas::geqrt()`.
+     */
+    shared_ptr<const NPMatrix<T, A>> _t{};
+
+    size_t _n{};
+
+    size_t _p{};
+
+    bool _full_rank{};
+};
+
+/** @} */
+
+template<typename T, typename A>
+template<typename U>
+NQR<U, A> NPMatrix<T, A>::qr() const {
+    return NQR<U, A>(*this);
+}
+
+template<typename T, typename A>
+template<typename U>
+NVector<U, A> &NPMatrix<T, A>::leastSquares(NVector<U, A> &u) const {
+    return qr<U>().leastSquares(u);
+}
+
+#endif //MATHTOOLKIT_NQR_H
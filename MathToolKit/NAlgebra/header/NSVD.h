@@ -0,0 +1,146 @@
+//
+// Created on 17/10/2026.
+//
+
+#ifndef MATHTOOLKIT_NSVD_H
+#define MATHTOOLKIT_NSVD_H
+
+#include "thirdparty.h"
+#include <NPMatrix.h>
+
+/**
+ * Maximum number of sweeps of the one-sided Jacobi algorithm.
+ */
+#define NSVD_MAX_SWEEPS 64
+
+/**
+ * Default number of columns sampled in addition to the rank by the randomized algorithm.
+ */
+#define NSVD_OVERSAMPLING 10
+
+/**
+ * Default number of power iterations of the randomized algorithm.
+ */
+#define NSVD_POWER_ITERATIONS 2
+
+/**
+ * @ingroup NAlgebra
+ * @{
+ * @class   NSVD
+ * @date    17/10/2026
+ * @brief   Singular value decomposition \f$ A \approx U \Sigma V^T \f$ of a \f$ n \times p \f$ matrix, truncated to rank
+ *          \f$ k \f$.
+ *
+ * @details The decomposition is computed once at construction using one of two algorithms :
+ *              - The one-sided Jacobi algorithm computes the thin decomposition of rank \f$ min(n, p) \f$. Plane
+ *              rotations are applied to the columns of \f$ A \f$ until they are orthogonal, their norms being the
+ *              singular values. Tall matrices are first reduced to their \f$ R \f$ factor by `NQR`, so that the
+ *              rotations work on \f$ p \times p \f$ columns. It is accurate, even for the small singular values,
+ *              but costs \f$ O(p^3) \f$ per sweep and is intended for small matrices.
+ *              - The randomized range finder computes \f$ k \f$ singular triplets of large matrices. The range of
+ *              \f$ A \f$ is sampled by the product \f$ Y = A \Omega \f$ with a \f$ p \times (k + oversampling) \f$
+ *              gaussian matrix \f$ \Omega \f$, refined by power iterations \f$ Y = A (A^T Y) \f$ which sharpen the
+ *              decay of the singular values, and orthonormalized into \f$ Q \f$ by `NQR`. The small matrix
+ *              \f$ B = Q^T A \f$ is then decomposed by the Jacobi algorithm and \f$ U = Q U_B \f$. It only requires
+ *              \f$ O(npk) \f$ operations, performed by the matrix product, and never forms the full decomposition.
+ *              The gaussian matrix is drawn from a fixed seed, so that the result is reproducible.
+ *
+ *          The singular values are sorted in descending order. The columns of \f$ U \f$ associated to null singular
+ *          values are null.
+ *
+ *          Only instantiated for real types.
+ *
+ *          @section Definitions
+ *             - `n` : Number of rows of the decomposed matrix \f$ A \f$.
+ *             - `p` : Number of columns of the decomposed matrix \f$ A \f$.
+ *             - `k` : Rank of the decomposition.
+ */
+
+template<typename T, typename A = NAlignedAllocator<T>>
+class NSVD {
+
+public:
+
+    // CONSTRUCTION
+
+    /**
+     * @param m matrix to decompose, its browse indices select the block to decompose.
+     * @brief Thin decomposition of rank \f$ min(n, p) \f$ using the one-sided Jacobi algorithm.
+     */
+    explicit NSVD(const NPMatrix<T, A> &m);
+
+    /**
+     * @param m matrix to decompose, its browse indices select the block to decompose.
+     * @param k rank of the decomposition, \f$ 1 \leq k \leq min(n, p) \f$.
+     * @param power_iterations number of power iterations, more iterations improve the accuracy of the
+     * decomposition of matrices whose singular values decay slowly.
+     * @param oversampling number of columns sampled in addition to \f$ k \f$.
+     * @brief Decomposition of rank \f$ k \f$ using the randomized range finder.
+     */
+    NSVD(const NPMatrix<T, A> &m, size_t k, size_t power_iterations = NSVD_POWER_ITERATIONS,
+         size_t oversampling = NSVD_OVERSAMPLING);
+
+    // GETTERS
+
+    inline size_t n() const { return _u.n(); }
+
+    inline size_t p() const { return _vt.p(); }
+
+    inline size_t k() const { return _u.p(); }
+
+    /**
+     * @brief \f$ n \times k \f$ matrix of the left singular vectors.
+     */
+    inline const NPMatrix<T, A> &U() const { return _u; }
+
+    /**
+     * @brief \f$ k \f$ singular values in descending order.
+     */
+    inline const NVector<T, A> &S() const { return _s; }
+
+    /**
+     * @brief \f$ k \times p \f$ matrix whose rows are the right singular vectors.
+     */
+    inline const NPMatrix<T, A> &Vt() const { return _vt; }
+
+    /**
+     * @brief `false` if the Jacobi algorithm did not converge within `NSVD_MAX_SWEEPS`.
+     */
+    inline bool isConverged() const { return _converged; }
+
+    // ALGEBRA
+
+    /**
+     * @brief Rank \f$ k \f$ approximation \f$ U \Sigma V^T \f$ of the decomposed matrix.
+     */
+    NPMatrix<T, A> approximation() const;
+
+protected:
+
+    /**
+     * @brief Thin decomposition of `m` using the one-sided Jacobi algorithm.
+     */
+    void jacobi(const NMatrixView<const T> &m);
+
+    /**
+     * @param n length of the columns.
+     * @param p number of columns, \f$ p \leq n \f$.
+     * @param g \f$ p \times n \f$ array whose rows are the columns of \f$ A \f$, overwritten with \f$ U \Sigma \f$.
+     * @param v \f$ p \times p \f$ array receiving the columns of \f$ V \f$ in its rows.
+     * @brief Orthogonalize the columns of \f$ A = G V^T \f$ by plane rotations.
+     * @return `false` if the columns are not orthogonal after `NSVD_MAX_SWEEPS`.
+     */
+    static bool rotate(size_t n, size_t p, T *g, T *v);
+
+    NPMatrix<T, A> _u{};
+
+    NVector<T, A> _s{};
+
+    NPMatrix<T, A> _vt{};
+
+    bool _converged{};
+};
+
+/** @} */
+
+#endif //MATHTOOLKIT_NSVD_H
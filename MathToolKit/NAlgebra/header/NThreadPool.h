@@ -0,0 +1,133 @@
+#ifndef MATHTOOLKIT_NTHREADPOOL_H
+#define MATHTOOLKIT_NTHREADPOOL_H
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <exception>
+#include "thirdparty.h"
+
+/**
+ * Minimum number of elements processed by a task in element-wise operations. Below twice this size the operations
+ * are performed serially on the calling thread.
+ */
+#define NTHREADPOOL_MIN_SIZE 32768
+
+/**
+ * Name of the environment variable used to set the initial number of workers.
+ */
+#define NTHREADPOOL_ENV "MATHTOOLKIT_NUM_THREADS"
+
+/**
+ * @ingroup NAlgebra
+ * @{
+ * @class   NThreadPool
+ * @date    17/10/2026
+ * @brief   Library wide pool of worker threads used to parallelize kernels.
+ *
+ * @details The pool is created the first time `instance()` is called and its threads are kept alive until the end of
+ *          the program so that no thread is spawned when an operation is performed.
+ *
+ *          The number of workers counts the calling thread, which always takes part in the computation.
+ *          It defaults to the value of the `MATHTOOLKIT_NUM_THREADS` environment variable if set, else to
+ *          `std::thread::hardware_concurrency()`. It can be changed at any time using `setWorkers()`,
+ *          `setWorkers(1)` disables multithreading.
+ *
+ *          Calling `parallelFor()` from inside a task runs the nested loop serially on the current thread. The pool
+ *          runs a single loop at a time, a loop submitted from another thread while it is busy also runs serially on
+ *          that thread instead of waiting.
+ */
+
+class NThreadPool {
+
+public:
+
+    /**
+     * @brief Unique instance of the pool.
+     */
+    static NThreadPool &instance();
+
+    ~NThreadPool();
+
+    NThreadPool(const NThreadPool &) = delete;
+
+    NThreadPool &operator=(const NThreadPool &) = delete;
+
+    /**
+     * @brief Number of threads taking part to a parallel loop, including the calling thread.
+     */
+    size_t workers() const;
+
+    /**
+     * @param workers new number of workers. `0` is interpreted as `1`.
+     * @brief Resize the pool, joining or spawning background threads.
+     */
+    void setWorkers(size_t workers);
+
+    /**
+     * @param begin first index of the range.
+     * @param end index after the last index of the range.
+     * @param grain minimum number of indices per task.
+     * @param body function called on sub-ranges `[b, e)` of `[begin, end)`.
+     * @brief Split `[begin, end)` in contiguous sub-ranges processed concurrently by the workers.
+     * @details Sub-ranges sizes are multiples of `grain` except for the last one. The range is split in at most
+     * `workers()` sub-ranges. The call returns once all the sub-ranges have been processed.
+     *
+     * If `body` throws, the sub-ranges not yet started are skipped and the first exception thrown is rethrown on the
+     * calling thread once all the workers are done.
+     */
+    void parallelFor(size_t begin, size_t end, size_t grain, const std::function<void(size_t, size_t)> &body);
+
+protected:
+
+    explicit NThreadPool(size_t workers);
+
+    void start(size_t workers);
+
+    void stop();
+
+    void work(size_t generation);
+
+    void runTasks();
+
+    static size_t defaultWorkers();
+
+    std::vector<std::thread> _threads;
+
+    std::atomic<size_t> _workers{};
+
+    std::mutex _submit;
+
+    std::mutex _mutex;
+
+    std::condition_variable _wake;
+
+    std::condition_variable _done;
+
+    // CURRENT JOB
+
+    const std::function<void(size_t, size_t)> *_body{};
+
+    size_t _begin{};
+
+    size_t _end{};
+
+    size_t _chunk{};
+
+    size_t _tasks{};
+
+    std::atomic<size_t> _next{};
+
+    size_t _active{};
+
+    std::exception_ptr _error{};
+
+    size_t _generation{};
+
+    bool _stopped{};
+};
+
+/** @} */
+
+#endif //MATHTOOLKIT_NTHREADPOOL_H
@@ -2,6 +2,10 @@
 #define MATHTOOLKIT_VECTOR_H
 
 #include "thirdparty.h"
+#include <NAlignedAllocator.h>
+#include <NVectorView.h>
+#include <NExpression.h>
+#include <NThreadPool.h>
 
 #define MAX_SIZE 4294967295
 #define EPSILON (std::numeric_limits<T>::epsilon())
@@ -16,11 +20,18 @@
  *
  * @brief   A `NVector<T>` object represents the coordinates of a finite dimension dense vector \f$ x \f$.
  *
- * @details Coordinates are stored in the form `[` \f$ x_0, x_1, ..., x_{(n-1)} \f$ `]`. where `[...]` is a `std::vector<T>`,
+ * @details Coordinates are stored in the form `[` \f$ x_0, x_1, ..., x_{(n-1)} \f$ `]`. where `[...]` is a `std::vector<T, A>`,
  *          \f$ n \f$ is the dimension and \f$ (x_0, x_1, ..., x_{(n-1)}) \f$ are the coordinates.
  *
- *          This object inherits from `std::vector<T>`, it is a STL container, iterators and STL library functions can be
- *          used.
+ *          This object inherits from `std::vector<T, A>`, it is a STL container, iterators and STL library functions can
+ *          be used.
+ *
+ *          @subsection AllocVec Storage allocator
+ *
+ *          The storage is allocated using the allocator `A`, by default a `NAlignedAllocator` which aligns the
+ *          coordinates on 64 bytes. Any standard allocator can be used instead, for example a pool allocator. Methods
+ *          are explicitly instantiated for the default allocator and `std::allocator<double_t>`, other allocators
+ *          require an explicit instantiation in `NVector.cpp`.
  *
  *          @section Features
  *
@@ -38,20 +49,26 @@
  *              - `x`/`u`/`v` : An arbitrary given NVector. By default, \f$ x \f$ denotes `this` vector
  *              - `n`/`dim` : Size of this vector, can be seen as the dimension of the underlying vector space
  *              - `s` : a scalar of type `T`
+ *              - `A` : allocator of the storage
  *              - `k` : index of vector \f$ u_k \f$
  *              - \f$ |.| \f$ : Absolute value, if meaningfull with scalar type `T`
  *
  */
 
 
-template<typename T>
+template<typename T, typename A>
+class NPMatrix;
+
+template<typename T, typename A = NAlignedAllocator<T>>
 
 
-class NVector : public std::vector<T> {
+class NVector : public std::vector<T, A> {
 
-    typedef typename std::vector<T>::iterator iterator;
+    template<typename, typename> friend class NPMatrix;
 
-    typedef typename std::vector<T>::const_iterator const_iterator;
+    typedef typename std::vector<T, A>::iterator iterator;
+
+    typedef typename std::vector<T, A>::const_iterator const_iterator;
 
 
 public:
@@ -65,22 +82,38 @@ public:
     /**
      * @param list `std::initializer_list` source.
      * @brief Construct a vector using an initializer list `{}`.
-     * @details Convert `list` and uses @ref NVector(const std::vector<T> &data) "array constructor".
      */
-    NVector(std::initializer_list<T> list) : NVector(std::vector<T>(list)) {}
+    NVector(std::initializer_list<T> list) : std::vector<T, A>(list) { setDefaultBrowseIndices(); }
 
     /**
      * @param dim vector size
      * @brief Construct a vector of a given size.
      */
-    explicit NVector(size_t dim = 0) : NVector(std::vector<T>((size_t) dim), 0, 0) {}
+    explicit NVector(size_t dim = 0) : std::vector<T, A>(dim) { setDefaultBrowseIndices(); }
 
     /**
      *
      * @param u `NVector` source.
      * @brief Construct a vector by using `copy()` method.
      */
-    NVector(const NVector<T> &u) : NVector(0) { copy(u); }
+    NVector(const NVector<T, A> &u) : NVector(0) { copy(u); }
+
+    /**
+     *
+     * @param u `NVectorView` source.
+     * @brief Construct a vector by copying the coordinates of a view.
+     */
+    explicit NVector(const NVectorView<const T> &u) : NVector(u.dim()) { view().assign(u); }
+
+    explicit NVector(const NVectorView<T> &u) : NVector(NVectorView<const T>(u)) {}
+
+    /**
+     *
+     * @param e `NExpr` source.
+     * @brief Construct a vector by evaluating an expression.
+     */
+    template<typename E>
+    NVector(const NExpr<NVector<T, A>, E> &e) : NVector(e.p()) { e.assignTo(browseView()); }
 
     virtual ~NVector() = default;
 
@@ -112,7 +145,41 @@ public:
      */
     std::vector<T> array() const;
 
-    NVector<T>& resize(size_t n);
+    NVector<T, A>& resize(size_t n);
+
+    /**
+     * @name Views
+     * @brief Non-owning views on the coordinates of the vector.
+     * @details Unlike `operator()(size_t, size_t)`, views ignore and never modify browse indices. For example
+     * `x.view(1, 3)` is a view on \f$ (x_1, x_2, x_3) \f$. See `NVectorView` for more details.
+     * @{
+     */
+
+    inline NVectorView<T> view() { return NVectorView<T>(this->data(), this->size()); }
+
+    inline NVectorView<const T> view() const { return NVectorView<const T>(this->data(), this->size()); }
+
+    inline NVectorView<T> view(size_t k1, size_t k2) {
+        assert(k1 <= k2 && isValidIndex(k2));
+        return NVectorView<T>(this->data() + k1, k2 - k1 + 1);
+    }
+
+    inline NVectorView<const T> view(size_t k1, size_t k2) const {
+        assert(k1 <= k2 && isValidIndex(k2));
+        return NVectorView<const T>(this->data() + k1, k2 - k1 + 1);
+    }
+
+    /**
+     * @brief Leaf of expression on the coordinates selected by browse indices, see `NExpr`.
+     * @details Browse indices are reset.
+     */
+    inline NExpr<NVector<T, A>, NLeafExpr<T>> expr() const {
+        NLeafExpr<T> leaf{NMatrixView<const T>(this->data() + _k1, 1, browseDim())};
+        setDefaultBrowseIndices();
+        return {leaf};
+    }
+
+    /** @} */
 
     /**
      *
@@ -194,7 +261,7 @@ public:
      * @details The vector is set to \f$ (x_0, ..., x_{(k_1 - 1)}, x_{k_2}, ..., x_{(k_2 - 1)}, x_{k_1}, ..., x_{(n-1)}) \f$.
      * \f$ x_{k_1} \f$ and \f$ x_{k_2} \f$ have been swaped used `std::swap`.
      */
-    NVector<T> &swap(size_t k1, size_t k2);
+    NVector<T, A> &swap(size_t k1, size_t k2);
 
     /**
      *
@@ -203,14 +270,14 @@ public:
      * @details If iterations is positive, shift is powered to the left, else to the right.
      * For example `shift(2)` will set \f$ (x_2, x_3, ..., x_{(n-1)}, x_0, x_1) \f$.
      */
-    NVector<T> &shift(long iterations);
+    NVector<T, A> &shift(long iterations);
 
     /**
      *
      * @param s value to fill the vector with
      * @brief Fill vector with a scalar. For example `fill(3)` will set \f$ (3, 3, 3, ..., 3) \f$.
      */
-    NVector<T> &fill(T s);
+    NVector<T, A> &fill(T s);
 
     /** @} */
 
@@ -223,44 +290,77 @@ public:
 
     /**
      * @brief Add two vectors.
-     * @details Using usual addition \f$ (u_0 + v_0, u_1 + v_1, ...) \f$.
-     * @return value of \f$ u + v \f$
+     * @details Using usual addition \f$ (u_0 + v_0, u_1 + v_1, ...) \f$. The sum of two lvalues is evaluated lazily,
+     * see `NExpr`. A temporary operand is reused to store the result.
+     * @return expression or value of \f$ u + v \f$
      */
-    inline friend NVector<T> operator+(NVector<T> u, const NVector<T> &v) {
+    inline friend NExpr<NVector<T, A>, NBinaryExpr<NLeafExpr<T>, NLeafExpr<T>, NAddOp>>
+    operator+(const NVector<T, A> &u, const NVector<T, A> &v) {
+        return {NBinaryExpr<NLeafExpr<T>, NLeafExpr<T>, NAddOp>(u.expr().node(), v.expr().node())};
+    }
+
+    inline friend NVector<T, A> operator+(NVector<T, A> &&u, const NVector<T, A> &v) {
         u += v;
-        return u;
+        return std::move(u);
+    }
+
+    inline friend NVector<T, A> operator+(const NVector<T, A> &u, NVector<T, A> &&v) {
+        v += u;
+        return std::move(v);
+    }
+
+    inline friend NVector<T, A> operator+(NVector<T, A> &&u, NVector<T, A> &&v) {
+        u += v;
+        return std::move(u);
     }
 
     /**
      * @brief Substract two vectors.
      * @details Using usual difference \f$ (u_0 - v_0, u_1 - v_1, ...) \f$.
-     * @return value of \f$ u - v \f$
+     * @return expression or value of \f$ u - v \f$
      */
-    inline friend NVector<T> operator-(NVector<T> u, const NVector<T> &v) {
+    inline friend NExpr<NVector<T, A>, NBinaryExpr<NLeafExpr<T>, NLeafExpr<T>, NSubOp>>
+    operator-(const NVector<T, A> &u, const NVector<T, A> &v) {
+        return {NBinaryExpr<NLeafExpr<T>, NLeafExpr<T>, NSubOp>(u.expr().node(), v.expr().node())};
+    }
+
+    inline friend NVector<T, A> operator-(NVector<T, A> &&u, const NVector<T, A> &v) {
         u -= v;
-        return u;
+        return std::move(u);
+    }
+
+    inline friend NVector<T, A> operator-(const NVector<T, A> &u, NVector<T, A> &&v) {
+        v = u - v;
+        return std::move(v);
+    }
+
+    inline friend NVector<T, A> operator-(NVector<T, A> &&u, NVector<T, A> &&v) {
+        u -= v;
+        return std::move(u);
     }
 
     /**
      * @brief Opposite of vector.
+     * @details The opposite of a vector is computed immediately. The opposite of an expression is lazy.
      * @return value of \f$ (-u_0, -u_1, ...). \f$
      */
-    inline friend NVector<T> operator-(NVector<T> u) {
+    inline friend NVector<T, A> operator-(NVector<T, A> u) {
         u.opp();
         return u;
     }
 
     /**
      * @brief Multiply vector by scalar.
-     * @details Using usual scalar multiplication difference \f$ (s \cdot u_0, s \cdot u_1, ...) \f$.
+     * @details Using usual scalar multiplication difference \f$ (s \cdot u_0, s \cdot u_1, ...) \f$. The product of
+     * a vector is computed immediately so that it can be stored, the product of an expression is lazy.
      * @return value of \f$ s \cdot u \f$
      */
-    inline friend NVector<T> operator*(T s, NVector<T> u) {
+    inline friend NVector<T, A> operator*(T s, NVector<T, A> u) {
         u *= s;
         return u;
     }
 
-    inline friend NVector<T> operator*(const NVector<T> &u, T s) {
+    inline friend NVector<T, A> operator*(const NVector<T, A> &u, T s) {
         return s * u;
     }
 
@@ -269,7 +369,7 @@ public:
      * @details Usual scalar division based on multiplication.
      * @return value of \f$ s^{-1} \cdot u \f$
      */
-    inline friend NVector<T> operator/(NVector<T> u, T s) {
+    inline friend NVector<T, A> operator/(NVector<T, A> u, T s) {
         u /= s;
         return u;
     }
@@ -279,31 +379,45 @@ public:
      * @details Usual inner product \f$ u_0 \cdot v_0 + u_1 \cdot v_1 + ... + u_{(n-1)} \cdot v_{(n-1)} \f$.
      * @return value of \f$ u \cdot v \f$
      */
-    inline friend T operator|(const NVector<T> &u, const NVector<T> &v) { return u.dotProduct(v); }
+    inline friend T operator|(const NVector<T, A> &u, const NVector<T, A> &v) { return u.dotProduct(v); }
 
     /**
      * @brief Norm of the vector.
      * @details The norm of vector \f$ ||u|| = \sqrt{u \cdot u} \f$ derived from dot product.
      * @return value of \f$ ||u|| \f$.
      */
-    inline friend T operator!(const NVector<T> &u) { return u.norm(); }
+    inline friend T operator!(const NVector<T, A> &u) { return u.norm(); }
 
     /**
      * @brief Distance between two vectors.
      * @return value of \f$ ||u - v|| \f$.
      */
-    inline friend T operator/(const NVector<T> &u, const NVector<T> &v) { return u.distance(v); }
+    inline friend T operator/(const NVector<T, A> &u, const NVector<T, A> &v) { return u.distance(v); }
 
 
     /** @} */
 
-    inline NVector<T> &operator+=(const NVector<T> &u) { return add(u); }
+    inline NVector<T, A> &operator+=(const NVector<T, A> &u) { return add(u); }
 
-    inline NVector<T> &operator-=(const NVector<T> &u) { return sub(u); }
+    inline NVector<T, A> &operator-=(const NVector<T, A> &u) { return sub(u); }
 
-    inline virtual NVector<T> &operator*=(T s) { return prod(s); }
+    template<typename E>
+    inline NVector<T, A> &operator+=(const NExpr<NVector<T, A>, E> &e) {
+        e.addTo(browseView());
+        setDefaultBrowseIndices();
+        return *this;
+    }
 
-    inline virtual NVector<T> &operator/=(T s) { return div(s); }
+    template<typename E>
+    inline NVector<T, A> &operator-=(const NExpr<NVector<T, A>, E> &e) {
+        e.subTo(browseView());
+        setDefaultBrowseIndices();
+        return *this;
+    }
+
+    inline virtual NVector<T, A> &operator*=(T s) { return prod(s); }
+
+    inline virtual NVector<T, A> &operator/=(T s) { return div(s); }
 
 
     /**
@@ -344,7 +458,7 @@ public:
      *
      *
      */
-    inline NVector<T> operator()(size_t k1, size_t k2) const { return subVector(k1, k2); }
+    inline NVector<T, A> operator()(size_t k1, size_t k2) const { return subVector(k1, k2); }
 
     /**
      *
@@ -353,7 +467,7 @@ public:
      * except that it sets browse indices `_k1` and `_k2` in order to modify efficiently non `const` reference.
      * @return reference to `*this`.
      */
-    NVector<T> &operator()(size_t k1, size_t k2);
+    NVector<T, A> &operator()(size_t k1, size_t k2);
 
     /** @} */
 
@@ -368,7 +482,7 @@ public:
      * @details Inserts `u.str()` into `os` stream.
      * @return reference to `os`.
      */
-    friend std::ostream &operator<<(std::ostream &os, const NVector<T> &u) {
+    friend std::ostream &operator<<(std::ostream &os, const NVector<T, A> &u) {
         os << u.str();
         return os;
     }
@@ -378,11 +492,28 @@ public:
 
     /**
      *
-     * @param u source `NVector<T>` object
+     * @param u source `NVector<T, A>` object
      * @brief Copy source object on this object using `copy()`.
      * @return reference to `this`.
      */
-    inline NVector<T> &operator=(const NVector<T> &u) { return copy(u); }
+    inline NVector<T, A> &operator=(const NVector<T, A> &u) { return copy(u); }
+
+    /**
+     *
+     * @param e source expression
+     * @brief Evaluate the expression in place.
+     * @details No memory is allocated unless the vector must be resized.
+     * @return reference to `this`.
+     */
+    template<typename E>
+    NVector<T, A> &operator=(const NExpr<NVector<T, A>, E> &e) {
+        if (hasDefaultBrowseIndices() && this->size() != e.p()) {
+            return copy(NVector<T, A>(e));
+        }
+        e.assignTo(browseView());
+        setDefaultBrowseIndices();
+        return *this;
+    }
 
     // NORM BASED COMPARISON OPERATORS
 
@@ -397,7 +528,7 @@ public:
      * @brief Equality of two vectors.
      * @return return true if \f$ ||u - v|| < \epsilon \f$.
      */
-    friend bool operator==(const NVector<T> &u, const NVector<T> &v) {
+    friend bool operator==(const NVector<T, A> &u, const NVector<T, A> &v) {
         bool result = u.isEqual(v);
         return result;
     }
@@ -406,23 +537,23 @@ public:
      * @brief Equality to zero.
      * @return true if `s` is 0 and \f$ u \lt \epsilon \f$.
      */
-    friend bool operator==(const NVector<T> &u, T s) {
+    friend bool operator==(const NVector<T, A> &u, T s) {
         bool res = s < EPSILON && u.isNull();
         u.setDefaultBrowseIndices();
         return res;
     }
 
-    inline friend bool operator==(T s, const NVector<T> &u) { return u == s; }
+    inline friend bool operator==(T s, const NVector<T, A> &u) { return u == s; }
 
     /**
      * @brief Non equality of two vector.
      * @return return true if \f$ ||u - v|| \geq \epsilon \f$.
      */
-    inline friend bool operator!=(const NVector<T> &u, const NVector<T> &v) { return !(u == v); }
+    inline friend bool operator!=(const NVector<T, A> &u, const NVector<T, A> &v) { return !(u == v); }
 
-    inline friend bool operator!=(const NVector<T> &u, T s) { return !(u == s); }
+    inline friend bool operator!=(const NVector<T, A> &u, T s) { return !(u == s); }
 
-    inline friend bool operator!=(T s, const NVector<T> &u) { return !(u == s); }
+    inline friend bool operator!=(T s, const NVector<T, A> &u) { return !(u == s); }
 
     /** @} */
 
@@ -433,13 +564,13 @@ public:
      * @brief Similar iterators as `std::vector` except that they allow use of `operator()()`.
      * @{
      */
-    inline iterator begin() { return this->std::vector<T>::begin() + _k1; };
+    inline iterator begin() { return this->std::vector<T, A>::begin() + _k1; };
 
-    inline const_iterator begin() const { return this->std::vector<T>::begin() + _k1; };
+    inline const_iterator begin() const { return this->std::vector<T, A>::begin() + _k1; };
 
-    inline iterator end() { return this->std::vector<T>::begin() + _k2 + 1; };
+    inline iterator end() { return this->std::vector<T, A>::begin() + _k2 + 1; };
 
-    inline const_iterator end() const { return this->std::vector<T>::begin() + _k2 + 1; };
+    inline const_iterator end() const { return this->std::vector<T, A>::begin() + _k2 + 1; };
 
     /** @} */
 
@@ -450,14 +581,14 @@ public:
      * @param dim dimension of the vector
      * @return a `0` vector \f$ (0, 0, ..., 0) \f$.
      */
-    inline static NVector<T> zeros(size_t dim) { return scalar(0, dim); }
+    inline static NVector<T, A> zeros(size_t dim) { return scalar(0, dim); }
 
     /**
      *
      * @param dim dimension of the vector
      * @return Returns vector filled with `1` \f$ (1, 1, ..., 1) \f$.
      */
-    inline static NVector<T> ones(size_t dim) { return scalar(1, dim); }
+    inline static NVector<T, A> ones(size_t dim) { return scalar(1, dim); }
 
     /**
      *
@@ -465,7 +596,7 @@ public:
      * @param dim dimension of the scalar vector
      * @return a vector filled with `s` \f$ (s, s, ..., s) \f$.
      */
-    static NVector<T> scalar(T s, size_t dim);
+    static NVector<T, A> scalar(T s, size_t dim);
 
     /**
      *
@@ -482,7 +613,7 @@ public:
      *          \end{align*}
      *          \f]
      */
-    static NVector<T> cano(size_t k, size_t dim);
+    static NVector<T, A> cano(size_t k, size_t dim);
 
     /**
      *
@@ -491,7 +622,7 @@ public:
      * @details Sum of the vectors contained in `vectors` array.
      * @return \f$ u + v + ... + x \f$.
      */
-    static NVector<T> sum(const std::vector<NVector> &vectors);
+    static NVector<T, A> sum(const std::vector<NVector> &vectors);
 
     /**
      *
@@ -500,7 +631,7 @@ public:
      * @brief Linear combination of `scalars` and `vectors`.
      * @return  \f$ \alpha u + \beta v + ... + \lambda x \f$.
      */
-    static NVector<T> sumProd(const std::vector<T> &scalars, const std::vector<NVector> &vectors);
+    static NVector<T, A> sumProd(const std::vector<T> &scalars, const std::vector<NVector> &vectors);
     /**
      *
      * @param x start value of the range
@@ -509,7 +640,7 @@ public:
      * @brief Vector with regularly spaced components
      * @return Returns \f$ ( x, x +  h, x + 2h, ..., y) \f$
      */
-    // static NVector<T> linspace(T x, T y, T h) {return NVector<T>();}
+    // static NVector<T, A> linspace(T x, T y, T h) {return NVector<T, A>();}
 
 protected:
 
@@ -517,24 +648,26 @@ protected:
 
     // VECTOR SPACE OPERATIONS
 
-    inline NVector<T> &add(const NVector<T> &u) { return forEach(u, [](T &x, const T &y) { x += y; }); }
+    inline NVector<T, A> &add(const NVector<T, A> &u) { return forEach(u, [](T &x, const T &y) { x += y; }); }
 
-    inline NVector<T> &sub(const NVector<T> &u) { return forEach(u, [](T &x, const T &y) { x -= y; }); }
+    inline NVector<T, A> &sub(const NVector<T, A> &u) { return forEach(u, [](T &x, const T &y) { x -= y; }); }
 
-    inline virtual NVector<T> &opp() { return prod(-1); }
+    inline virtual NVector<T, A> &opp() { return prod(-1); }
 
-    inline virtual NVector<T> &prod(T s) { return forEach(s, [](T &x, T t) { return x *= t; }); }
+    inline virtual NVector<T, A> &prod(T s) { return forEach(s, [](T &x, T t) { return x *= t; }); }
 
-    inline virtual NVector<T> &div(T s) { return forEach(s, [](T &x, T t) { return x /= t; }); }
+    inline virtual NVector<T, A> &div(T s) { return forEach(s, [](T &x, T t) { return x /= t; }); }
 
     // EUCLIDEAN SPACE OPERATIONS
 
-    T dotProduct(const NVector<T> &u) const;
+    T dotProduct(const NVector<T, A> &u) const;
 
-    inline T norm() const { return sqrt(dotProduct(*this)); }
+    inline T norm() const { return T(sqrt(dotProduct(*this))); }
 
-    inline T distance(const NVector<T> &u) const {
-        T d = (*this - u).norm();
+    inline T distance(const NVector<T, A> &u) const {
+        assert(hasSameSize(u));
+
+        T d = T(sqrt(NBlas<T>::dist2(browseDim(), this->data() + _k1, u.data() + u._k1)));
         setDefaultBrowseIndices();
         u.setDefaultBrowseIndices();
         return d;
@@ -548,10 +681,14 @@ protected:
 
     inline bool isNull() const { return norm() <= EPSILON; }
 
-    bool isEqual(const NVector<T> &u) const;
+    bool isEqual(const NVector<T, A> &u) const;
+
 
+    inline bool hasSameSize(const NVector<T, A> &u) const { return _k2 - _k1 == u._k2 - u._k1; }
 
-    inline bool hasSameSize(const NVector<T> &u) const { return _k2 - _k1 == u._k2 - u._k1; }
+    inline size_t browseDim() const { return this->empty() ? 0 : _k2 - _k1 + 1; }
+
+    inline NMatrixView<T> browseView() { return NMatrixView<T>(this->data() + _k1, 1, browseDim()); }
 
     inline virtual bool hasDefaultBrowseIndices() const { return _k1 == 0 && (_k2 == this->size() - 1 || _k2 == 0); }
 
@@ -562,20 +699,51 @@ protected:
 
     // MANIPULATORS
 
-    NVector<T> &forEach(const NVector<T> &u, const std::function<void(T &, const T &)> &binary_op);
+    /**
+     * @brief Apply `binary_op(x_k, u_k)` to each coordinate of the selected sub-range.
+     * @details The callable is a template parameter so that it is inlined in the loop, which lets the compiler
+     * vectorize it. The range is processed by `NThreadPool` in contiguous chunks.
+     */
+    template<typename BinaryOp>
+    NVector<T, A> &forEach(const NVector<T, A> &u, BinaryOp binary_op) {
+        assert(hasSameSize(u));
+
+        T *x = this->data() + _k1;
+        const T *y = u.data() + u._k1;
 
-    virtual NVector<T> &forEach(T s, const std::function<void(T &, T)> &binary_op);
+        NThreadPool::instance().parallelFor(0, browseDim(), NTHREADPOOL_MIN_SIZE, [x, y, binary_op](size_t k1, size_t k2) {
+            for (size_t k = k1; k < k2; ++k) {
+                binary_op(x[k], y[k]);
+            }
+        });
+        setDefaultBrowseIndices();
+        u.setDefaultBrowseIndices();
+        return *this;
+    }
+
+    template<typename BinaryOp>
+    NVector<T, A> &forEach(T s, BinaryOp binary_op) {
+        T *x = this->data() + _k1;
+
+        NThreadPool::instance().parallelFor(0, browseDim(), NTHREADPOOL_MIN_SIZE, [x, s, binary_op](size_t k1, size_t k2) {
+            for (size_t k = k1; k < k2; ++k) {
+                binary_op(x[k], s);
+            }
+        });
+        setDefaultBrowseIndices();
+        return *this;
+    }
 
 
     // AFFECTATION
 
-    NVector<T> &copy(const NVector<T> &u);
+    NVector<T, A> &copy(const NVector<T, A> &u);
 
     //SUB-VECTORS
 
-    NVector<T> subVector(size_t k1, size_t k2) const;
+    NVector<T, A> subVector(size_t k1, size_t k2) const;
 
-    void setSubVector(const NVector<T> &u);
+    void setSubVector(const NVector<T, A> &u);
 
     //BROWSE INDICES
 
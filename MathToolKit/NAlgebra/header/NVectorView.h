@@ -0,0 +1,161 @@
+#ifndef MATHTOOLKIT_NVECTORVIEW_H
+#define MATHTOOLKIT_NVECTORVIEW_H
+
+#include "thirdparty.h"
+#include <type_traits>
+#include <NBlas.h>
+
+/**
+ * @ingroup NAlgebra
+ * @{
+ * @class   NVectorView
+ * @date    17/10/2026
+ * @brief   Non-owning strided view on the coordinates of a vector.
+ *
+ * @details A view is a pointer to the first coordinate \f$ x_0 \f$, a dimension \f$ n \f$ and a stride which is the
+ *          distance between two consecutive coordinates in memory. For example a column of a row-major matrix is a
+ *          view with stride equal to the number of columns.
+ *
+ *          Views are cheap to copy and never allocate. Copying a view does not copy the coordinates, both views refer
+ *          to the same memory. Operations performed on a view modify the viewed object in place.
+ *
+ *          A `NVectorView<const T>` is a read-only view. Read-only views do not hold any mutable state so they can be
+ *          used concurrently by several threads. A `NVectorView<T>` converts implicitly to `NVectorView<const T>`.
+ *
+ *          The viewed memory must outlive the view. Resizing the viewed `NVector` invalidates its views.
+ */
+
+template<typename T>
+class NVectorView {
+
+public:
+
+    typedef typename std::remove_const<T>::type scalar_t;
+
+    /**
+     * @param data pointer to the first coordinate.
+     * @param dim dimension of the view.
+     * @param stride distance between two consecutive coordinates.
+     * @brief Construct a view on raw memory.
+     */
+    explicit NVectorView(T *data = nullptr, size_t dim = 0, size_t stride = 1) :
+            _data(data), _dim(dim), _stride(stride) {}
+
+    /**
+     * @brief Construct a read-only view from a mutable view.
+     */
+    template<typename U, typename = typename std::enable_if<std::is_convertible<U *, T *>::value>::type>
+    NVectorView(const NVectorView<U> &u) : _data(u.data()), _dim(u.dim()), _stride(u.stride()) {}
+
+    // GETTERS
+
+    inline T *data() const { return _data; }
+
+    inline size_t dim() const { return _dim; }
+
+    inline size_t stride() const { return _stride; }
+
+    inline bool isContiguous() const { return _stride == 1; }
+
+    // ACCESS
+
+    /**
+     * @brief Access to coordinate \f$ x_k \f$.
+     */
+    inline T &operator()(size_t k) const {
+        assert(k < _dim);
+        return _data[k * _stride];
+    }
+
+    /**
+     * @brief View on the sub-range \f$ (x_{k_1}, ..., x_{k_2}) \f$.
+     */
+    inline NVectorView<T> operator()(size_t k1, size_t k2) const {
+        assert(k1 <= k2 && k2 < _dim);
+        return NVectorView<T>(_data + k1 * _stride, k2 - k1 + 1, _stride);
+    }
+
+    // ALGEBRA
+
+    /**
+     * @name Algebra
+     * @brief In place operations on the viewed coordinates.
+     * @details Only available on mutable views. Operands must have the same dimension.
+     * @{
+     */
+
+    inline NVectorView<T> &operator+=(const NVectorView<const scalar_t> &u) {
+        return forEach(u, [](scalar_t &x, const scalar_t &y) { x += y; });
+    }
+
+    inline NVectorView<T> &operator-=(const NVectorView<const scalar_t> &u) {
+        return forEach(u, [](scalar_t &x, const scalar_t &y) { x -= y; });
+    }
+
+    inline NVectorView<T> &operator*=(scalar_t s) { return forEach([s](scalar_t &x) { x *= s; }); }
+
+    inline NVectorView<T> &operator/=(scalar_t s) { return forEach([s](scalar_t &x) { x /= s; }); }
+
+    inline NVectorView<T> &fill(scalar_t s) { return forEach([s](scalar_t &x) { x = s; }); }
+
+    /**
+     * @brief Copy the coordinates of `u` into the viewed coordinates.
+     */
+    inline NVectorView<T> &assign(const NVectorView<const scalar_t> &u) {
+        return forEach(u, [](scalar_t &x, const scalar_t &y) { x = y; });
+    }
+
+    /** @} */
+
+    /**
+     * @brief Dot product \f$ x \cdot u \f$.
+     * @details Uses `NBlas::dot()` when both views are contiguous.
+     */
+    scalar_t dot(const NVectorView<const scalar_t> &u) const {
+        assert(_dim == u.dim());
+
+        if (isContiguous() && u.isContiguous()) {
+            return NBlas<scalar_t>::dot(_dim, _data, u.data());
+        }
+        scalar_t dot = 0;
+        for (size_t k = 0; k < _dim; ++k) {
+            dot += _data[k * _stride] * u.data()[k * u.stride()];
+        }
+        return dot;
+    }
+
+    inline scalar_t norm() const {
+        using std::sqrt;
+        return sqrt(dot(*this));
+    }
+
+protected:
+
+    template<typename BinaryOp>
+    NVectorView<T> &forEach(const NVectorView<const scalar_t> &u, BinaryOp binary_op) {
+        assert(_dim == u.dim());
+
+        for (size_t k = 0; k < _dim; ++k) {
+            binary_op(_data[k * _stride], u.data()[k * u.stride()]);
+        }
+        return *this;
+    }
+
+    template<typename UnaryOp>
+    NVectorView<T> &forEach(UnaryOp unary_op) {
+        for (size_t k = 0; k < _dim; ++k) {
+            unary_op(_data[k * _stride]);
+        }
+        return *this;
+    }
+
+    T *_data;
+
+    size_t _dim;
+
+    size_t _stride;
+};
+
+/** @} */
+
+#endif //MATHTOOLKIT_NVECTORVIEW_H
@@ -1,7 +1,7 @@
 #ifndef MATHTOOLKIT_VECTOR3_H
 #define MATHTOOLKIT_VECTOR3_H
 
-#include <NVector.h>
+#include <NFixedVector.h>
 
 /**
  * @ingroup NAlgebra
@@ -41,26 +41,27 @@
  *            setting components generally implies a constant time calculation to translate between cartesian
  *            and other formats.
  *
- *            The `Vector3` class doesn't support function operator `NVector::operator()()`.
+ *            The coordinates are stored inline in a `NFixedVector`, a `Vector3` is 24 bytes and an array of
+ *            vectors is a single contiguous block. Use `vector()` to get a `NVector`.
  *
  */
 
-class Vector3 : public NVector<double_t> {
+class Vector3 : public NFixedVector<double_t, 3> {
 public:
 
-    using NVector::operator=;
+    explicit Vector3(double_t x = 0, double_t y = 0, double_t z = 0) : NFixedVector({x, y, z}) {}
 
-    using NVector::NVector;
+    Vector3(const NFixedVector<double_t, 3> &u) : NFixedVector(u) {}
 
-    explicit Vector3(double_t x = 0, double_t y = 0, double_t z = 0) : NVector(3) { setXYZ(x, y, z); }
+    Vector3(const NVector<double_t> &u) : NFixedVector(u) {}
 
     //3D COORDINATES GETTERS
 
-    inline double_t x() const { return (*this)[0]; }
+    inline double_t x() const { return _data[0]; }
 
-    inline double_t y() const { return (*this)[1]; }
+    inline double_t y() const { return _data[1]; }
 
-    inline double_t z() const { return (*this)[2]; }
+    inline double_t z() const { return _data[2]; }
 
     inline double_t r() const { return !(*this); };
 
@@ -72,11 +73,11 @@ public:
 
     //3D COORDINATES SETTERS
 
-    inline void setX(double_t scalar) { (*this)[0] = scalar; }
+    inline void setX(double_t scalar) { _data[0] = scalar; }
 
-    inline void setY(double_t scalar) { (*this)[1] = scalar; }
+    inline void setY(double_t scalar) { _data[1] = scalar; }
 
-    inline void setZ(double_t scalar) { (*this)[2] = scalar; }
+    inline void setZ(double_t scalar) { _data[2] = scalar; }
 
     inline void setR(double_t scalar) { setRThetaPhi(scalar, theta(), phi()); }
 
@@ -85,9 +86,9 @@ public:
     inline void setPhi(double_t scalar) { setRThetaPhi(r(), theta(), scalar); }
 
     inline void setXYZ(double_t x, double_t y, double_t z) {
-        (*this)[0] = x;
-        (*this)[1] = y;
-        (*this)[2] = z;
+        _data[0] = x;
+        _data[1] = y;
+        _data[2] = z;
     };
 
     inline void setRThetaZ(double_t r, double_t theta, double_t z) {
@@ -113,7 +114,7 @@ public:
     }
 
     inline friend Vector3 operator-(Vector3 u) {
-        u.opp();
+        u *= -1;
         return u;
     }
 
@@ -165,13 +166,13 @@ public:
 
     inline Vector3& operator ^=(const Vector3 &u) {return cross(u);}
 
-    inline static Vector3 zeros() {return Vector3(NVector::zeros(3));}
+    inline static Vector3 zeros() {return Vector3(NFixedVector::zeros());}
 
-    inline static Vector3 ones() {return Vector3(NVector::ones(3));}
+    inline static Vector3 ones() {return Vector3(NFixedVector::ones());}
 
-    inline static Vector3 scalar(double_t scalar) {return Vector3(NVector::scalar(scalar, 3));}
+    inline static Vector3 scalar(double_t scalar) {return Vector3(NFixedVector::scalar(scalar));}
 
-    inline static Vector3 cano(size_t k) {return Vector3(NVector::cano(k, 3));}
+    inline static Vector3 cano(size_t k) {return Vector3(NFixedVector::cano(k));}
 
 
 protected:
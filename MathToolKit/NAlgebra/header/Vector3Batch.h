@@ -0,0 +1,167 @@
+//
+// Created on 17/10/2026.
+//
+
+#ifndef MATHTOOLKIT_VECTOR3BATCH_H
+#define MATHTOOLKIT_VECTOR3BATCH_H
+
+#include "thirdparty.h"
+#include <Vector3.h>
+
+/**
+ * @ingroup NAlgebra
+ * @{
+ * @class   Vector3Batch
+ * @date    17/10/2026
+ * @brief   Array of 3D vectors stored as a structure of arrays.
+ *
+ * @details The `x`, `y` and `z` coordinates of the vectors are stored in three separate aligned arrays, so that the
+ *          operations of `Vector3` applied to all the vectors of the batch load consecutive coordinates in a
+ *          single instruction. Dot and vector products, norms and normalization use the kernels of `NCpu` and
+ *          process 2, 4 or 8 vectors per instruction depending on the instruction set. Large batches are split
+ *          between the workers of `NThreadPool`.
+ *
+ *          The spherical and cylindrical conversions call the trigonometric functions of the standard library on
+ *          each vector and only benefit from the contiguous storage.
+ *
+ *          The results of the operations giving a scalar per vector are written in a `vec_t` of dimension
+ *          `size()`, resized if it has a different dimension. The semantic of the operations is the one of
+ *          `Vector3`, in particular the angle with a null vector is `0`.
+ *
+ *          @section Definitions
+ *             - `size` : Number of vectors of the batch.
+ */
+
+class Vector3Batch {
+
+public:
+
+    // CONSTRUCTION
+
+    /**
+     * @param size number of vectors, initialized to zero.
+     */
+    explicit Vector3Batch(size_t size = 0);
+
+    explicit Vector3Batch(const std::vector<Vector3> &vectors);
+
+    // GETTERS
+
+    inline size_t size() const { return _x.size(); }
+
+    inline const double_t *x() const { return _x.data(); }
+
+    inline double_t *x() { return _x.data(); }
+
+    inline const double_t *y() const { return _y.data(); }
+
+    inline double_t *y() { return _y.data(); }
+
+    inline const double_t *z() const { return _z.data(); }
+
+    inline double_t *z() { return _z.data(); }
+
+    /**
+     * @param r receives the norms \f$ r_k \f$ of the vectors.
+     * @return Reference to `r`.
+     */
+    vec_t &r(vec_t &r) const;
+
+    vec_t &theta(vec_t &theta) const;
+
+    vec_t &phi(vec_t &phi) const;
+
+    // SETTERS
+
+    /**
+     * @brief Change the number of vectors, the new vectors are set to zero.
+     */
+    void resize(size_t size);
+
+    inline void set(size_t k, const Vector3 &u) {
+        assert(k < size());
+        _x[k] = u.x();
+        _y[k] = u.y();
+        _z[k] = u.z();
+    }
+
+    void append(const Vector3 &u);
+
+    /**
+     * @brief Set the vectors from their cylindrical coordinates, see `Vector3::setRThetaZ()`.
+     * @details The batch is resized to the dimension of the coordinates.
+     */
+    void setRThetaZ(const vec_t &r, const vec_t &theta, const vec_t &z);
+
+    /**
+     * @brief Set the vectors from their spherical coordinates, see `Vector3::setRThetaPhi()`.
+     * @details The batch is resized to the dimension of the coordinates.
+     */
+    void setRThetaPhi(const vec_t &r, const vec_t &theta, const vec_t &phi);
+
+    // CONVERSION
+
+    std::vector<Vector3> vectors() const;
+
+    std::string str() const;
+
+    // ALGEBRA
+
+    /**
+     * @param v batch of the same size.
+     * @param d receives the dot products \f$ u_k \cdot v_k \f$.
+     * @return Reference to `d`.
+     */
+    vec_t &dotProduct(const Vector3Batch &v, vec_t &d) const;
+
+    /**
+     * @brief Compute \f$ u_k \leftarrow u_k \times v_k \f$ for each vector.
+     * @return Reference to `this`.
+     */
+    Vector3Batch &cross(const Vector3Batch &v);
+
+    /**
+     * @brief Divide each non-null vector by its norm, null vectors are left unchanged.
+     * @return Reference to `this`.
+     */
+    Vector3Batch &normalize();
+
+    /**
+     * @param angle receives the angles between \f$ u_k \f$ and \f$ v_k \f$, see `Vector3::operator%()`.
+     * @return Reference to `angle`.
+     */
+    vec_t &angle(const Vector3Batch &v, vec_t &angle) const;
+
+    // OPERATORS
+
+    inline Vector3 operator[](size_t k) const { return Vector3(_x[k], _y[k], _z[k]); }
+
+    inline Vector3Batch &operator^=(const Vector3Batch &v) { return cross(v); }
+
+    inline friend Vector3Batch operator^(Vector3Batch u, const Vector3Batch &v) { return u.cross(v); }
+
+    inline friend vec_t operator|(const Vector3Batch &u, const Vector3Batch &v) {
+        vec_t d(u.size());
+        return u.dotProduct(v, d);
+    }
+
+    inline friend vec_t operator!(const Vector3Batch &u) {
+        vec_t r(u.size());
+        return u.r(r);
+    }
+
+    inline friend vec_t operator%(const Vector3Batch &u, const Vector3Batch &v) {
+        vec_t angle(u.size());
+        return u.angle(v, angle);
+    }
+
+    friend std::ostream &operator<<(std::ostream &os, const Vector3Batch &u) { return os << u.str(); }
+
+protected:
+
+    std::vector<double_t, NAlignedAllocator<double_t>> _x, _y, _z;
+};
+
+/** @} */
+
+#endif //MATHTOOLKIT_VECTOR3BATCH_H
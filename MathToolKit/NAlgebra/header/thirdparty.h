@@ -9,6 +9,7 @@
 #include <string>
 #include <sstream>
 #include <cmath>
+#include <limits>
 #include <vector>
 #include <cstdarg>
 #include <cassert>
@@ -25,7 +25,7 @@ AESByte &AESByte::prod(const AESByte &b) {
     return *this;
 }
 
-AESByte &AESByte::div(const AESByte &b) {
+AESByte &AESByte::div(const AESByte &/* b */) {
     // TODO : Implement real div computing algorithm on GF(2⁸)
     return *this;
 }
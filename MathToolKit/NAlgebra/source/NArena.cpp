@@ -0,0 +1,97 @@
+//
+// Created on 17/10/2026.
+//
+
+#include <NArena.h>
+#include <cstdlib>
+
+using namespace std;
+
+NArena &NArena::local() {
+    static thread_local NArena arena;
+    return arena;
+}
+
+NArena::NArena() {
+    reserve(NARENA_INITIAL_CAPACITY);
+}
+
+NArena::~NArena() {
+    for (auto &overflow : _overflows) {
+        free(overflow.first);
+    }
+    free(_block);
+}
+
+// ALLOCATION
+
+void *NArena::allocate(size_t size, size_t alignment) {
+    assert((alignment & (alignment - 1)) == 0 && alignment <= NALIGNED_ALLOCATOR_ALIGNMENT);
+
+    ++_allocations;
+    size_t offset = (_offset + alignment - 1) & ~(alignment - 1);
+
+    void *ptr;
+    if (_overflows.empty() && offset <= _capacity && size <= _capacity - offset) {
+        ptr = _block + offset;
+        _offset = offset + size;
+    } else {
+        ptr = heapAllocate(size);
+        _overflows.emplace_back(ptr, size + alignment);
+        _overflow_size += size + alignment;
+    }
+
+    _peak = max(_peak, used());
+    return ptr;
+}
+
+NArena::Mark NArena::mark() {
+    ++_depth;
+    return Mark{_offset, _overflows.size()};
+}
+
+void NArena::rewind(const Mark &mark) {
+    assert(_depth > 0 && mark.offset <= _offset && mark.overflows <= _overflows.size());
+
+    --_depth;
+    while (_overflows.size() > mark.overflows) {
+        free(_overflows.back().first);
+        _overflow_size -= _overflows.back().second;
+        _overflows.pop_back();
+    }
+    _offset = mark.offset;
+
+    if (_depth == 0 && _offset == 0 && _peak > _capacity && _capacity < NARENA_MAX_CAPACITY) {
+        reserve(min(_peak, (size_t) NARENA_MAX_CAPACITY));
+    }
+}
+
+void NArena::trim() {
+    if (_depth > 0) {
+        return;
+    }
+    _peak = 0;
+    if (_capacity > NARENA_INITIAL_CAPACITY) {
+        reserve(NARENA_INITIAL_CAPACITY);
+    }
+}
+
+// PROTECTED METHODS
+
+void *NArena::heapAllocate(size_t size) {
+    void *ptr = nullptr;
+    if (posix_memalign(&ptr, NALIGNED_ALLOCATOR_ALIGNMENT, max(size, (size_t) 1)) != 0) {
+        throw bad_alloc();
+    }
+    ++_heap_allocations;
+    return ptr;
+}
+
+void NArena::reserve(size_t capacity) {
+    capacity = (capacity + NALIGNED_ALLOCATOR_ALIGNMENT - 1) & ~((size_t) NALIGNED_ALLOCATOR_ALIGNMENT - 1);
+    free(_block);
+    _block = nullptr;
+    _capacity = 0;
+    _block = static_cast<char *>(heapAllocate(capacity));
+    _capacity = capacity;
+}
@@ -0,0 +1,181 @@
+//
+// Created on 17/10/2026.
+//
+
+#include <NBandMatrix.h>
+#include <NBlas.h>
+#include <NArena.h>
+
+using namespace std;
+
+// CONSTRUCTION
+
+template<typename T, typename A>
+NBandMatrix<T, A>::NBandMatrix(size_t n, size_t kl, size_t ku) :
+        _n(n), _kl(kl), _ku(ku),
+        _data(n * (kl + ku + 1), T(0)) {}
+
+template<typename T, typename A>
+NBandMatrix<T, A>::NBandMatrix(const NPMatrix<T, A> &m, size_t kl, size_t ku) :
+        NBandMatrix(m.n(), kl, ku) {
+    assert(m.isSquare());
+
+    for (size_t i = 0; i < _n; ++i) {
+        size_t j1 = (i > _kl) ? i - _kl : 0, j2 = min(_n, i + _ku + 1);
+        for (size_t j = j1; j < j2; ++j) {
+            (*this)(i, j) = m(i, j);
+        }
+    }
+}
+
+template<typename T, typename A>
+NBandMatrix<T, A>::NBandMatrix(const NPMatrix<T, A> &m) :
+        NBandMatrix(m.n()) {
+    assert(m.isSquare());
+
+    size_t kl = 0, ku = 0;
+    for (size_t i = 0; i < _n; ++i) {
+        for (size_t j = 0; j < _n; ++j) {
+            if (m(i, j) != T(0)) {
+                kl = (i > j) ? max(kl, i - j) : kl;
+                ku = (j > i) ? max(ku, j - i) : ku;
+            }
+        }
+    }
+    *this = NBandMatrix<T, A>(m, kl, ku);
+}
+
+// CONVERSION
+
+template<typename T, typename A>
+NPMatrix<T, A> NBandMatrix<T, A>::dense() const {
+    NPMatrix<T, A> res = NPMatrix<T, A>::zeros(_n);
+
+    for (size_t i = 0; i < _n; ++i) {
+        size_t j1 = (i > _kl) ? i - _kl : 0, j2 = min(_n, i + _ku + 1);
+        for (size_t j = j1; j < j2; ++j) {
+            res(i, j) = (*this)(i, j);
+        }
+    }
+    return res;
+}
+
+template<typename T, typename A>
+string NBandMatrix<T, A>::str() const {
+    return dense().str();
+}
+
+// ALGEBRA
+
+template<typename T, typename A>
+NVector<T, A> &NBandMatrix<T, A>::product(const NVector<T, A> &x, NVector<T, A> &y) const {
+    assert(x.dim() == _n && &x != &y);
+
+    if (y.dim() != _n) {
+        y = NVector<T, A>(_n);
+    }
+    NBlas<T>::gbmv(_n, _kl, _ku, _data.data(), ld(), x.data(), y.data());
+    return y;
+}
+
+template<typename T, typename A>
+NVector<T, A> &NBandMatrix<T, A>::solve(NVector<T, A> &u) const {
+    assert(u.dim() == _n);
+
+    if (_kl == 1 && _ku == 1 && isDiagonallyDominant() && NBlas<T>::gtsv(_n, _data.data(), ld(), u.data())) {
+        return u;
+    }
+
+    NArenaScope scope;
+    const size_t ldab = 2 * _kl + _ku + 1;
+    vector<T, NArenaAllocator<T>> ab(_n * ldab);
+    vector<size_t, NArenaAllocator<size_t>> ipiv(_n);
+
+    for (size_t i = 0; i < _n; ++i) {
+        std::copy(_data.data() + i * ld(), _data.data() + (i + 1) * ld(), ab.data() + i * ldab);
+    }
+
+    if (NBlas<T>::gbtrf(_n, _kl, _ku, ab.data(), ldab, ipiv.data())) {
+        NBlas<T>::gbtrs(_n, _kl, _ku, ab.data(), ldab, ipiv.data(), u.data());
+    }
+    return u;
+}
+
+template<typename T, typename A>
+T NBandMatrix<T, A>::det() const {
+    NArenaScope scope;
+    const size_t ldab = 2 * _kl + _ku + 1;
+    vector<T, NArenaAllocator<T>> ab(_n * ldab);
+    vector<size_t, NArenaAllocator<size_t>> ipiv(_n);
+
+    for (size_t i = 0; i < _n; ++i) {
+        std::copy(_data.data() + i * ld(), _data.data() + (i + 1) * ld(), ab.data() + i * ldab);
+    }
+
+    if (!NBlas<T>::gbtrf(_n, _kl, _ku, ab.data(), ldab, ipiv.data())) {
+        return T(0);
+    }
+
+    T det = T(1);
+    for (size_t k = 0; k < _n; ++k) {
+        det *= (ipiv[k] != k) ? -ab[k * ldab + _kl] : ab[k * ldab + _kl];
+    }
+    return det;
+}
+
+// STATIC GENERATORS
+
+template<typename T, typename A>
+NBandMatrix<T, A> NBandMatrix<T, A>::ndiag(const vector<NVector<T, A>> &data) {
+    const size_t middle = (data.size() - 1) / 2, dim = data[middle].dim();
+    NBandMatrix<T, A> diag(dim, middle, middle);
+
+    for (size_t l = 0; l <= middle; ++l) {
+        for (size_t k = 0; k + l < dim; ++k) {
+            diag(k + l, k) = data[middle - l](k);
+            diag(k, k + l) = data[middle + l](k);
+        }
+    }
+    return diag;
+}
+
+template<typename T, typename A>
+NBandMatrix<T, A> NBandMatrix<T, A>::nscalar(const vector<T> &scalars, size_t n) {
+    const size_t m = min(scalars.size() - 1, (n > 0) ? n - 1 : 0);
+    NBandMatrix<T, A> res(n, m, m);
+
+    for (size_t i = 0; i < n; ++i) {
+        size_t j1 = (i > m) ? i - m : 0, j2 = min(n, i + m + 1);
+        for (size_t j = j1; j < j2; ++j) {
+            res(i, j) = scalars[scalars.size() - 1 - ((i > j) ? i - j : j - i)];
+        }
+    }
+    return res;
+}
+
+// PROTECTED METHODS
+
+template<typename T, typename A>
+bool NBandMatrix<T, A>::isDiagonallyDominant() const {
+    assert(_kl == 1 && _ku == 1);
+
+    for (size_t i = 0; i < _n; ++i) {
+        T off = T(0);
+        if (i > 0) {
+            off += abs((*this)(i, i - 1));
+        }
+        if (i + 1 < _n) {
+            off += abs((*this)(i, i + 1));
+        }
+        if (off > abs((*this)(i, i))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template
+class NBandMatrix<double_t>;
+
+template
+class NBandMatrix<double_t, std::allocator<double_t>>;
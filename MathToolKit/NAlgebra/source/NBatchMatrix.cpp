@@ -0,0 +1,273 @@
+//
+// Created on 17/10/2026.
+//
+
+#include <NBatchMatrix.h>
+#include <NBlas.h>
+#include <NArena.h>
+#include <NThreadPool.h>
+
+using namespace std;
+
+/**
+ * Number of groups processed by a task of `NThreadPool` when each group requires `ops` multiply-add operations.
+ */
+static inline size_t groupGrain(size_t ops) {
+    return max((size_t) 1, NBLAS_PARALLEL_MIN_OPS / max(ops * NBATCHMATRIX_LANES, (size_t) 1));
+}
+
+// CONSTRUCTION
+
+template<typename T, typename A>
+NBatchMatrix<T, A>::NBatchMatrix(size_t count, size_t n, size_t p) :
+        _count(count), _n(n), _p(p), _data(groups() * n * p * NBATCHMATRIX_LANES, T(0)) {
+    for (size_t k = count; n == p && k < groups() * NBATCHMATRIX_LANES; ++k) {
+        for (size_t i = 0; i < n; ++i) {
+            _data[index(k, i, i)] = T(1);
+        }
+    }
+}
+
+template<typename T, typename A>
+NBatchMatrix<T, A>::NBatchMatrix(const vector<NPMatrix<T, A>> &matrices) :
+        NBatchMatrix(matrices.size(), matrices.front().n(), matrices.front().p()) {
+    for (size_t k = 0; k < matrices.size(); ++k) {
+        setMatrix(k, matrices[k]);
+    }
+}
+
+// GETTERS
+
+template<typename T, typename A>
+NPMatrix<T, A> NBatchMatrix<T, A>::matrix(size_t k) const {
+    NPMatrix<T, A> m(_n, _p);
+    for (size_t i = 0; i < _n; ++i) {
+        for (size_t j = 0; j < _p; ++j) {
+            m(i, j) = (*this)(k, i, j);
+        }
+    }
+    return m;
+}
+
+// SETTERS
+
+template<typename T, typename A>
+void NBatchMatrix<T, A>::setMatrix(size_t k, const NPMatrix<T, A> &m) {
+    assert(m.n() == _n && m.p() == _p);
+    for (size_t i = 0; i < _n; ++i) {
+        for (size_t j = 0; j < _p; ++j) {
+            (*this)(k, i, j) = m(i, j);
+        }
+    }
+}
+
+// CONVERSION
+
+template<typename T, typename A>
+string NBatchMatrix<T, A>::str() const {
+    stringstream stream;
+
+    for (size_t k = 0; k < _count; ++k) {
+        stream << matrix(k) << endl;
+    }
+    return stream.str();
+}
+
+// ALGEBRA
+
+template<typename T, typename A>
+bool NBatchMatrix<T, A>::solveBatched(NBatchMatrix<T, A> &b) const {
+    assert(_n == _p && b.count() == _count && b.n() == _n);
+    atomic<bool> regular{true};
+
+    NThreadPool::instance().parallelFor(0, groups(), groupGrain(_n * _n * (_n + b.p())), [&](size_t g1, size_t g2) {
+        for (size_t g = g1; g < g2; ++g) {
+            if (!eliminate(g, b.p(), b.data(), false, nullptr)) {
+                regular = false;
+            }
+        }
+    });
+    return regular;
+}
+
+template<typename T, typename A>
+NVector<T, A> &NBatchMatrix<T, A>::detBatched(NVector<T, A> &dets) const {
+    assert(_n == _p);
+    if (dets.dim() != _count) {
+        dets.resize(_count);
+    }
+
+    NThreadPool::instance().parallelFor(0, groups(), groupGrain(_n * _n * _n), [&](size_t g1, size_t g2) {
+        for (size_t g = g1; g < g2; ++g) {
+            eliminate(g, 0, nullptr, false, dets.data());
+        }
+    });
+    return dets;
+}
+
+template<typename T, typename A>
+bool NBatchMatrix<T, A>::invBatched(NBatchMatrix<T, A> &inv) const {
+    assert(_n == _p);
+    fit(inv, _n);
+    atomic<bool> regular{true};
+
+    NThreadPool::instance().parallelFor(0, groups(), groupGrain(2 * _n * _n * _n), [&](size_t g1, size_t g2) {
+        for (size_t g = g1; g < g2; ++g) {
+            if (!eliminate(g, _n, inv.data(), true, nullptr)) {
+                regular = false;
+            }
+        }
+    });
+    return regular;
+}
+
+template<typename T, typename A>
+NBatchMatrix<T, A> &NBatchMatrix<T, A>::gemmBatched(const NBatchMatrix<T, A> &b, NBatchMatrix<T, A> &c) const {
+    const size_t q = b.p(), lanes = NBATCHMATRIX_LANES;
+    assert(b.count() == _count && b.n() == _p && &c != this && &c != &b);
+    fit(c, q);
+
+    NThreadPool::instance().parallelFor(0, groups(), groupGrain(_n * _p * q), [&](size_t g1, size_t g2) {
+        for (size_t g = g1; g < g2; ++g) {
+            const T *a_g = data() + g * _n * _p * lanes, *b_g = b.data() + g * _p * q * lanes;
+            T *c_g = c.data() + g * _n * q * lanes;
+
+            std::fill(c_g, c_g + _n * q * lanes, T(0));
+            for (size_t i = 0; i < _n; ++i) {
+                T *c_i = c_g + i * q * lanes;
+                for (size_t k = 0; k < _p; ++k) {
+                    const T *a_ik = a_g + (i * _p + k) * lanes, *b_k = b_g + k * q * lanes;
+                    for (size_t j = 0; j < q; ++j) {
+                        for (size_t l = 0; l < lanes; ++l) {
+                            c_i[j * lanes + l] += a_ik[l] * b_k[j * lanes + l];
+                        }
+                    }
+                }
+            }
+        }
+    });
+    return c;
+}
+
+// PROTECTED METHODS
+
+template<typename T, typename A>
+void NBatchMatrix<T, A>::fit(NBatchMatrix<T, A> &m, size_t p) const {
+    if (m.count() != _count || m.n() != _n || m.p() != p) {
+        m = NBatchMatrix<T, A>(_count, _n, p);
+    }
+}
+
+template<typename T, typename A>
+bool NBatchMatrix<T, A>::eliminate(size_t g, size_t q, T *b, bool identity, T *dets) const {
+    const size_t n = _n, lanes = NBATCHMATRIX_LANES, count = min(lanes, _count - g * lanes);
+    const T *a_g = data() + g * n * n * lanes;
+
+    NArenaScope scope;
+    vector<T, NArenaAllocator<T>> a(a_g, a_g + n * n * lanes), x(n * q * lanes, T(0)), inv_pivot(n * lanes);
+    T det[NBATCHMATRIX_LANES], best[NBATCHMATRIX_LANES], factor[NBATCHMATRIX_LANES];
+    size_t pivot[NBATCHMATRIX_LANES];
+    bool singular[NBATCHMATRIX_LANES];
+
+    if (identity) {
+        for (size_t i = 0; i < n; ++i) {
+            std::fill(x.begin() + (i * q + i) * lanes, x.begin() + (i * q + i + 1) * lanes, T(1));
+        }
+    } else if (b != nullptr) {
+        std::copy(b + g * n * q * lanes, b + (g + 1) * n * q * lanes, x.begin());
+    }
+    std::fill(det, det + lanes, T(1));
+    std::fill(singular, singular + lanes, false);
+
+    for (size_t k = 0; k < n; ++k) {
+        const T *a_k = a.data() + k * n * lanes, *x_k = x.data() + k * q * lanes;
+        T *inv_pivot_k = inv_pivot.data() + k * lanes;
+
+        for (size_t l = 0; l < lanes; ++l) {
+            best[l] = abs(a_k[k * lanes + l]);
+            pivot[l] = k;
+        }
+        for (size_t i = k + 1; i < n; ++i) {
+            for (size_t l = 0; l < lanes; ++l) {
+                const T value = abs(a[(i * n + k) * lanes + l]);
+                pivot[l] = (value > best[l]) ? i : pivot[l];
+                best[l] = (value > best[l]) ? value : best[l];
+            }
+        }
+
+        for (size_t l = 0; l < lanes; ++l) {
+            if (!(best[l] > EPSILON)) {
+                singular[l] = true;
+                inv_pivot_k[l] = T(0);
+                continue;
+            }
+            if (pivot[l] != k) {
+                for (size_t j = 0; j < n; ++j) {
+                    std::swap(a[(k * n + j) * lanes + l], a[(pivot[l] * n + j) * lanes + l]);
+                }
+                for (size_t j = 0; j < q; ++j) {
+                    std::swap(x[(k * q + j) * lanes + l], x[(pivot[l] * q + j) * lanes + l]);
+                }
+                det[l] = -det[l];
+            }
+            det[l] *= a_k[k * lanes + l];
+            inv_pivot_k[l] = T(1) / a_k[k * lanes + l];
+        }
+
+        for (size_t i = k + 1; i < n; ++i) {
+            T *a_i = a.data() + i * n * lanes, *x_i = x.data() + i * q * lanes;
+            for (size_t l = 0; l < lanes; ++l) {
+                factor[l] = a_i[k * lanes + l] * inv_pivot_k[l];
+            }
+            for (size_t j = k + 1; j < n; ++j) {
+                for (size_t l = 0; l < lanes; ++l) {
+                    a_i[j * lanes + l] -= factor[l] * a_k[j * lanes + l];
+                }
+            }
+            for (size_t j = 0; j < q; ++j) {
+                for (size_t l = 0; l < lanes; ++l) {
+                    x_i[j * lanes + l] -= factor[l] * x_k[j * lanes + l];
+                }
+            }
+        }
+    }
+
+    for (size_t k = n; k-- > 0;) {
+        T *x_k = x.data() + k * q * lanes;
+        const T *inv_pivot_k = inv_pivot.data() + k * lanes;
+        for (size_t i = k + 1; i < n; ++i) {
+            const T *a_ki = a.data() + (k * n + i) * lanes, *x_i = x.data() + i * q * lanes;
+            for (size_t j = 0; j < q; ++j) {
+                for (size_t l = 0; l < lanes; ++l) {
+                    x_k[j * lanes + l] -= a_ki[l] * x_i[j * lanes + l];
+                }
+            }
+        }
+        for (size_t j = 0; j < q; ++j) {
+            for (size_t l = 0; l < lanes; ++l) {
+                x_k[j * lanes + l] *= inv_pivot_k[l];
+            }
+        }
+    }
+
+    bool regular = true;
+    for (size_t l = 0; l < count; ++l) {
+        regular = regular && !singular[l];
+        if (dets != nullptr) {
+            dets[g * lanes + l] = singular[l] ? T(0) : det[l];
+        }
+        if (b != nullptr && !singular[l]) {
+            T *b_g = b + g * n * q * lanes;
+            for (size_t k = 0; k < n * q; ++k) {
+                b_g[k * lanes + l] = x[k * lanes + l];
+            }
+        }
+    }
+    return regular;
+}
+
+template
+class NBatchMatrix<double_t>;
+
+template
+class NBatchMatrix<double_t, std::allocator<double_t>>;
@@ -0,0 +1,1149 @@
+//
+// Created on 17/10/2026.
+//
+
+#include <NBlas.h>
+#include <NVector.h>
+#include <NCpu.h>
+#include <NArena.h>
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wabsolute-value"
+
+using namespace std;
+
+typedef double_t (*NBlasReduction)(size_t n, const double_t *x, const double_t *y);
+
+// MATRIX PRODUCT
+
+template<typename T>
+void NBlas<T>::gemm(size_t n, size_t p, size_t q, T alpha,
+                    const T *a, size_t lda, const T *b, size_t ldb, T *c, size_t ldc) {
+    gemm(n, p, q, alpha, a, lda, 1, b, ldb, 1, c, ldc);
+}
+
+template<typename T>
+void NBlas<T>::gemm(size_t n, size_t p, size_t q, T alpha,
+                    const T *a, size_t rsa, size_t csa, const T *b, size_t rsb, size_t csb, T *c, size_t ldc) {
+    if (n == 0 || p == 0 || q == 0) {
+        return;
+    }
+
+    size_t mc_max = min((size_t) NBLAS_MC, n), kc_max = min((size_t) NBLAS_KC, q), nc_max = min((size_t) NBLAS_NC, p);
+    size_t mc_pad = (mc_max + NBLAS_MR - 1) / NBLAS_MR * NBLAS_MR, nc_pad = (nc_max + NBLAS_NR - 1) / NBLAS_NR * NBLAS_NR;
+    size_t grain = (n * p * q < NBLAS_PARALLEL_MIN_OPS) ? n : NBLAS_MR;
+
+    NArenaScope scope;
+    vector<T, NArenaAllocator<T>> packed_b(kc_max * nc_pad);
+
+    for (size_t jc = 0; jc < p; jc += NBLAS_NC) {
+        size_t nc = min((size_t) NBLAS_NC, p - jc);
+
+        for (size_t pc = 0; pc < q; pc += NBLAS_KC) {
+            size_t kc = min((size_t) NBLAS_KC, q - pc);
+
+            packB(kc, nc, b + pc * rsb + jc * csb, rsb, csb, packed_b.data());
+
+            NThreadPool::instance().parallelFor(0, n, grain, [&](size_t i1, size_t i2) {
+                NArenaScope task_scope;
+                vector<T, NArenaAllocator<T>> packed_a(mc_pad * kc_max);
+
+                for (size_t ic = i1; ic < i2; ic += NBLAS_MC) {
+                    size_t mc = min((size_t) NBLAS_MC, i2 - ic);
+
+                    packA(mc, kc, alpha, a + ic * rsa + pc * csa, rsa, csa, packed_a.data());
+                    macroKernel(mc, nc, kc, packed_a.data(), packed_b.data(), c + ic * ldc + jc, ldc);
+                }
+            });
+        }
+    }
+}
+
+// MATRIX VECTOR PRODUCT
+
+template<typename T>
+void NBlas<T>::gemv(size_t n, size_t p, const T *a, size_t lda, const T *x, T *y) {
+    size_t grain = (n * p < NBLAS_PARALLEL_MIN_OPS) ? n : NTHREADPOOL_MIN_SIZE / max(p, (size_t) 1);
+    grain = max((size_t) NBLAS_MR, (grain + NBLAS_MR - 1) / NBLAS_MR * NBLAS_MR);
+
+    NThreadPool::instance().parallelFor(0, n, grain, [&](size_t i1, size_t i2) {
+        gemvBlock(i2 - i1, p, a + i1 * lda, lda, x, y + i1);
+    });
+}
+
+template<typename T>
+void NBlas<T>::gemvT(size_t n, size_t p, const T *a, size_t lda, const T *x, T *y) {
+    size_t grain = (n * p < NBLAS_PARALLEL_MIN_OPS) ? p : NTHREADPOOL_MIN_SIZE / max(n, (size_t) 1);
+    grain = max((size_t) NBLAS_NR, (grain + NBLAS_NR - 1) / NBLAS_NR * NBLAS_NR);
+
+    NThreadPool::instance().parallelFor(0, p, grain, [&](size_t j1, size_t j2) {
+        for (size_t jc = j1; jc < j2; jc += NBLAS_NC) {
+            size_t nc = min((size_t) NBLAS_NC, j2 - jc);
+            std::fill(y + jc, y + jc + nc, T(0));
+            gemvTBlock(n, nc, a + jc, lda, x, y + jc);
+        }
+    });
+}
+
+// TRANSPOSITION
+
+/**
+ * Half of a dimension of a block transposed recursively, rounded to a multiple of `NBLAS_NR`.
+ */
+static inline size_t transposeSplit(size_t n) {
+    return n / 2 / NBLAS_NR * NBLAS_NR;
+}
+
+template<typename T>
+void NBlas<T>::transpose(size_t n, size_t p, const T *a, size_t lda, T *b, size_t ldb) {
+    if (n == 0 || p == 0) {
+        return;
+    }
+
+    size_t grain = (n * p < NBLAS_PARALLEL_MIN_OPS) ? p : NBLAS_TRANSPOSE_LEAF;
+    NThreadPool::instance().parallelFor(0, p, grain, [&](size_t j1, size_t j2) {
+        transposeBlock(n, j2 - j1, a + j1, lda, b + j1 * ldb, ldb);
+    });
+}
+
+template<typename T>
+void NBlas<T>::transpose(size_t n, T *a, size_t lda) {
+    if (n <= NBLAS_TRANSPOSE_LEAF) {
+        T leaf[NBLAS_TRANSPOSE_LEAF * NBLAS_TRANSPOSE_LEAF];
+        transposeLeaf(n, n, a, lda, leaf, n);
+        for (size_t i = 0; i < n; ++i) {
+            std::copy(leaf + i * n, leaf + (i + 1) * n, a + i * lda);
+        }
+        return;
+    }
+
+    size_t n1 = transposeSplit(n);
+    transpose(n1, a, lda);
+    transpose(n - n1, a + n1 * lda + n1, lda);
+    transposeSwap(n1, n - n1, a + n1, lda, a + n1 * lda, lda);
+}
+
+template<typename T>
+void NBlas<T>::transpose(size_t n, size_t p, T *a) {
+    if (n == p) {
+        transpose(n, a, n);
+        return;
+    }
+    if (n <= 1 || p <= 1) {
+        return;
+    }
+
+    // The first and the last coefficients are fixed points of the permutation
+    const size_t last = n * p - 1;
+    NArenaScope scope;
+    vector<unsigned char, NArenaAllocator<unsigned char>> moved(last / 8 + 1, 0);
+
+    for (size_t start = 1; start < last; ++start) {
+        if ((moved[start / 8] >> (start % 8)) & 1) {
+            continue;
+        }
+
+        T value = a[start];
+        size_t k = start;
+        do {
+            k = k * n % last;
+            std::swap(value, a[k]);
+            moved[k / 8] = (unsigned char) (moved[k / 8] | (1u << (k % 8)));
+        } while (k != start);
+    }
+}
+
+template<typename T>
+void NBlas<T>::transposeBlock(size_t n, size_t p, const T *a, size_t lda, T *b, size_t ldb) {
+    if (n <= NBLAS_TRANSPOSE_LEAF && p <= NBLAS_TRANSPOSE_LEAF) {
+        transposeLeaf(n, p, a, lda, b, ldb);
+    } else if (n >= p) {
+        size_t n1 = transposeSplit(n);
+        transposeBlock(n1, p, a, lda, b, ldb);
+        transposeBlock(n - n1, p, a + n1 * lda, lda, b + n1, ldb);
+    } else {
+        size_t p1 = transposeSplit(p);
+        transposeBlock(n, p1, a, lda, b, ldb);
+        transposeBlock(n, p - p1, a + p1, lda, b + p1 * ldb, ldb);
+    }
+}
+
+template<typename T>
+void NBlas<T>::transposeLeaf(size_t n, size_t p, const T *a, size_t lda, T *b, size_t ldb) {
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < p; ++j) {
+            b[j * ldb + i] = a[i * lda + j];
+        }
+    }
+}
+
+template<typename T>
+void NBlas<T>::transposeSwap(size_t n, size_t p, T *x, size_t ldx, T *y, size_t ldy) {
+    if (n <= NBLAS_TRANSPOSE_LEAF && p <= NBLAS_TRANSPOSE_LEAF) {
+        T leaf[NBLAS_TRANSPOSE_LEAF * NBLAS_TRANSPOSE_LEAF];
+        transposeLeaf(n, p, x, ldx, leaf, n);
+        transposeLeaf(p, n, y, ldy, x, ldx);
+        for (size_t i = 0; i < p; ++i) {
+            std::copy(leaf + i * n, leaf + (i + 1) * n, y + i * ldy);
+        }
+    } else if (n >= p) {
+        size_t n1 = transposeSplit(n);
+        transposeSwap(n1, p, x, ldx, y, ldy);
+        transposeSwap(n - n1, p, x + n1 * ldx, ldx, y + n1, ldy);
+    } else {
+        size_t p1 = transposeSplit(p);
+        transposeSwap(n, p1, x, ldx, y, ldy);
+        transposeSwap(n, p - p1, x + p1, ldx, y + p1 * ldy, ldy);
+    }
+}
+
+template<>
+void NBlas<double_t>::transposeLeaf(size_t n, size_t p, const double_t *a, size_t lda, double_t *b, size_t ldb) {
+    NCpu::instance().kernels().transpose(n, p, a, lda, b, ldb);
+}
+
+template<typename T>
+void NBlas<T>::gemvBlock(size_t n, size_t p, const T *a, size_t lda, const T *x, T *y) {
+    for (size_t i = 0; i < n; ++i) {
+        const T *row = a + i * lda;
+        T dot = 0;
+        for (size_t j = 0; j < p; ++j) {
+            dot = T(dot + row[j] * x[j]);
+        }
+        y[i] = dot;
+    }
+}
+
+template<typename T>
+void NBlas<T>::gemvTBlock(size_t n, size_t p, const T *a, size_t lda, const T *x, T *y) {
+    for (size_t i = 0; i < n; ++i) {
+        axpy(p, x[i], a + i * lda, y);
+    }
+}
+
+template<>
+void NBlas<double_t>::gemvBlock(size_t n, size_t p, const double_t *a, size_t lda, const double_t *x, double_t *y) {
+    NCpu::instance().kernels().gemv(n, p, a, lda, x, y);
+}
+
+template<>
+void NBlas<double_t>::gemvTBlock(size_t n, size_t p, const double_t *a, size_t lda, const double_t *x, double_t *y) {
+    NCpu::instance().kernels().gemvT(n, p, a, lda, x, y);
+}
+
+// REDUCTIONS
+
+template<typename T>
+T NBlas<T>::dot(size_t n, const T *x, const T *y) {
+    T dot = 0;
+    for (size_t k = 0; k < n; ++k) {
+        dot = T(dot + x[k] * y[k]);
+    }
+    return dot;
+}
+
+template<typename T>
+T NBlas<T>::norm2(size_t n, const T *x) {
+    return dot(n, x, x);
+}
+
+template<typename T>
+T NBlas<T>::dist2(size_t n, const T *x, const T *y) {
+    T dist = 0;
+    for (size_t k = 0; k < n; ++k) {
+        T d = T(x[k] - y[k]);
+        dist += T(d * d);
+    }
+    return dist;
+}
+
+template<typename T>
+void NBlas<T>::axpy(size_t n, T alpha, const T *x, T *y) {
+    for (size_t k = 0; k < n; ++k) {
+        y[k] = T(y[k] + alpha * x[k]);
+    }
+}
+
+static double_t reduce(NBlasReduction kernel, size_t n, const double_t *x, const double_t *y) {
+    if (n < 2 * NTHREADPOOL_MIN_SIZE) {
+        return kernel(n, x, y);
+    }
+
+    NArenaScope scope;
+    const size_t blocks = (n + NTHREADPOOL_MIN_SIZE - 1) / NTHREADPOOL_MIN_SIZE;
+    vector<double_t, NArenaAllocator<double_t>> partial(blocks, 0);
+    NThreadPool::instance().parallelFor(0, blocks, 1, [&](size_t b1, size_t b2) {
+        for (size_t b = b1; b < b2; ++b) {
+            size_t k = b * NTHREADPOOL_MIN_SIZE;
+            partial[b] = kernel(min((size_t) NTHREADPOOL_MIN_SIZE, n - k), x + k, y + k);
+        }
+    });
+
+    double_t res = 0;
+    for (double_t s : partial) {
+        res += s;
+    }
+    return res;
+}
+
+template<>
+double_t NBlas<double_t>::dot(size_t n, const double_t *x, const double_t *y) {
+    return reduce(NCpu::instance().kernels().dot, n, x, y);
+}
+
+template<>
+void NBlas<double_t>::axpy(size_t n, double_t alpha, const double_t *x, double_t *y) {
+    NCpu::instance().kernels().axpy(n, alpha, x, y);
+}
+
+template<>
+void NBlas<AESByte>::axpy(size_t n, AESByte alpha, const AESByte *x, AESByte *y) {
+    NCpu::instance().kernels().gfAxpy(n, alpha.val(), reinterpret_cast<const uc_t *>(x), reinterpret_cast<uc_t *>(y));
+}
+
+template<>
+double_t NBlas<double_t>::norm2(size_t n, const double_t *x) {
+    return dot(n, x, x);
+}
+
+template<>
+double_t NBlas<double_t>::dist2(size_t n, const double_t *x, const double_t *y) {
+    return reduce(NCpu::instance().kernels().dist2, n, x, y);
+}
+
+template<typename T>
+void NBlas<T>::gbmv(size_t n, size_t kl, size_t ku, const T *ab, size_t ldab, const T *x, T *y) {
+    size_t grain = (n * (kl + ku + 1) < NBLAS_PARALLEL_MIN_OPS) ? n : NTHREADPOOL_MIN_SIZE / (kl + ku + 1) + 1;
+
+    NThreadPool::instance().parallelFor(0, n, grain, [&](size_t i1, size_t i2) {
+        for (size_t i = i1; i < i2; ++i) {
+            size_t j1 = (i > kl) ? i - kl : 0, j2 = min(n, i + ku + 1);
+            const T *a_i = ab + i * ldab + kl - i;
+            T y_i = T(0);
+            for (size_t j = j1; j < j2; ++j) {
+                y_i = T(y_i + a_i[j] * x[j]);
+            }
+            y[i] = y_i;
+        }
+    });
+}
+
+// SPARSE PRODUCTS
+
+template<typename T>
+void NBlas<T>::csrmv(size_t n, const size_t *rows, const size_t *cols, const T *values, const T *x, T *y) {
+    size_t grain = (rows[n] < NBLAS_PARALLEL_MIN_OPS) ? n : NTHREADPOOL_MIN_SIZE * n / rows[n] + 1;
+
+    NThreadPool::instance().parallelFor(0, n, grain, [&](size_t i1, size_t i2) {
+        for (size_t i = i1; i < i2; ++i) {
+            T y_i = T(0);
+            for (size_t k = rows[i]; k < rows[i + 1]; ++k) {
+                y_i = T(y_i + values[k] * x[cols[k]]);
+            }
+            y[i] = y_i;
+        }
+    });
+}
+
+template<typename T>
+void NBlas<T>::csrmvT(size_t n, size_t p, const size_t *rows, const size_t *cols, const T *values, const T *x,
+                      T *y) {
+    NThreadPool &pool = NThreadPool::instance();
+    size_t tasks = (rows[n] < NBLAS_PARALLEL_MIN_OPS) ? 1 : min(pool.workers(), rows[n] / max(p, (size_t) 1) + 1);
+    size_t grain = (n + tasks - 1) / max(tasks, (size_t) 1);
+
+    NArenaScope scope;
+    vector<T, NArenaAllocator<T>> buffers((tasks - 1) * p);
+
+    std::fill(y, y + p, T(0));
+    pool.parallelFor(0, n, max(grain, (size_t) 1), [&](size_t i1, size_t i2) {
+        T *y_t = (i1 == 0) ? y : buffers.data() + (i1 / grain - 1) * p;
+        std::fill(y_t, y_t + p, T(0));
+        for (size_t i = i1; i < i2; ++i) {
+            for (size_t k = rows[i]; k < rows[i + 1]; ++k) {
+                y_t[cols[k]] = T(y_t[cols[k]] + values[k] * x[i]);
+            }
+        }
+    });
+
+    for (size_t t = 0; t + 1 < tasks; ++t) {
+        axpy(p, T(1), buffers.data() + t * p, y);
+    }
+}
+
+template<typename T>
+void NBlas<T>::csrmm(size_t n, size_t p, const size_t *rows, const size_t *cols, const T *values, const T *b,
+                     size_t ldb, T *c, size_t ldc) {
+    size_t grain = (rows[n] * p < NBLAS_PARALLEL_MIN_OPS) ? n : NTHREADPOOL_MIN_SIZE * n / (rows[n] * p + 1) + 1;
+
+    NThreadPool::instance().parallelFor(0, n, grain, [&](size_t i1, size_t i2) {
+        for (size_t i = i1; i < i2; ++i) {
+            std::fill(c + i * ldc, c + i * ldc + p, T(0));
+            for (size_t k = rows[i]; k < rows[i + 1]; ++k) {
+                axpy(p, values[k], b + cols[k] * ldb, c + i * ldc);
+            }
+        }
+    });
+}
+
+// LU FACTORIZATION
+
+template<typename T>
+bool NBlas<T>::getrf(size_t n, T *a, size_t lda, size_t *perm) {
+    for (size_t j = 0; j < n; j += NBLAS_NB) {
+        size_t jb = min((size_t) NBLAS_NB, n - j);
+
+        if (!getf2(n, jb, j, a, lda, perm)) {
+            return false;
+        }
+
+        if (j + jb < n) {
+            T *a12 = a + j * lda + j + jb;
+
+            for (size_t i = 0; i < jb; ++i) {
+                const T *a12_i = a12 + i * lda;
+                for (size_t r = i + 1; r < jb; ++r) {
+                    axpy(n - j - jb, -a[(j + r) * lda + j + i], a12_i, a12 + r * lda);
+                }
+            }
+
+            gemm(n - j - jb, n - j - jb, jb, T(-1),
+                 a + (j + jb) * lda + j, lda, a12, lda, a + (j + jb) * lda + j + jb, lda);
+        }
+    }
+    return true;
+}
+
+template<typename T>
+bool NBlas<T>::getf2(size_t n, size_t jb, size_t j, T *a, size_t lda, size_t *perm) {
+    for (size_t i = j; i < j + jb; ++i) {
+        size_t i_max = i;
+        for (size_t r = i + 1; r < n; ++r) {
+            if (abs(a[r * lda + i]) > abs(a[i_max * lda + i])) {
+                i_max = r;
+            }
+        }
+
+        if (!(abs(a[i_max * lda + i]) > EPSILON)) {
+            return false;
+        }
+
+        if (i_max != i) {
+            std::swap_ranges(a + i * lda, a + i * lda + n, a + i_max * lda);
+            std::swap(perm[i], perm[i_max]);
+            perm[n]++;
+        }
+
+        const T *a_i = a + i * lda;
+        for (size_t r = i + 1; r < n; ++r) {
+            T *a_r = a + r * lda;
+            a_r[i] /= a_i[i];
+            axpy(j + jb - i - 1, -a_r[i], a_i + i + 1, a_r + i + 1);
+        }
+    }
+    return true;
+}
+
+// BANDED FACTORIZATION
+
+template<typename T>
+bool NBlas<T>::gbtrf(size_t n, size_t kl, size_t ku, T *ab, size_t ldab, size_t *ipiv) {
+    const size_t ku2 = kl + ku;
+
+    for (size_t i = 0; i < n; ++i) {
+        std::fill(ab + i * ldab + kl + ku + 1, ab + i * ldab + kl + ku2 + 1, T(0));
+    }
+
+    for (size_t k = 0; k < n; ++k) {
+        size_t r2 = min(n, k + kl + 1), c2 = min(n, k + ku2 + 1), p = k;
+        for (size_t r = k + 1; r < r2; ++r) {
+            if (abs(ab[r * ldab + k + kl - r]) > abs(ab[p * ldab + k + kl - p])) {
+                p = r;
+            }
+        }
+        ipiv[k] = p;
+
+        if (!(abs(ab[p * ldab + k + kl - p]) > EPSILON)) {
+            return false;
+        }
+
+        T *u_k = ab + k * ldab + kl - k;
+        if (p != k) {
+            T *u_p = ab + p * ldab + kl - p;
+            for (size_t c = k; c < c2; ++c) {
+                std::swap(u_k[c], u_p[c]);
+            }
+        }
+
+        for (size_t r = k + 1; r < r2; ++r) {
+            T *a_r = ab + r * ldab + kl - r;
+            a_r[k] /= u_k[k];
+            for (size_t c = k + 1; c < c2; ++c) {
+                a_r[c] = T(a_r[c] - a_r[k] * u_k[c]);
+            }
+        }
+    }
+    return true;
+}
+
+template<typename T>
+void NBlas<T>::gbtrs(size_t n, size_t kl, size_t ku, const T *ab, size_t ldab, const size_t *ipiv, T *b) {
+    const size_t ku2 = kl + ku;
+
+    for (size_t k = 0; k < n; ++k) {
+        std::swap(b[k], b[ipiv[k]]);
+        for (size_t r = k + 1; r < min(n, k + kl + 1); ++r) {
+            b[r] = T(b[r] - ab[r * ldab + k + kl - r] * b[k]);
+        }
+    }
+    for (size_t k = n; k-- > 0;) {
+        const T *u_k = ab + k * ldab + kl - k;
+        for (size_t c = k + 1; c < min(n, k + ku2 + 1); ++c) {
+            b[k] = T(b[k] - u_k[c] * b[c]);
+        }
+        b[k] /= u_k[k];
+    }
+}
+
+template<typename T>
+bool NBlas<T>::gtsv(size_t n, const T *ab, size_t ldab, T *b) {
+    NArenaScope scope;
+    vector<T, NArenaAllocator<T>> c(n), d(n);
+
+    for (size_t i = 0; i < n; ++i) {
+        const T *a_i = ab + i * ldab;
+        T m = (i > 0) ? T(a_i[1] - a_i[0] * c[i - 1]) : a_i[1];
+        if (!(abs(m) > EPSILON)) {
+            return false;
+        }
+        c[i] = (i + 1 < n) ? a_i[2] / m : T(0);
+        d[i] = (i > 0) ? T((b[i] - a_i[0] * d[i - 1]) / m) : T(b[i] / m);
+    }
+
+    for (size_t i = n; i-- > 0;) {
+        b[i] = (i + 1 < n) ? T(d[i] - c[i] * b[i + 1]) : d[i];
+    }
+    return true;
+}
+
+// CHOLESKY FACTORIZATION
+
+template<typename T>
+bool NBlas<T>::potrf(size_t n, T *a, size_t lda) {
+    for (size_t j = 0; j < n; j += NBLAS_NB) {
+        size_t jb = min((size_t) NBLAS_NB, n - j), m = n - j - jb;
+        const T *a11 = a + j * lda + j;
+        T *a21 = a + (j + jb) * lda + j;
+
+        if (!potf2(jb, a + j * lda + j, lda)) {
+            return false;
+        }
+        if (m == 0) {
+            continue;
+        }
+
+        NArenaScope scope;
+        vector<T, NArenaAllocator<T>> l21_trans(jb * m);
+        for (size_t r = 0; r < m; ++r) {
+            for (size_t c = 0; c < jb; ++c) {
+                l21_trans[c * m + r] = a21[r * lda + c];
+            }
+        }
+
+        size_t grain = (jb * jb * m < NBLAS_PARALLEL_MIN_OPS) ? m : NBLAS_NR;
+        NThreadPool::instance().parallelFor(0, m, grain, [&](size_t r1, size_t r2) {
+            trsmLower(jb, r2 - r1, a11, lda, l21_trans.data() + r1, m, false);
+        });
+
+        for (size_t r = 0; r < m; ++r) {
+            for (size_t c = 0; c < jb; ++c) {
+                a21[r * lda + c] = l21_trans[c * m + r];
+            }
+        }
+
+        for (size_t i = 0; i < m; i += NBLAS_NB) {
+            size_t ib = min((size_t) NBLAS_NB, m - i);
+            gemm(ib, i + ib, jb, T(-1), a21 + i * lda, lda, l21_trans.data(), m, a21 + i * lda + jb, lda);
+        }
+    }
+    return true;
+}
+
+template<typename T>
+bool NBlas<T>::potf2(size_t n, T *a, size_t lda) {
+    for (size_t r = 0; r < n; ++r) {
+        T *a_r = a + r * lda;
+
+        for (size_t c = 0; c < r; ++c) {
+            const T *a_c = a + c * lda;
+            a_r[c] = T((a_r[c] - dot(c, a_r, a_c)) / a_c[c]);
+        }
+
+        T d = a_r[r] - dot(r, a_r, a_r);
+        if (!(d > EPSILON)) {
+            return false;
+        }
+        a_r[r] = T(sqrt(d));
+    }
+    return true;
+}
+
+template<typename T>
+void NBlas<T>::potrs(size_t n, size_t m, const T *a, size_t lda, T *b, size_t ldb) {
+    if (n == 0 || m == 0) {
+        return;
+    }
+
+    size_t grain = (n * n * m < NBLAS_PARALLEL_MIN_OPS) ? m : NBLAS_NR;
+    NThreadPool::instance().parallelFor(0, m, grain, [&](size_t j1, size_t j2) {
+        trsmLower(n, j2 - j1, a, lda, b + j1, ldb, false);
+        trsmLowerT(n, j2 - j1, a, lda, b + j1, ldb);
+    });
+}
+
+// QR FACTORIZATION
+
+template<typename T>
+void NBlas<T>::geqrt(size_t n, size_t p, T *a, size_t lda, T *t, size_t ldt) {
+    assert(p <= n);
+
+    NArenaScope scope;
+    vector<T, NArenaAllocator<T>> panel(n * min((size_t) NBLAS_NB, p));
+
+    for (size_t j = 0; j < p; j += NBLAS_NB) {
+        const size_t jb = min((size_t) NBLAS_NB, p - j), m = n - j;
+        T *a_jj = a + j * lda + j;
+
+        // Factorize the panel by columns so that the Householder vectors are contiguous
+        for (size_t r = 0; r < m; ++r) {
+            for (size_t c = 0; c < jb; ++c) {
+                panel[c * m + r] = a_jj[r * lda + c];
+            }
+        }
+        geqrt3(m, jb, panel.data(), m, t + j, ldt);
+        for (size_t r = 0; r < m; ++r) {
+            for (size_t c = 0; c < jb; ++c) {
+                a_jj[r * lda + c] = panel[c * m + r];
+            }
+        }
+
+        if (j + jb < p) {
+            larfb(m, jb, p - j - jb, a_jj, lda, t + j, ldt, a_jj + jb, lda, true);
+        }
+    }
+}
+
+template<typename T>
+void NBlas<T>::gemqrt(size_t n, size_t p, size_t m, const T *a, size_t lda, const T *t, size_t ldt,
+                      T *c, size_t ldc, bool trans) {
+    const size_t blocks = (p + NBLAS_NB - 1) / NBLAS_NB;
+
+    for (size_t b = 0; b < blocks; ++b) {
+        size_t j = (trans ? b : blocks - 1 - b) * NBLAS_NB, jb = min((size_t) NBLAS_NB, p - j);
+        larfb(n - j, jb, m, a + j * lda + j, lda, t + j, ldt, c + j * ldc, ldc, trans);
+    }
+}
+
+template<typename T>
+void NBlas<T>::geqrt3(size_t n, size_t p, T *a, size_t lda, T *t, size_t ldt) {
+    if (p <= NBLAS_QR_LEAF) {
+        geqr2(n, p, a, lda, t, ldt);
+        return;
+    }
+
+    const size_t p1 = p / 2, p2 = p - p1;
+    T *a2 = a + p1 * lda, *t12 = t + p1, *t22 = t + p1 * ldt + p1;
+
+    geqrt3(n, p1, a, lda, t, ldt);
+
+    NArenaScope scope;
+    vector<T, NArenaAllocator<T>> w(p1 * p2);
+
+    // W = V1^T A2, the first rows of V1 being unit lower triangular
+    for (size_t i = 0; i < p1; ++i) {
+        for (size_t c = 0; c < p2; ++c) {
+            w[i * p2 + c] = a2[c * lda + i] + dot(p1 - i - 1, a + i * lda + i + 1, a2 + c * lda + i + 1);
+        }
+    }
+    gemm(p1, p2, n - p1, T(1), a + p1, lda, 1, a2 + p1, 1, lda, w.data(), p2);
+
+    // W = T1^T W
+    for (size_t i = p1; i-- > 0;) {
+        T *w_i = w.data() + i * p2;
+        for (size_t c = 0; c < p2; ++c) {
+            w_i[c] *= t[i * ldt + i];
+        }
+        for (size_t r = 0; r < i; ++r) {
+            axpy(p2, t[r * ldt + i], w.data() + r * p2, w_i);
+        }
+    }
+
+    // A2 = A2 - V1 W, computed on the columns of A2
+    gemm(p2, n - p1, p1, T(-1), w.data(), 1, p2, a + p1, lda, 1, a2 + p1, lda);
+    for (size_t c = 0; c < p2; ++c) {
+        T *a2_c = a2 + c * lda;
+        for (size_t r = 0; r < p1; ++r) {
+            T x = w[r * p2 + c];
+            for (size_t i = 0; i < r; ++i) {
+                x = T(x + a[i * lda + r] * w[i * p2 + c]);
+            }
+            a2_c[r] -= x;
+        }
+    }
+
+    geqrt3(n - p1, p2, a2 + p1, lda, t22, ldt);
+
+    // T12 = -T11 (V1^T V2) T22, the first rows of V2 being unit lower triangular
+    for (size_t i = 0; i < p1; ++i) {
+        for (size_t c = 0; c < p2; ++c) {
+            t12[i * ldt + c] = a[i * lda + p1 + c] +
+                               dot(p2 - c - 1, a + i * lda + p1 + c + 1, a2 + c * lda + p1 + c + 1);
+        }
+    }
+    gemm(p1, p2, n - p, T(1), a + p, lda, 1, a2 + p, 1, lda, t12, ldt);
+
+    for (size_t i = 0; i < p1; ++i) {
+        T *t12_i = t12 + i * ldt;
+        for (size_t c = 0; c < p2; ++c) {
+            t12_i[c] *= t[i * ldt + i];
+        }
+        for (size_t r = i + 1; r < p1; ++r) {
+            axpy(p2, t[i * ldt + r], t12 + r * ldt, t12_i);
+        }
+    }
+    for (size_t i = 0; i < p1; ++i) {
+        T *t12_i = t12 + i * ldt;
+        for (size_t c = p2; c-- > 0;) {
+            T x = T(0);
+            for (size_t r = 0; r <= c; ++r) {
+                x = T(x + t12_i[r] * t22[r * ldt + c]);
+            }
+            t12_i[c] = T(-x);
+        }
+    }
+}
+
+template<typename T>
+void NBlas<T>::geqr2(size_t n, size_t p, T *a, size_t lda, T *t, size_t ldt) {
+    for (size_t k = 0; k < p; ++k) {
+        T *v = a + k * lda + k, tau;
+        const size_t m = n - k;
+
+        tau = larfg(m, v);
+
+        for (size_t c = k + 1; c < p && !(tau == T(0)); ++c) {
+            T *x = a + c * lda + k;
+            T y = T(tau * (x[0] + dot(m - 1, v + 1, x + 1)));
+            x[0] -= y;
+            axpy(m - 1, T(-y), v + 1, x + 1);
+        }
+
+        // T(0:k, k) = -tau T(0:k, 0:k) V(:, 0:k)^T v
+        T *t_k = t + k;
+        for (size_t i = 0; i < k; ++i) {
+            t_k[i * ldt] = a[i * lda + k] + dot(m - 1, a + i * lda + k + 1, v + 1);
+        }
+        for (size_t i = 0; i < k; ++i) {
+            T x = T(0);
+            for (size_t r = i; r < k; ++r) {
+                x = T(x + t[i * ldt + r] * t_k[r * ldt]);
+            }
+            t_k[i * ldt] = T(-tau * x);
+        }
+        t_k[k * ldt] = tau;
+    }
+}
+
+template<typename T>
+T NBlas<T>::larfg(size_t n, T *x) {
+    T alpha = x[0], sigma = norm2(n - 1, x + 1);
+    if (sigma == T(0)) {
+        return T(0);
+    }
+
+    T beta = T(sqrt(alpha * alpha + sigma));
+    beta = (alpha > T(0)) ? T(-beta) : beta;
+    T scale = T(T(1) / (alpha - beta));
+    for (size_t r = 1; r < n; ++r) {
+        x[r] *= scale;
+    }
+    x[0] = beta;
+    return T((beta - alpha) / beta);
+}
+
+template<typename T>
+void NBlas<T>::larfb(size_t n, size_t k, size_t m, const T *v, size_t ldv, const T *t, size_t ldt,
+                     T *c, size_t ldc, bool trans) {
+    if (k == 0 || m == 0) {
+        return;
+    }
+
+    NArenaScope scope;
+    vector<T, NArenaAllocator<T>> w(k * m);
+
+    // W = V^T C
+    for (size_t i = 0; i < k; ++i) {
+        T *w_i = w.data() + i * m;
+        std::copy(c + i * ldc, c + i * ldc + m, w_i);
+        for (size_t r = i + 1; r < k; ++r) {
+            axpy(m, v[r * ldv + i], c + r * ldc, w_i);
+        }
+    }
+    gemm(k, m, n - k, T(1), v + k * ldv, 1, ldv, c + k * ldc, ldc, 1, w.data(), m);
+
+    // W = T^T W or T W
+    for (size_t l = 0; l < k; ++l) {
+        const size_t i = trans ? k - 1 - l : l;
+        T *w_i = w.data() + i * m;
+        for (size_t j = 0; j < m; ++j) {
+            w_i[j] *= t[i * ldt + i];
+        }
+        for (size_t r = trans ? 0 : i + 1; r < (trans ? i : k); ++r) {
+            axpy(m, trans ? t[r * ldt + i] : t[i * ldt + r], w.data() + r * m, w_i);
+        }
+    }
+
+    // C = C - V W
+    gemm(n - k, m, k, T(-1), v + k * ldv, ldv, w.data(), m, c + k * ldc, ldc);
+    for (size_t r = 0; r < k; ++r) {
+        T *c_r = c + r * ldc;
+        axpy(m, T(-1), w.data() + r * m, c_r);
+        for (size_t i = 0; i < r; ++i) {
+            axpy(m, T(-v[r * ldv + i]), w.data() + i * m, c_r);
+        }
+    }
+}
+
+// SYMMETRIC TRIDIAGONAL REDUCTION
+
+template<typename T>
+void NBlas<T>::sytrd(size_t n, T *a, size_t lda, T *d, T *e, T *t, size_t ldt) {
+    NArenaScope scope;
+    vector<T, NArenaAllocator<T>> vt(n * NBLAS_NB), wt(n * NBLAS_NB);
+
+    for (size_t k = 0; k + 1 < n; k += NBLAS_NB) {
+        const size_t nb = min((size_t) NBLAS_NB, n - 1 - k), m = n - k;
+        T *a_kk = a + k * lda + k, *a_tr = a_kk + nb * lda + nb;
+
+        latrd(m, nb, a_kk, lda, d + k, e + k, t + k, ldt, vt.data(), wt.data());
+
+        // A = A - V W^T - W V^T on the trailing sub-matrix, both halves being kept
+        gemm(m - nb, m - nb, nb, T(-1), vt.data() + nb, 1, m, wt.data() + nb, m, 1, a_tr, lda);
+        gemm(m - nb, m - nb, nb, T(-1), wt.data() + nb, 1, m, vt.data() + nb, m, 1, a_tr, lda);
+    }
+    if (n > 0) {
+        d[n - 1] = a[(n - 1) * lda + n - 1];
+    }
+}
+
+template<typename T>
+void NBlas<T>::latrd(size_t m, size_t nb, T *a, size_t lda, T *d, T *e, T *t, size_t ldt, T *vt, T *wt) {
+    std::fill(vt, vt + nb * m, T(0));
+    std::fill(wt, wt + nb * m, T(0));
+
+    for (size_t i = 0; i < nb; ++i) {
+        T *a_i = a + i * lda, *v = vt + i * m + i + 1, *w = wt + i * m + i + 1;
+        const size_t len = m - i - 1;
+
+        // Row i of the matrix updated by the previous reflectors of the panel
+        for (size_t j = 0; j < i; ++j) {
+            axpy(m - i, T(-wt[j * m + i]), vt + j * m + i, a_i + i);
+            axpy(m - i, T(-vt[j * m + i]), wt + j * m + i, a_i + i);
+        }
+        d[i] = a_i[i];
+
+        T tau = larfg(len, a_i + i + 1);
+        e[i] = a_i[i + 1];
+        v[0] = T(1);
+        std::copy(a_i + i + 2, a_i + m, v + 1);
+        for (size_t r = 1; r < len; ++r) {
+            a[(i + 1 + r) * lda + i] = v[r];
+        }
+
+        // w = tau (A v - V W^T v - W V^T v) - (tau^2 / 2) (v^T A v) v
+        gemv(len, len, a + (i + 1) * lda + i + 1, lda, v, w);
+        for (size_t j = 0; j < i; ++j) {
+            const T *v_j = vt + j * m + i + 1, *w_j = wt + j * m + i + 1;
+            T wv = dot(len, w_j, v), vv = dot(len, v_j, v);
+            axpy(len, T(-wv), v_j, w);
+            axpy(len, T(-vv), w_j, w);
+        }
+        for (size_t r = 0; r < len; ++r) {
+            w[r] *= tau;
+        }
+        axpy(len, T(-(tau / T(2)) * dot(len, w, v)), v, w);
+
+        // T(0:i, i) = -tau T(0:i, 0:i) V(:, 0:i)^T v
+        T *t_i = t + i;
+        for (size_t j = 0; j < i; ++j) {
+            t_i[j * ldt] = dot(len, vt + j * m + i + 1, v);
+        }
+        for (size_t j = 0; j < i; ++j) {
+            T x = T(0);
+            for (size_t r = j; r < i; ++r) {
+                x = T(x + t[j * ldt + r] * t_i[r * ldt]);
+            }
+            t_i[j * ldt] = T(-tau * x);
+        }
+        t_i[i * ldt] = tau;
+    }
+}
+
+// TRIANGULAR SOLVES
+
+template<typename T>
+void NBlas<T>::getrs(size_t n, size_t m, const T *a, size_t lda, const size_t *perm, T *b, size_t ldb) {
+    if (n == 0 || m == 0) {
+        return;
+    }
+
+    NArenaScope scope;
+    vector<T, NArenaAllocator<T>> x(n * m);
+    for (size_t i = 0; i < n; ++i) {
+        std::copy(b + perm[i] * ldb, b + perm[i] * ldb + m, x.begin() + i * m);
+    }
+
+    size_t grain = (n * n * m < NBLAS_PARALLEL_MIN_OPS) ? m : NBLAS_NR;
+    NThreadPool::instance().parallelFor(0, m, grain, [&](size_t j1, size_t j2) {
+        trsmLower(n, j2 - j1, a, lda, x.data() + j1, m);
+        trsmUpper(n, j2 - j1, a, lda, x.data() + j1, m);
+    });
+
+    for (size_t i = 0; i < n; ++i) {
+        std::copy(x.begin() + i * m, x.begin() + (i + 1) * m, b + i * ldb);
+    }
+}
+
+template<typename T>
+void NBlas<T>::getrsT(size_t n, size_t m, const T *a, size_t lda, const size_t *perm, T *b, size_t ldb) {
+    if (n == 0 || m == 0) {
+        return;
+    }
+
+    size_t grain = (n * n * m < NBLAS_PARALLEL_MIN_OPS) ? m : NBLAS_NR;
+    NThreadPool::instance().parallelFor(0, m, grain, [&](size_t j1, size_t j2) {
+        trsmUpperT(n, j2 - j1, a, lda, b + j1, ldb);
+        trsmLowerT(n, j2 - j1, a, lda, b + j1, ldb, true);
+    });
+
+    NArenaScope scope;
+    vector<T, NArenaAllocator<T>> x(n * m);
+    for (size_t i = 0; i < n; ++i) {
+        std::copy(b + i * ldb, b + i * ldb + m, x.begin() + perm[i] * m);
+    }
+    for (size_t i = 0; i < n; ++i) {
+        std::copy(x.begin() + i * m, x.begin() + (i + 1) * m, b + i * ldb);
+    }
+}
+
+template<typename T>
+void NBlas<T>::trsmLower(size_t n, size_t m, const T *a, size_t lda, T *b, size_t ldb, bool unit) {
+    for (size_t k = 0; k < n; k += NBLAS_NB) {
+        size_t kb = min((size_t) NBLAS_NB, n - k);
+
+        for (size_t i = k; i < k + kb; ++i) {
+            T *b_i = b + i * ldb;
+            for (size_t l = k; l < i; ++l) {
+                axpy(m, -a[i * lda + l], b + l * ldb, b_i);
+            }
+            if (!unit) {
+                for (size_t j = 0; j < m; ++j) {
+                    b_i[j] /= a[i * lda + i];
+                }
+            }
+        }
+
+        if (k + kb < n) {
+            gemm(n - k - kb, m, kb, T(-1), a + (k + kb) * lda + k, lda, b + k * ldb, ldb, b + (k + kb) * ldb, ldb);
+        }
+    }
+}
+
+template<typename T>
+void NBlas<T>::trsmUpper(size_t n, size_t m, const T *a, size_t lda, T *b, size_t ldb) {
+    for (size_t k2 = n; k2 > 0;) {
+        size_t kb = min((size_t) NBLAS_NB, k2), k = k2 - kb;
+
+        for (size_t i = k2; i-- > k;) {
+            T *b_i = b + i * ldb;
+            for (size_t l = i + 1; l < k2; ++l) {
+                axpy(m, -a[i * lda + l], b + l * ldb, b_i);
+            }
+            for (size_t j = 0; j < m; ++j) {
+                b_i[j] /= a[i * lda + i];
+            }
+        }
+
+        if (k > 0) {
+            gemm(k, m, kb, T(-1), a + k, lda, b + k * ldb, ldb, b, ldb);
+        }
+        k2 = k;
+    }
+}
+
+template<typename T>
+void NBlas<T>::trsmLowerT(size_t n, size_t m, const T *a, size_t lda, T *b, size_t ldb, bool unit) {
+    for (size_t k2 = n; k2 > 0;) {
+        size_t kb = min((size_t) NBLAS_NB, k2), k = k2 - kb;
+
+        for (size_t i = k2; i-- > k;) {
+            T *b_i = b + i * ldb;
+            if (!unit) {
+                for (size_t j = 0; j < m; ++j) {
+                    b_i[j] /= a[i * lda + i];
+                }
+            }
+            for (size_t l = k; l < i; ++l) {
+                axpy(m, -a[i * lda + l], b_i, b + l * ldb);
+            }
+        }
+
+        if (k > 0) {
+            gemm(k, m, kb, T(-1), a + k * lda, 1, lda, b + k * ldb, ldb, 1, b, ldb);
+        }
+        k2 = k;
+    }
+}
+
+template<typename T>
+void NBlas<T>::trsmUpperT(size_t n, size_t m, const T *a, size_t lda, T *b, size_t ldb) {
+    for (size_t k = 0; k < n; k += NBLAS_NB) {
+        size_t kb = min((size_t) NBLAS_NB, n - k);
+
+        for (size_t i = k; i < k + kb; ++i) {
+            T *b_i = b + i * ldb;
+            for (size_t j = 0; j < m; ++j) {
+                b_i[j] /= a[i * lda + i];
+            }
+            for (size_t l = i + 1; l < k + kb; ++l) {
+                axpy(m, -a[i * lda + l], b_i, b + l * ldb);
+            }
+        }
+
+        if (k + kb < n) {
+            gemm(n - k - kb, m, kb, T(-1), a + k * lda + k + kb, 1, lda, b + k * ldb, ldb, 1,
+                 b + (k + kb) * ldb, ldb);
+        }
+    }
+}
+
+// PACKING
+
+template<typename T>
+void NBlas<T>::packA(size_t mc, size_t kc, T alpha, const T *a, size_t rsa, size_t csa, T *packed) {
+    for (size_t ir = 0; ir < mc; ir += NBLAS_MR) {
+        size_t mr = min((size_t) NBLAS_MR, mc - ir);
+        const T *panel = a + ir * rsa;
+
+        for (size_t k = 0; k < kc; ++k) {
+            size_t i = 0;
+            for (; i < mr; ++i) {
+                *packed++ = alpha * panel[i * rsa + k * csa];
+            }
+            for (; i < NBLAS_MR; ++i) {
+                *packed++ = T(0);
+            }
+        }
+    }
+}
+
+template<typename T>
+void NBlas<T>::packB(size_t kc, size_t nc, const T *b, size_t rsb, size_t csb, T *packed) {
+    for (size_t jr = 0; jr < nc; jr += NBLAS_NR) {
+        size_t nr = min((size_t) NBLAS_NR, nc - jr);
+        const T *panel = b + jr * csb;
+
+        for (size_t k = 0; k < kc; ++k) {
+            size_t j = 0;
+            for (; j < nr; ++j) {
+                *packed++ = panel[k * rsb + j * csb];
+            }
+            for (; j < NBLAS_NR; ++j) {
+                *packed++ = T(0);
+            }
+        }
+    }
+}
+
+// KERNELS
+
+template<typename T>
+void NBlas<T>::macroKernel(size_t mc, size_t nc, size_t kc, const T *packed_a, const T *packed_b, T *c, size_t ldc) {
+    for (size_t jr = 0; jr < nc; jr += NBLAS_NR) {
+        size_t nr = min((size_t) NBLAS_NR, nc - jr);
+
+        for (size_t ir = 0; ir < mc; ir += NBLAS_MR) {
+            size_t mr = min((size_t) NBLAS_MR, mc - ir);
+
+            microKernel(kc, packed_a + ir * kc, packed_b + jr * kc, c + ir * ldc + jr, ldc, mr, nr);
+        }
+    }
+}
+
+template<typename T>
+void NBlas<T>::microKernel(size_t kc, const T *packed_a, const T *packed_b, T *c, size_t ldc, size_t mr, size_t nr) {
+    T acc[NBLAS_MR][NBLAS_NR];
+
+    for (size_t i = 0; i < NBLAS_MR; ++i) {
+        for (size_t j = 0; j < NBLAS_NR; ++j) {
+            acc[i][j] = T(0);
+        }
+    }
+
+    for (size_t k = 0; k < kc; ++k) {
+        for (size_t i = 0; i < NBLAS_MR; ++i) {
+            const T a_ik = packed_a[i];
+            for (size_t j = 0; j < NBLAS_NR; ++j) {
+                acc[i][j] = T(acc[i][j] + a_ik * packed_b[j]);
+            }
+        }
+        packed_a += NBLAS_MR;
+        packed_b += NBLAS_NR;
+    }
+
+    for (size_t i = 0; i < mr; ++i) {
+        for (size_t j = 0; j < nr; ++j) {
+            c[i * ldc + j] += acc[i][j];
+        }
+    }
+}
+
+template<>
+void NBlas<double_t>::microKernel(size_t kc, const double_t *packed_a, const double_t *packed_b, double_t *c,
+                                  size_t ldc, size_t mr, size_t nr) {
+    NCpu::instance().kernels().gemm(kc, packed_a, packed_b, c, ldc, mr, nr);
+}
+
+template<>
+void NBlas<AESByte>::gemm(size_t n, size_t p, size_t q, AESByte alpha,
+                          const AESByte *a, size_t lda, const AESByte *b, size_t ldb, AESByte *c, size_t ldc) {
+    size_t grain = (n * p * q < NBLAS_PARALLEL_MIN_OPS) ? n : 1;
+
+    NThreadPool::instance().parallelFor(0, n, grain, [&](size_t i1, size_t i2) {
+        for (size_t i = i1; i < i2; ++i) {
+            for (size_t k = 0; k < q; ++k) {
+                axpy(p, alpha * a[i * lda + k], b + k * ldb, c + i * ldc);
+            }
+        }
+    });
+}
+
+template
+class NBlas<double_t>;
+
+template
+class NBlas<char>;
+
+template
+class NBlas<uc_t>;
+
+template
+class NBlas<int>;
+
+template
+class NBlas<AESByte>;
+
+template
+class NBlas<Pixel>;
+
+#pragma clang diagnostic pop
@@ -0,0 +1,125 @@
+//
+// Created on 17/10/2026.
+//
+
+#include <NCholesky.h>
+#include <NBlas.h>
+
+using namespace std;
+
+// CONSTRUCTION
+
+template<typename T, typename A>
+NCholesky<T, A>::NCholesky(const NPMatrix<T, A> &m) {
+    factorize(NMatrixView<const T>(m.data() + m.vectorIndex(m._i1, m._j1), m._i2 - m._i1 + 1, m._j2 - m._j1 + 1,
+                                   m._p));
+    m.setDefaultBrowseIndices();
+}
+
+template<typename T, typename A>
+NCholesky<T, A>::NCholesky(const NMatrixView<const T> &m) {
+    factorize(m);
+}
+
+// GETTERS
+
+template<typename T, typename A>
+NPMatrix<T, A> NCholesky<T, A>::L() const {
+    assert(_definite);
+
+    const size_t n = this->n();
+    const T *a = _llt->data();
+    NPMatrix<T, A> l = NPMatrix<T, A>::zeros(n);
+    for (size_t i = 0; i < n; ++i) {
+        std::copy(a + i * n, a + i * n + i + 1, l.data() + i * n);
+    }
+    return l;
+}
+
+// ALGEBRA
+
+template<typename T, typename A>
+T NCholesky<T, A>::det() const {
+    const size_t n = this->n();
+    const T *a = _llt->data();
+
+    if (!_definite || n == 0) {
+        return T(0);
+    }
+
+    T det = a[0];
+    for (size_t i = 1; i < n; ++i) {
+        det *= a[i * n + i];
+    }
+    return det * det;
+}
+
+template<typename T, typename A>
+NPMatrix<T, A> NCholesky<T, A>::inv() const {
+    assert(_definite);
+
+    NPMatrix<T, A> res = NPMatrix<T, A>::eye(n());
+    return solve(res);
+}
+
+template<typename T, typename A>
+NVector<T, A> &NCholesky<T, A>::solve(NVector<T, A> &u) const {
+    const size_t n = this->n();
+    const T *a = _llt->data();
+    assert(u.dim() == n);
+
+    if (_definite) {
+        T *x = u.data();
+        for (size_t i = 0; i < n; ++i) {
+            x[i] = T((x[i] - NBlas<T>::dot(i, a + i * n, x)) / a[i * n + i]);
+        }
+        for (size_t i = n; i-- > 0;) {
+            x[i] /= a[i * n + i];
+            NBlas<T>::axpy(i, -x[i], a + i * n, x);
+        }
+    }
+    return u;
+}
+
+template<typename T, typename A>
+NPMatrix<T, A> &NCholesky<T, A>::solve(NPMatrix<T, A> &b) const {
+    const size_t n = b._i2 - b._i1 + 1, m = b._j2 - b._j1 + 1;
+    assert(n == this->n());
+
+    if (_definite) {
+        NBlas<T>::potrs(n, m, _llt->data(), n, b.data() + b.vectorIndex(b._i1, b._j1), b._p);
+    }
+    return b.clean();
+}
+
+// PROTECTED METHODS
+
+template<typename T, typename A>
+void NCholesky<T, A>::factorize(const NMatrixView<const T> &m) {
+    assert(m.isSquare());
+
+    auto llt = make_shared<NPMatrix<T, A>>(m);
+    _definite = NBlas<T>::potrf(m.n(), llt->data(), m.n());
+    _llt = std::move(llt);
+}
+
+template
+class NCholesky<double_t>;
+
+template
+class NCholesky<char>;
+
+template
+class NCholesky<uc_t>;
+
+template
+class NCholesky<int>;
+
+template
+class NCholesky<AESByte>;
+
+template
+class NCholesky<Pixel>;
+
+template
+class NCholesky<double_t, std::allocator<double_t>>;
@@ -0,0 +1,1038 @@
+//
+// Created on 17/10/2026.
+//
+
+#include <NCpu.h>
+#include <NBlas.h>
+#include <cstdlib>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define NCPU_X86_64
+
+#include <immintrin.h>
+#include <cpuid.h>
+
+#endif
+
+using namespace std;
+
+static_assert(NBLAS_MR == 4 && NBLAS_NR == 8, "GEMM micro-kernels compute 4 x 8 blocks");
+
+static_assert(sizeof(AESByte) == sizeof(uc_t), "AESByte must be stored as a single byte");
+
+// GALOIS FIELD TABLES
+
+/**
+ * Logarithm and exponential tables of GF(2^8) in base 0x03. The exponential table is repeated twice so that the sum of
+ * two logarithms can be used as an index without reduction.
+ */
+struct NGFTables {
+    NGFTables() : exp(), log() {
+        uc_t x = 1;
+        for (size_t k = 0; k < 255; ++k) {
+            exp[k] = exp[k + 255] = x;
+            log[x] = (uc_t) k;
+            x ^= (uc_t) ((x << 1) ^ ((x & 0x80) != 0 ? 0x1b : 0x00));
+        }
+    }
+
+    inline uc_t mul(uc_t a, uc_t b) const { return (a == 0 || b == 0) ? uc_t(0) : exp[log[a] + log[b]]; }
+
+    uc_t exp[512];
+
+    uc_t log[256];
+};
+
+static const NGFTables &gfTables() {
+    static const NGFTables tables;
+    return tables;
+}
+
+/**
+ * Products of `alpha` by the low and the high nibbles of a byte.
+ */
+static void gfNibbles(uc_t alpha, uc_t *lo, uc_t *hi) {
+    const NGFTables &gf = gfTables();
+    for (uc_t k = 0; k < 16; ++k) {
+        lo[k] = gf.mul(alpha, k);
+        hi[k] = gf.mul(alpha, (uc_t) (k << 4));
+    }
+}
+
+// SCALAR KERNELS
+
+static double_t dotScalar(size_t n, const double_t *x, const double_t *y) {
+    double_t acc[4] = {0, 0, 0, 0};
+    size_t k = 0;
+    for (; k + 4 <= n; k += 4) {
+        acc[0] += x[k] * y[k];
+        acc[1] += x[k + 1] * y[k + 1];
+        acc[2] += x[k + 2] * y[k + 2];
+        acc[3] += x[k + 3] * y[k + 3];
+    }
+    for (; k < n; ++k) {
+        acc[0] += x[k] * y[k];
+    }
+    return (acc[0] + acc[1]) + (acc[2] + acc[3]);
+}
+
+static double_t dist2Scalar(size_t n, const double_t *x, const double_t *y) {
+    double_t acc[4] = {0, 0, 0, 0};
+    size_t k = 0;
+    for (; k + 4 <= n; k += 4) {
+        for (size_t r = 0; r < 4; ++r) {
+            double_t d = x[k + r] - y[k + r];
+            acc[r] += d * d;
+        }
+    }
+    for (; k < n; ++k) {
+        double_t d = x[k] - y[k];
+        acc[0] += d * d;
+    }
+    return (acc[0] + acc[1]) + (acc[2] + acc[3]);
+}
+
+static void axpyScalar(size_t n, double_t alpha, const double_t *x, double_t *y) {
+    for (size_t k = 0; k < n; ++k) {
+        y[k] += alpha * x[k];
+    }
+}
+
+static void addTile(const double_t acc[NBLAS_MR][NBLAS_NR], double_t *c, size_t ldc, size_t mr, size_t nr) {
+    for (size_t i = 0; i < mr; ++i) {
+        for (size_t j = 0; j < nr; ++j) {
+            c[i * ldc + j] += acc[i][j];
+        }
+    }
+}
+
+static void gemmScalar(size_t kc, const double_t *packed_a, const double_t *packed_b, double_t *c, size_t ldc,
+                       size_t mr, size_t nr) {
+    double_t acc[NBLAS_MR][NBLAS_NR] = {};
+
+    for (size_t k = 0; k < kc; ++k) {
+        for (size_t i = 0; i < NBLAS_MR; ++i) {
+            for (size_t j = 0; j < NBLAS_NR; ++j) {
+                acc[i][j] += packed_a[i] * packed_b[j];
+            }
+        }
+        packed_a += NBLAS_MR;
+        packed_b += NBLAS_NR;
+    }
+    addTile(acc, c, ldc, mr, nr);
+}
+
+static void gemvScalar(size_t n, size_t p, const double_t *a, size_t lda, const double_t *x, double_t *y) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const double_t *a0 = a + i * lda, *a1 = a0 + lda, *a2 = a1 + lda, *a3 = a2 + lda;
+        double_t acc[4] = {0, 0, 0, 0};
+        for (size_t j = 0; j < p; ++j) {
+            acc[0] += a0[j] * x[j];
+            acc[1] += a1[j] * x[j];
+            acc[2] += a2[j] * x[j];
+            acc[3] += a3[j] * x[j];
+        }
+        y[i] = acc[0];
+        y[i + 1] = acc[1];
+        y[i + 2] = acc[2];
+        y[i + 3] = acc[3];
+    }
+    for (; i < n; ++i) {
+        y[i] = dotScalar(p, a + i * lda, x);
+    }
+}
+
+static void gemvTScalar(size_t n, size_t p, const double_t *a, size_t lda, const double_t *x, double_t *y) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const double_t *a0 = a + i * lda, *a1 = a0 + lda, *a2 = a1 + lda, *a3 = a2 + lda;
+        for (size_t j = 0; j < p; ++j) {
+            y[j] += (x[i] * a0[j] + x[i + 1] * a1[j]) + (x[i + 2] * a2[j] + x[i + 3] * a3[j]);
+        }
+    }
+    for (; i < n; ++i) {
+        axpyScalar(p, x[i], a + i * lda, y);
+    }
+}
+
+/**
+ * Transpose the rows `[n0, n)` and the columns `[p0, p)` of a tile whose other coefficients were processed by a SIMD
+ * kernel.
+ */
+static void transposeEdges(size_t n, size_t p, size_t n0, size_t p0, const double_t *a, size_t lda, double_t *b,
+                           size_t ldb) {
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = (i < n0) ? p0 : 0; j < p; ++j) {
+            b[j * ldb + i] = a[i * lda + j];
+        }
+    }
+}
+
+static void transposeScalar(size_t n, size_t p, const double_t *a, size_t lda, double_t *b, size_t ldb) {
+    transposeEdges(n, p, 0, 0, a, lda, b, ldb);
+}
+
+static void gfAxpyScalar(size_t n, uc_t alpha, const uc_t *x, uc_t *y) {
+    uc_t lo[16], hi[16];
+    gfNibbles(alpha, lo, hi);
+    for (size_t k = 0; k < n; ++k) {
+        y[k] ^= (uc_t) (lo[x[k] & 0x0f] ^ hi[x[k] >> 4]);
+    }
+}
+
+static inline double_t dot3At(const double_t *const *u, const double_t *const *v, size_t k) {
+    return u[0][k] * v[0][k] + u[1][k] * v[1][k] + u[2][k] * v[2][k];
+}
+
+static inline void cross3At(double_t *const *u, const double_t *const *v, size_t k) {
+    const double_t x = u[1][k] * v[2][k] - u[2][k] * v[1][k];
+    const double_t y = u[2][k] * v[0][k] - u[0][k] * v[2][k];
+    const double_t z = u[0][k] * v[1][k] - u[1][k] * v[0][k];
+    u[0][k] = x;
+    u[1][k] = y;
+    u[2][k] = z;
+}
+
+static inline void normalize3At(double_t *const *u, size_t k) {
+    const double_t r = sqrt(dot3At(u, u, k));
+    if (r > 0) {
+        const double_t inv = 1 / r;
+        u[0][k] *= inv;
+        u[1][k] *= inv;
+        u[2][k] *= inv;
+    }
+}
+
+static void dot3Scalar(size_t n, const double_t *const *u, const double_t *const *v, double_t *d) {
+    for (size_t k = 0; k < n; ++k) {
+        d[k] = dot3At(u, v, k);
+    }
+}
+
+static void cross3Scalar(size_t n, double_t *const *u, const double_t *const *v) {
+    for (size_t k = 0; k < n; ++k) {
+        cross3At(u, v, k);
+    }
+}
+
+static void norm3Scalar(size_t n, const double_t *const *u, double_t *r) {
+    for (size_t k = 0; k < n; ++k) {
+        r[k] = sqrt(dot3At(u, u, k));
+    }
+}
+
+static void normalize3Scalar(size_t n, double_t *const *u) {
+    for (size_t k = 0; k < n; ++k) {
+        normalize3At(u, k);
+    }
+}
+
+#ifdef NCPU_X86_64
+
+// SSE2 KERNELS
+
+__attribute__((target("sse2")))
+static double_t hsumSSE2(__m128d a) {
+    return _mm_cvtsd_f64(_mm_add_sd(a, _mm_unpackhi_pd(a, a)));
+}
+
+__attribute__((target("sse2")))
+static double_t dotSSE2(size_t n, const double_t *x, const double_t *y) {
+    __m128d a0 = _mm_setzero_pd(), a1 = _mm_setzero_pd(), a2 = _mm_setzero_pd(), a3 = _mm_setzero_pd();
+    size_t k = 0;
+    for (; k + 8 <= n; k += 8) {
+        a0 = _mm_add_pd(a0, _mm_mul_pd(_mm_loadu_pd(x + k), _mm_loadu_pd(y + k)));
+        a1 = _mm_add_pd(a1, _mm_mul_pd(_mm_loadu_pd(x + k + 2), _mm_loadu_pd(y + k + 2)));
+        a2 = _mm_add_pd(a2, _mm_mul_pd(_mm_loadu_pd(x + k + 4), _mm_loadu_pd(y + k + 4)));
+        a3 = _mm_add_pd(a3, _mm_mul_pd(_mm_loadu_pd(x + k + 6), _mm_loadu_pd(y + k + 6)));
+    }
+    double_t dot = hsumSSE2(_mm_add_pd(_mm_add_pd(a0, a1), _mm_add_pd(a2, a3)));
+    for (; k < n; ++k) {
+        dot += x[k] * y[k];
+    }
+    return dot;
+}
+
+__attribute__((target("sse2")))
+static double_t dist2SSE2(size_t n, const double_t *x, const double_t *y) {
+    __m128d a0 = _mm_setzero_pd(), a1 = _mm_setzero_pd(), a2 = _mm_setzero_pd(), a3 = _mm_setzero_pd();
+    size_t k = 0;
+    for (; k + 8 <= n; k += 8) {
+        __m128d d0 = _mm_sub_pd(_mm_loadu_pd(x + k), _mm_loadu_pd(y + k));
+        __m128d d1 = _mm_sub_pd(_mm_loadu_pd(x + k + 2), _mm_loadu_pd(y + k + 2));
+        __m128d d2 = _mm_sub_pd(_mm_loadu_pd(x + k + 4), _mm_loadu_pd(y + k + 4));
+        __m128d d3 = _mm_sub_pd(_mm_loadu_pd(x + k + 6), _mm_loadu_pd(y + k + 6));
+        a0 = _mm_add_pd(a0, _mm_mul_pd(d0, d0));
+        a1 = _mm_add_pd(a1, _mm_mul_pd(d1, d1));
+        a2 = _mm_add_pd(a2, _mm_mul_pd(d2, d2));
+        a3 = _mm_add_pd(a3, _mm_mul_pd(d3, d3));
+    }
+    double_t dist = hsumSSE2(_mm_add_pd(_mm_add_pd(a0, a1), _mm_add_pd(a2, a3)));
+    for (; k < n; ++k) {
+        double_t d = x[k] - y[k];
+        dist += d * d;
+    }
+    return dist;
+}
+
+__attribute__((target("sse2")))
+static void axpySSE2(size_t n, double_t alpha, const double_t *x, double_t *y) {
+    __m128d a = _mm_set1_pd(alpha);
+    size_t k = 0;
+    for (; k + 4 <= n; k += 4) {
+        _mm_storeu_pd(y + k, _mm_add_pd(_mm_loadu_pd(y + k), _mm_mul_pd(a, _mm_loadu_pd(x + k))));
+        _mm_storeu_pd(y + k + 2, _mm_add_pd(_mm_loadu_pd(y + k + 2), _mm_mul_pd(a, _mm_loadu_pd(x + k + 2))));
+    }
+    for (; k < n; ++k) {
+        y[k] += alpha * x[k];
+    }
+}
+
+__attribute__((target("sse2")))
+static void gemvSSE2(size_t n, size_t p, const double_t *a, size_t lda, const double_t *x, double_t *y) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const double_t *a0 = a + i * lda, *a1 = a0 + lda, *a2 = a1 + lda, *a3 = a2 + lda;
+        __m128d c0 = _mm_setzero_pd(), c1 = _mm_setzero_pd(), c2 = _mm_setzero_pd(), c3 = _mm_setzero_pd();
+        size_t j = 0;
+        for (; j + 2 <= p; j += 2) {
+            __m128d v = _mm_loadu_pd(x + j);
+            c0 = _mm_add_pd(c0, _mm_mul_pd(_mm_loadu_pd(a0 + j), v));
+            c1 = _mm_add_pd(c1, _mm_mul_pd(_mm_loadu_pd(a1 + j), v));
+            c2 = _mm_add_pd(c2, _mm_mul_pd(_mm_loadu_pd(a2 + j), v));
+            c3 = _mm_add_pd(c3, _mm_mul_pd(_mm_loadu_pd(a3 + j), v));
+        }
+        y[i] = hsumSSE2(c0);
+        y[i + 1] = hsumSSE2(c1);
+        y[i + 2] = hsumSSE2(c2);
+        y[i + 3] = hsumSSE2(c3);
+        for (; j < p; ++j) {
+            y[i] += a0[j] * x[j];
+            y[i + 1] += a1[j] * x[j];
+            y[i + 2] += a2[j] * x[j];
+            y[i + 3] += a3[j] * x[j];
+        }
+    }
+    for (; i < n; ++i) {
+        y[i] = dotSSE2(p, a + i * lda, x);
+    }
+}
+
+__attribute__((target("sse2")))
+static void gemvTSSE2(size_t n, size_t p, const double_t *a, size_t lda, const double_t *x, double_t *y) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const double_t *a0 = a + i * lda, *a1 = a0 + lda, *a2 = a1 + lda, *a3 = a2 + lda;
+        __m128d x0 = _mm_set1_pd(x[i]), x1 = _mm_set1_pd(x[i + 1]), x2 = _mm_set1_pd(x[i + 2]);
+        __m128d x3 = _mm_set1_pd(x[i + 3]);
+        size_t j = 0;
+        for (; j + 2 <= p; j += 2) {
+            __m128d s01 = _mm_add_pd(_mm_mul_pd(x0, _mm_loadu_pd(a0 + j)), _mm_mul_pd(x1, _mm_loadu_pd(a1 + j)));
+            __m128d s23 = _mm_add_pd(_mm_mul_pd(x2, _mm_loadu_pd(a2 + j)), _mm_mul_pd(x3, _mm_loadu_pd(a3 + j)));
+            _mm_storeu_pd(y + j, _mm_add_pd(_mm_loadu_pd(y + j), _mm_add_pd(s01, s23)));
+        }
+        for (; j < p; ++j) {
+            y[j] += (x[i] * a0[j] + x[i + 1] * a1[j]) + (x[i + 2] * a2[j] + x[i + 3] * a3[j]);
+        }
+    }
+    for (; i < n; ++i) {
+        axpySSE2(p, x[i], a + i * lda, y);
+    }
+}
+
+__attribute__((target("sse2")))
+static void gemmSSE2(size_t kc, const double_t *packed_a, const double_t *packed_b, double_t *c, size_t ldc,
+                     size_t mr, size_t nr) {
+    __m128d acc[NBLAS_MR][NBLAS_NR / 2];
+
+    for (size_t i = 0; i < NBLAS_MR; ++i) {
+        for (size_t j = 0; j < NBLAS_NR / 2; ++j) {
+            acc[i][j] = _mm_setzero_pd();
+        }
+    }
+    for (size_t k = 0; k < kc; ++k) {
+        for (size_t i = 0; i < NBLAS_MR; ++i) {
+            __m128d a = _mm_set1_pd(packed_a[i]);
+            for (size_t j = 0; j < NBLAS_NR / 2; ++j) {
+                acc[i][j] = _mm_add_pd(acc[i][j], _mm_mul_pd(a, _mm_load_pd(packed_b + 2 * j)));
+            }
+        }
+        packed_a += NBLAS_MR;
+        packed_b += NBLAS_NR;
+    }
+
+    double_t tile[NBLAS_MR][NBLAS_NR];
+    for (size_t i = 0; i < NBLAS_MR; ++i) {
+        for (size_t j = 0; j < NBLAS_NR / 2; ++j) {
+            _mm_storeu_pd(tile[i] + 2 * j, acc[i][j]);
+        }
+    }
+    addTile(tile, c, ldc, mr, nr);
+}
+
+__attribute__((target("sse2")))
+static void transposeSSE2(size_t n, size_t p, const double_t *a, size_t lda, double_t *b, size_t ldb) {
+    const size_t n0 = n & ~(size_t) 1, p0 = p & ~(size_t) 1;
+    for (size_t i = 0; i < n0; i += 2) {
+        for (size_t j = 0; j < p0; j += 2) {
+            __m128d r0 = _mm_loadu_pd(a + i * lda + j), r1 = _mm_loadu_pd(a + (i + 1) * lda + j);
+            _mm_storeu_pd(b + j * ldb + i, _mm_unpacklo_pd(r0, r1));
+            _mm_storeu_pd(b + (j + 1) * ldb + i, _mm_unpackhi_pd(r0, r1));
+        }
+    }
+    transposeEdges(n, p, n0, p0, a, lda, b, ldb);
+}
+
+__attribute__((target("sse2")))
+static void dot3SSE2(size_t n, const double_t *const *u, const double_t *const *v, double_t *d) {
+    size_t k = 0;
+    for (; k + 2 <= n; k += 2) {
+        __m128d x = _mm_mul_pd(_mm_loadu_pd(u[0] + k), _mm_loadu_pd(v[0] + k));
+        __m128d y = _mm_mul_pd(_mm_loadu_pd(u[1] + k), _mm_loadu_pd(v[1] + k));
+        __m128d z = _mm_mul_pd(_mm_loadu_pd(u[2] + k), _mm_loadu_pd(v[2] + k));
+        _mm_storeu_pd(d + k, _mm_add_pd(_mm_add_pd(x, y), z));
+    }
+    for (; k < n; ++k) {
+        d[k] = dot3At(u, v, k);
+    }
+}
+
+__attribute__((target("sse2")))
+static void cross3SSE2(size_t n, double_t *const *u, const double_t *const *v) {
+    size_t k = 0;
+    for (; k + 2 <= n; k += 2) {
+        __m128d ux = _mm_loadu_pd(u[0] + k), uy = _mm_loadu_pd(u[1] + k), uz = _mm_loadu_pd(u[2] + k);
+        __m128d vx = _mm_loadu_pd(v[0] + k), vy = _mm_loadu_pd(v[1] + k), vz = _mm_loadu_pd(v[2] + k);
+        _mm_storeu_pd(u[0] + k, _mm_sub_pd(_mm_mul_pd(uy, vz), _mm_mul_pd(uz, vy)));
+        _mm_storeu_pd(u[1] + k, _mm_sub_pd(_mm_mul_pd(uz, vx), _mm_mul_pd(ux, vz)));
+        _mm_storeu_pd(u[2] + k, _mm_sub_pd(_mm_mul_pd(ux, vy), _mm_mul_pd(uy, vx)));
+    }
+    for (; k < n; ++k) {
+        cross3At(u, v, k);
+    }
+}
+
+__attribute__((target("sse2")))
+static void norm3SSE2(size_t n, const double_t *const *u, double_t *r) {
+    dot3SSE2(n, u, u, r);
+    size_t k = 0;
+    for (; k + 2 <= n; k += 2) {
+        _mm_storeu_pd(r + k, _mm_sqrt_pd(_mm_loadu_pd(r + k)));
+    }
+    for (; k < n; ++k) {
+        r[k] = sqrt(r[k]);
+    }
+}
+
+__attribute__((target("sse2")))
+static void normalize3SSE2(size_t n, double_t *const *u) {
+    const __m128d zero = _mm_setzero_pd(), one = _mm_set1_pd(1);
+    size_t k = 0;
+    for (; k + 2 <= n; k += 2) {
+        __m128d x = _mm_loadu_pd(u[0] + k), y = _mm_loadu_pd(u[1] + k), z = _mm_loadu_pd(u[2] + k);
+        __m128d r = _mm_sqrt_pd(_mm_add_pd(_mm_add_pd(_mm_mul_pd(x, x), _mm_mul_pd(y, y)), _mm_mul_pd(z, z)));
+        __m128d positive = _mm_cmpgt_pd(r, zero);
+        __m128d inv = _mm_or_pd(_mm_and_pd(positive, _mm_div_pd(one, r)), _mm_andnot_pd(positive, one));
+        _mm_storeu_pd(u[0] + k, _mm_mul_pd(x, inv));
+        _mm_storeu_pd(u[1] + k, _mm_mul_pd(y, inv));
+        _mm_storeu_pd(u[2] + k, _mm_mul_pd(z, inv));
+    }
+    for (; k < n; ++k) {
+        normalize3At(u, k);
+    }
+}
+
+// AVX2 KERNELS
+
+__attribute__((target("avx2,fma")))
+static double_t hsumAVX2(__m256d a) {
+    __m128d h = _mm_add_pd(_mm256_castpd256_pd128(a), _mm256_extractf128_pd(a, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(h, _mm_unpackhi_pd(h, h)));
+}
+
+__attribute__((target("avx2,fma")))
+static double_t dotAVX2(size_t n, const double_t *x, const double_t *y) {
+    __m256d a0 = _mm256_setzero_pd(), a1 = _mm256_setzero_pd(), a2 = _mm256_setzero_pd(), a3 = _mm256_setzero_pd();
+    size_t k = 0;
+    for (; k + 16 <= n; k += 16) {
+        a0 = _mm256_fmadd_pd(_mm256_loadu_pd(x + k), _mm256_loadu_pd(y + k), a0);
+        a1 = _mm256_fmadd_pd(_mm256_loadu_pd(x + k + 4), _mm256_loadu_pd(y + k + 4), a1);
+        a2 = _mm256_fmadd_pd(_mm256_loadu_pd(x + k + 8), _mm256_loadu_pd(y + k + 8), a2);
+        a3 = _mm256_fmadd_pd(_mm256_loadu_pd(x + k + 12), _mm256_loadu_pd(y + k + 12), a3);
+    }
+    for (; k + 4 <= n; k += 4) {
+        a0 = _mm256_fmadd_pd(_mm256_loadu_pd(x + k), _mm256_loadu_pd(y + k), a0);
+    }
+    double_t dot = hsumAVX2(_mm256_add_pd(_mm256_add_pd(a0, a1), _mm256_add_pd(a2, a3)));
+    for (; k < n; ++k) {
+        dot += x[k] * y[k];
+    }
+    return dot;
+}
+
+__attribute__((target("avx2,fma")))
+static double_t dist2AVX2(size_t n, const double_t *x, const double_t *y) {
+    __m256d a0 = _mm256_setzero_pd(), a1 = _mm256_setzero_pd(), a2 = _mm256_setzero_pd(), a3 = _mm256_setzero_pd();
+    size_t k = 0;
+    for (; k + 16 <= n; k += 16) {
+        __m256d d0 = _mm256_sub_pd(_mm256_loadu_pd(x + k), _mm256_loadu_pd(y + k));
+        __m256d d1 = _mm256_sub_pd(_mm256_loadu_pd(x + k + 4), _mm256_loadu_pd(y + k + 4));
+        __m256d d2 = _mm256_sub_pd(_mm256_loadu_pd(x + k + 8), _mm256_loadu_pd(y + k + 8));
+        __m256d d3 = _mm256_sub_pd(_mm256_loadu_pd(x + k + 12), _mm256_loadu_pd(y + k + 12));
+        a0 = _mm256_fmadd_pd(d0, d0, a0);
+        a1 = _mm256_fmadd_pd(d1, d1, a1);
+        a2 = _mm256_fmadd_pd(d2, d2, a2);
+        a3 = _mm256_fmadd_pd(d3, d3, a3);
+    }
+    for (; k + 4 <= n; k += 4) {
+        __m256d d0 = _mm256_sub_pd(_mm256_loadu_pd(x + k), _mm256_loadu_pd(y + k));
+        a0 = _mm256_fmadd_pd(d0, d0, a0);
+    }
+    double_t dist = hsumAVX2(_mm256_add_pd(_mm256_add_pd(a0, a1), _mm256_add_pd(a2, a3)));
+    for (; k < n; ++k) {
+        double_t d = x[k] - y[k];
+        dist += d * d;
+    }
+    return dist;
+}
+
+__attribute__((target("avx2,fma")))
+static void axpyAVX2(size_t n, double_t alpha, const double_t *x, double_t *y) {
+    __m256d a = _mm256_set1_pd(alpha);
+    size_t k = 0;
+    for (; k + 8 <= n; k += 8) {
+        _mm256_storeu_pd(y + k, _mm256_fmadd_pd(a, _mm256_loadu_pd(x + k), _mm256_loadu_pd(y + k)));
+        _mm256_storeu_pd(y + k + 4, _mm256_fmadd_pd(a, _mm256_loadu_pd(x + k + 4), _mm256_loadu_pd(y + k + 4)));
+    }
+    for (; k < n; ++k) {
+        y[k] += alpha * x[k];
+    }
+}
+
+__attribute__((target("avx2,fma")))
+static void gemvAVX2(size_t n, size_t p, const double_t *a, size_t lda, const double_t *x, double_t *y) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const double_t *a0 = a + i * lda, *a1 = a0 + lda, *a2 = a1 + lda, *a3 = a2 + lda;
+        __m256d c0 = _mm256_setzero_pd(), c1 = _mm256_setzero_pd(), c2 = _mm256_setzero_pd();
+        __m256d c3 = _mm256_setzero_pd();
+        size_t j = 0;
+        for (; j + 4 <= p; j += 4) {
+            __m256d v = _mm256_loadu_pd(x + j);
+            c0 = _mm256_fmadd_pd(_mm256_loadu_pd(a0 + j), v, c0);
+            c1 = _mm256_fmadd_pd(_mm256_loadu_pd(a1 + j), v, c1);
+            c2 = _mm256_fmadd_pd(_mm256_loadu_pd(a2 + j), v, c2);
+            c3 = _mm256_fmadd_pd(_mm256_loadu_pd(a3 + j), v, c3);
+        }
+
+        // Horizontal sums of the four accumulators in a single register
+        __m256d s01 = _mm256_hadd_pd(c0, c1), s23 = _mm256_hadd_pd(c2, c3);
+        __m256d s = _mm256_add_pd(_mm256_permute2f128_pd(s01, s23, 0x20), _mm256_permute2f128_pd(s01, s23, 0x31));
+        for (; j < p; ++j) {
+            s = _mm256_fmadd_pd(_mm256_set_pd(a3[j], a2[j], a1[j], a0[j]), _mm256_set1_pd(x[j]), s);
+        }
+        _mm256_storeu_pd(y + i, s);
+    }
+    for (; i < n; ++i) {
+        y[i] = dotAVX2(p, a + i * lda, x);
+    }
+}
+
+__attribute__((target("avx2,fma")))
+static void gemvTAVX2(size_t n, size_t p, const double_t *a, size_t lda, const double_t *x, double_t *y) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const double_t *a0 = a + i * lda, *a1 = a0 + lda, *a2 = a1 + lda, *a3 = a2 + lda;
+        __m256d x0 = _mm256_set1_pd(x[i]), x1 = _mm256_set1_pd(x[i + 1]), x2 = _mm256_set1_pd(x[i + 2]);
+        __m256d x3 = _mm256_set1_pd(x[i + 3]);
+        size_t j = 0;
+        for (; j + 4 <= p; j += 4) {
+            __m256d s01 = _mm256_fmadd_pd(x1, _mm256_loadu_pd(a1 + j), _mm256_mul_pd(x0, _mm256_loadu_pd(a0 + j)));
+            __m256d s23 = _mm256_fmadd_pd(x3, _mm256_loadu_pd(a3 + j), _mm256_mul_pd(x2, _mm256_loadu_pd(a2 + j)));
+            _mm256_storeu_pd(y + j, _mm256_add_pd(_mm256_loadu_pd(y + j), _mm256_add_pd(s01, s23)));
+        }
+        for (; j < p; ++j) {
+            y[j] += (x[i] * a0[j] + x[i + 1] * a1[j]) + (x[i + 2] * a2[j] + x[i + 3] * a3[j]);
+        }
+    }
+    for (; i < n; ++i) {
+        axpyAVX2(p, x[i], a + i * lda, y);
+    }
+}
+
+__attribute__((target("avx2,fma")))
+static void gemmAVX2(size_t kc, const double_t *packed_a, const double_t *packed_b, double_t *c, size_t ldc,
+                     size_t mr, size_t nr) {
+    __m256d c00 = _mm256_setzero_pd(), c01 = _mm256_setzero_pd(), c10 = _mm256_setzero_pd(), c11 = _mm256_setzero_pd();
+    __m256d c20 = _mm256_setzero_pd(), c21 = _mm256_setzero_pd(), c30 = _mm256_setzero_pd(), c31 = _mm256_setzero_pd();
+
+    for (size_t k = 0; k < kc; ++k) {
+        __m256d b0 = _mm256_load_pd(packed_b), b1 = _mm256_load_pd(packed_b + 4), a;
+
+        a = _mm256_broadcast_sd(packed_a);
+        c00 = _mm256_fmadd_pd(a, b0, c00);
+        c01 = _mm256_fmadd_pd(a, b1, c01);
+        a = _mm256_broadcast_sd(packed_a + 1);
+        c10 = _mm256_fmadd_pd(a, b0, c10);
+        c11 = _mm256_fmadd_pd(a, b1, c11);
+        a = _mm256_broadcast_sd(packed_a + 2);
+        c20 = _mm256_fmadd_pd(a, b0, c20);
+        c21 = _mm256_fmadd_pd(a, b1, c21);
+        a = _mm256_broadcast_sd(packed_a + 3);
+        c30 = _mm256_fmadd_pd(a, b0, c30);
+        c31 = _mm256_fmadd_pd(a, b1, c31);
+
+        packed_a += NBLAS_MR;
+        packed_b += NBLAS_NR;
+    }
+
+    double_t tile[NBLAS_MR][NBLAS_NR];
+    _mm256_storeu_pd(tile[0], c00);
+    _mm256_storeu_pd(tile[0] + 4, c01);
+    _mm256_storeu_pd(tile[1], c10);
+    _mm256_storeu_pd(tile[1] + 4, c11);
+    _mm256_storeu_pd(tile[2], c20);
+    _mm256_storeu_pd(tile[2] + 4, c21);
+    _mm256_storeu_pd(tile[3], c30);
+    _mm256_storeu_pd(tile[3] + 4, c31);
+    addTile(tile, c, ldc, mr, nr);
+}
+
+__attribute__((target("avx2")))
+static void transposeAVX2(size_t n, size_t p, const double_t *a, size_t lda, double_t *b, size_t ldb) {
+    const size_t n0 = n & ~(size_t) 3, p0 = p & ~(size_t) 3;
+    for (size_t i = 0; i < n0; i += 4) {
+        for (size_t j = 0; j < p0; j += 4) {
+            const double_t *a0 = a + i * lda + j;
+            __m256d r0 = _mm256_loadu_pd(a0), r1 = _mm256_loadu_pd(a0 + lda);
+            __m256d r2 = _mm256_loadu_pd(a0 + 2 * lda), r3 = _mm256_loadu_pd(a0 + 3 * lda);
+
+            // Transpose the 2 x 2 blocks of pairs within the lanes, then exchange the off-diagonal lanes
+            __m256d t0 = _mm256_unpacklo_pd(r0, r1), t1 = _mm256_unpackhi_pd(r0, r1);
+            __m256d t2 = _mm256_unpacklo_pd(r2, r3), t3 = _mm256_unpackhi_pd(r2, r3);
+            double_t *b0 = b + j * ldb + i;
+            _mm256_storeu_pd(b0, _mm256_permute2f128_pd(t0, t2, 0x20));
+            _mm256_storeu_pd(b0 + ldb, _mm256_permute2f128_pd(t1, t3, 0x20));
+            _mm256_storeu_pd(b0 + 2 * ldb, _mm256_permute2f128_pd(t0, t2, 0x31));
+            _mm256_storeu_pd(b0 + 3 * ldb, _mm256_permute2f128_pd(t1, t3, 0x31));
+        }
+    }
+    transposeEdges(n, p, n0, p0, a, lda, b, ldb);
+}
+
+__attribute__((target("avx2")))
+static void gfAxpyAVX2(size_t n, uc_t alpha, const uc_t *x, uc_t *y) {
+    uc_t lo[16], hi[16];
+    gfNibbles(alpha, lo, hi);
+
+    __m256i t_lo = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) lo));
+    __m256i t_hi = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) hi));
+    __m256i mask = _mm256_set1_epi8(0x0f);
+    size_t k = 0;
+    for (; k + 32 <= n; k += 32) {
+        __m256i u = _mm256_loadu_si256((const __m256i *) (x + k));
+        __m256i u_lo = _mm256_and_si256(u, mask), u_hi = _mm256_and_si256(_mm256_srli_epi16(u, 4), mask);
+        __m256i prod = _mm256_xor_si256(_mm256_shuffle_epi8(t_lo, u_lo), _mm256_shuffle_epi8(t_hi, u_hi));
+        _mm256_storeu_si256((__m256i *) (y + k), _mm256_xor_si256(_mm256_loadu_si256((const __m256i *) (y + k)), prod));
+    }
+    for (; k < n; ++k) {
+        y[k] ^= (uc_t) (lo[x[k] & 0x0f] ^ hi[x[k] >> 4]);
+    }
+}
+
+__attribute__((target("avx2,fma")))
+static void dot3AVX2(size_t n, const double_t *const *u, const double_t *const *v, double_t *d) {
+    size_t k = 0;
+    for (; k + 4 <= n; k += 4) {
+        __m256d dot = _mm256_mul_pd(_mm256_loadu_pd(u[0] + k), _mm256_loadu_pd(v[0] + k));
+        dot = _mm256_fmadd_pd(_mm256_loadu_pd(u[1] + k), _mm256_loadu_pd(v[1] + k), dot);
+        dot = _mm256_fmadd_pd(_mm256_loadu_pd(u[2] + k), _mm256_loadu_pd(v[2] + k), dot);
+        _mm256_storeu_pd(d + k, dot);
+    }
+    for (; k < n; ++k) {
+        d[k] = dot3At(u, v, k);
+    }
+}
+
+__attribute__((target("avx2,fma")))
+static void cross3AVX2(size_t n, double_t *const *u, const double_t *const *v) {
+    size_t k = 0;
+    for (; k + 4 <= n; k += 4) {
+        __m256d ux = _mm256_loadu_pd(u[0] + k), uy = _mm256_loadu_pd(u[1] + k), uz = _mm256_loadu_pd(u[2] + k);
+        __m256d vx = _mm256_loadu_pd(v[0] + k), vy = _mm256_loadu_pd(v[1] + k), vz = _mm256_loadu_pd(v[2] + k);
+        _mm256_storeu_pd(u[0] + k, _mm256_fmsub_pd(uy, vz, _mm256_mul_pd(uz, vy)));
+        _mm256_storeu_pd(u[1] + k, _mm256_fmsub_pd(uz, vx, _mm256_mul_pd(ux, vz)));
+        _mm256_storeu_pd(u[2] + k, _mm256_fmsub_pd(ux, vy, _mm256_mul_pd(uy, vx)));
+    }
+    for (; k < n; ++k) {
+        cross3At(u, v, k);
+    }
+}
+
+__attribute__((target("avx2,fma")))
+static void norm3AVX2(size_t n, const double_t *const *u, double_t *r) {
+    size_t k = 0;
+    for (; k + 4 <= n; k += 4) {
+        __m256d x = _mm256_loadu_pd(u[0] + k), y = _mm256_loadu_pd(u[1] + k), z = _mm256_loadu_pd(u[2] + k);
+        __m256d r2 = _mm256_fmadd_pd(z, z, _mm256_fmadd_pd(y, y, _mm256_mul_pd(x, x)));
+        _mm256_storeu_pd(r + k, _mm256_sqrt_pd(r2));
+    }
+    for (; k < n; ++k) {
+        r[k] = sqrt(dot3At(u, u, k));
+    }
+}
+
+__attribute__((target("avx2,fma")))
+static void normalize3AVX2(size_t n, double_t *const *u) {
+    const __m256d zero = _mm256_setzero_pd(), one = _mm256_set1_pd(1);
+    size_t k = 0;
+    for (; k + 4 <= n; k += 4) {
+        __m256d x = _mm256_loadu_pd(u[0] + k), y = _mm256_loadu_pd(u[1] + k), z = _mm256_loadu_pd(u[2] + k);
+        __m256d r = _mm256_sqrt_pd(_mm256_fmadd_pd(z, z, _mm256_fmadd_pd(y, y, _mm256_mul_pd(x, x))));
+        __m256d inv = _mm256_blendv_pd(one, _mm256_div_pd(one, r), _mm256_cmp_pd(r, zero, _CMP_GT_OQ));
+        _mm256_storeu_pd(u[0] + k, _mm256_mul_pd(x, inv));
+        _mm256_storeu_pd(u[1] + k, _mm256_mul_pd(y, inv));
+        _mm256_storeu_pd(u[2] + k, _mm256_mul_pd(z, inv));
+    }
+    for (; k < n; ++k) {
+        normalize3At(u, k);
+    }
+}
+
+// AVX-512 KERNELS
+
+static inline __mmask8 tailMask8(size_t r) {
+    return (__mmask8) (r >= 8 ? 0xFF : (1u << r) - 1);
+}
+
+static inline __mmask64 tailMask64(size_t r) {
+    return r >= 64 ? ~(__mmask64) 0 : ((__mmask64) 1 << r) - 1;
+}
+
+__attribute__((target("avx512f")))
+static double_t dotAVX512(size_t n, const double_t *x, const double_t *y) {
+    __m512d a0 = _mm512_setzero_pd(), a1 = _mm512_setzero_pd(), a2 = _mm512_setzero_pd(), a3 = _mm512_setzero_pd();
+    size_t k = 0;
+    for (; k + 32 <= n; k += 32) {
+        a0 = _mm512_fmadd_pd(_mm512_loadu_pd(x + k), _mm512_loadu_pd(y + k), a0);
+        a1 = _mm512_fmadd_pd(_mm512_loadu_pd(x + k + 8), _mm512_loadu_pd(y + k + 8), a1);
+        a2 = _mm512_fmadd_pd(_mm512_loadu_pd(x + k + 16), _mm512_loadu_pd(y + k + 16), a2);
+        a3 = _mm512_fmadd_pd(_mm512_loadu_pd(x + k + 24), _mm512_loadu_pd(y + k + 24), a3);
+    }
+    for (; k < n; k += 8) {
+        __mmask8 mask = tailMask8(n - k);
+        a0 = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask, x + k), _mm512_maskz_loadu_pd(mask, y + k), a0);
+    }
+    return _mm512_reduce_add_pd(_mm512_add_pd(_mm512_add_pd(a0, a1), _mm512_add_pd(a2, a3)));
+}
+
+__attribute__((target("avx512f")))
+static double_t dist2AVX512(size_t n, const double_t *x, const double_t *y) {
+    __m512d a0 = _mm512_setzero_pd(), a1 = _mm512_setzero_pd(), a2 = _mm512_setzero_pd(), a3 = _mm512_setzero_pd();
+    size_t k = 0;
+    for (; k + 32 <= n; k += 32) {
+        __m512d d0 = _mm512_sub_pd(_mm512_loadu_pd(x + k), _mm512_loadu_pd(y + k));
+        __m512d d1 = _mm512_sub_pd(_mm512_loadu_pd(x + k + 8), _mm512_loadu_pd(y + k + 8));
+        __m512d d2 = _mm512_sub_pd(_mm512_loadu_pd(x + k + 16), _mm512_loadu_pd(y + k + 16));
+        __m512d d3 = _mm512_sub_pd(_mm512_loadu_pd(x + k + 24), _mm512_loadu_pd(y + k + 24));
+        a0 = _mm512_fmadd_pd(d0, d0, a0);
+        a1 = _mm512_fmadd_pd(d1, d1, a1);
+        a2 = _mm512_fmadd_pd(d2, d2, a2);
+        a3 = _mm512_fmadd_pd(d3, d3, a3);
+    }
+    for (; k < n; k += 8) {
+        __mmask8 mask = tailMask8(n - k);
+        __m512d d0 = _mm512_sub_pd(_mm512_maskz_loadu_pd(mask, x + k), _mm512_maskz_loadu_pd(mask, y + k));
+        a0 = _mm512_fmadd_pd(d0, d0, a0);
+    }
+    return _mm512_reduce_add_pd(_mm512_add_pd(_mm512_add_pd(a0, a1), _mm512_add_pd(a2, a3)));
+}
+
+__attribute__((target("avx512f")))
+static void axpyAVX512(size_t n, double_t alpha, const double_t *x, double_t *y) {
+    __m512d a = _mm512_set1_pd(alpha);
+    size_t k = 0;
+    for (; k + 16 <= n; k += 16) {
+        _mm512_storeu_pd(y + k, _mm512_fmadd_pd(a, _mm512_loadu_pd(x + k), _mm512_loadu_pd(y + k)));
+        _mm512_storeu_pd(y + k + 8, _mm512_fmadd_pd(a, _mm512_loadu_pd(x + k + 8), _mm512_loadu_pd(y + k + 8)));
+    }
+    for (; k < n; k += 8) {
+        __mmask8 mask = tailMask8(n - k);
+        __m512d v = _mm512_fmadd_pd(a, _mm512_maskz_loadu_pd(mask, x + k), _mm512_maskz_loadu_pd(mask, y + k));
+        _mm512_mask_storeu_pd(y + k, mask, v);
+    }
+}
+
+__attribute__((target("avx512f")))
+static void gemvAVX512(size_t n, size_t p, const double_t *a, size_t lda, const double_t *x, double_t *y) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const double_t *a0 = a + i * lda, *a1 = a0 + lda, *a2 = a1 + lda, *a3 = a2 + lda;
+        __m512d c0 = _mm512_setzero_pd(), c1 = _mm512_setzero_pd(), c2 = _mm512_setzero_pd();
+        __m512d c3 = _mm512_setzero_pd();
+        for (size_t j = 0; j < p; j += 8) {
+            __mmask8 mask = tailMask8(p - j);
+            __m512d v = _mm512_maskz_loadu_pd(mask, x + j);
+            c0 = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask, a0 + j), v, c0);
+            c1 = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask, a1 + j), v, c1);
+            c2 = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask, a2 + j), v, c2);
+            c3 = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask, a3 + j), v, c3);
+        }
+        y[i] = _mm512_reduce_add_pd(c0);
+        y[i + 1] = _mm512_reduce_add_pd(c1);
+        y[i + 2] = _mm512_reduce_add_pd(c2);
+        y[i + 3] = _mm512_reduce_add_pd(c3);
+    }
+    for (; i < n; ++i) {
+        y[i] = dotAVX512(p, a + i * lda, x);
+    }
+}
+
+__attribute__((target("avx512f")))
+static void gemvTAVX512(size_t n, size_t p, const double_t *a, size_t lda, const double_t *x, double_t *y) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const double_t *a0 = a + i * lda, *a1 = a0 + lda, *a2 = a1 + lda, *a3 = a2 + lda;
+        __m512d x0 = _mm512_set1_pd(x[i]), x1 = _mm512_set1_pd(x[i + 1]), x2 = _mm512_set1_pd(x[i + 2]);
+        __m512d x3 = _mm512_set1_pd(x[i + 3]);
+        for (size_t j = 0; j < p; j += 8) {
+            __mmask8 mask = tailMask8(p - j);
+            __m512d s01 = _mm512_fmadd_pd(x1, _mm512_maskz_loadu_pd(mask, a1 + j),
+                                          _mm512_mul_pd(x0, _mm512_maskz_loadu_pd(mask, a0 + j)));
+            __m512d s23 = _mm512_fmadd_pd(x3, _mm512_maskz_loadu_pd(mask, a3 + j),
+                                          _mm512_mul_pd(x2, _mm512_maskz_loadu_pd(mask, a2 + j)));
+            __m512d v = _mm512_add_pd(_mm512_maskz_loadu_pd(mask, y + j), _mm512_add_pd(s01, s23));
+            _mm512_mask_storeu_pd(y + j, mask, v);
+        }
+    }
+    for (; i < n; ++i) {
+        axpyAVX512(p, x[i], a + i * lda, y);
+    }
+}
+
+__attribute__((target("avx512f")))
+static void gemmAVX512(size_t kc, const double_t *packed_a, const double_t *packed_b, double_t *c, size_t ldc,
+                       size_t mr, size_t nr) {
+    __m512d c0 = _mm512_setzero_pd(), c1 = _mm512_setzero_pd(), c2 = _mm512_setzero_pd(), c3 = _mm512_setzero_pd();
+
+    for (size_t k = 0; k < kc; ++k) {
+        __m512d b = _mm512_load_pd(packed_b);
+
+        c0 = _mm512_fmadd_pd(_mm512_set1_pd(packed_a[0]), b, c0);
+        c1 = _mm512_fmadd_pd(_mm512_set1_pd(packed_a[1]), b, c1);
+        c2 = _mm512_fmadd_pd(_mm512_set1_pd(packed_a[2]), b, c2);
+        c3 = _mm512_fmadd_pd(_mm512_set1_pd(packed_a[3]), b, c3);
+
+        packed_a += NBLAS_MR;
+        packed_b += NBLAS_NR;
+    }
+
+    __m512d acc[NBLAS_MR] = {c0, c1, c2, c3};
+    __mmask8 mask = tailMask8(nr);
+    for (size_t i = 0; i < mr; ++i) {
+        double_t *c_i = c + i * ldc;
+        _mm512_mask_storeu_pd(c_i, mask, _mm512_add_pd(_mm512_maskz_loadu_pd(mask, c_i), acc[i]));
+    }
+}
+
+__attribute__((target("avx512f")))
+static void transposeAVX512(size_t n, size_t p, const double_t *a, size_t lda, double_t *b, size_t ldb) {
+    const size_t n0 = n & ~(size_t) 7, p0 = p & ~(size_t) 7;
+    for (size_t i = 0; i < n0; i += 8) {
+        for (size_t j = 0; j < p0; j += 8) {
+            const double_t *a0 = a + i * lda + j;
+            __m512d r[8], t[8], u[8];
+            for (size_t k = 0; k < 8; ++k) {
+                r[k] = _mm512_loadu_pd(a0 + k * lda);
+            }
+
+            // Interleave pairs of rows, gather the even and odd 128 bits lanes of pairs of rows, then of quadruples
+            for (size_t k = 0; k < 8; k += 2) {
+                t[k] = _mm512_unpacklo_pd(r[k], r[k + 1]);
+                t[k + 1] = _mm512_unpackhi_pd(r[k], r[k + 1]);
+            }
+            for (size_t k = 0; k < 8; k += 4) {
+                u[k] = _mm512_shuffle_f64x2(t[k], t[k + 2], 0x88);
+                u[k + 1] = _mm512_shuffle_f64x2(t[k + 1], t[k + 3], 0x88);
+                u[k + 2] = _mm512_shuffle_f64x2(t[k], t[k + 2], 0xDD);
+                u[k + 3] = _mm512_shuffle_f64x2(t[k + 1], t[k + 3], 0xDD);
+            }
+            double_t *b0 = b + j * ldb + i;
+            for (size_t k = 0; k < 4; ++k) {
+                _mm512_storeu_pd(b0 + k * ldb, _mm512_shuffle_f64x2(u[k], u[k + 4], 0x88));
+                _mm512_storeu_pd(b0 + (k + 4) * ldb, _mm512_shuffle_f64x2(u[k], u[k + 4], 0xDD));
+            }
+        }
+    }
+    transposeEdges(n, p, n0, p0, a, lda, b, ldb);
+}
+
+__attribute__((target("avx512f,avx512bw,gfni")))
+static void gfAxpyGFNI(size_t n, uc_t alpha, const uc_t *x, uc_t *y) {
+    __m512i a = _mm512_set1_epi8((char) alpha);
+    for (size_t k = 0; k < n; k += 64) {
+        __mmask64 mask = tailMask64(n - k);
+        __m512i prod = _mm512_gf2p8mul_epi8(a, _mm512_maskz_loadu_epi8(mask, x + k));
+        _mm512_mask_storeu_epi8(y + k, mask, _mm512_xor_si512(_mm512_maskz_loadu_epi8(mask, y + k), prod));
+    }
+}
+
+__attribute__((target("avx512f")))
+static void dot3AVX512(size_t n, const double_t *const *u, const double_t *const *v, double_t *d) {
+    for (size_t k = 0; k < n; k += 8) {
+        __mmask8 mask = tailMask8(n - k);
+        __m512d dot = _mm512_mul_pd(_mm512_maskz_loadu_pd(mask, u[0] + k), _mm512_maskz_loadu_pd(mask, v[0] + k));
+        dot = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask, u[1] + k), _mm512_maskz_loadu_pd(mask, v[1] + k), dot);
+        dot = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask, u[2] + k), _mm512_maskz_loadu_pd(mask, v[2] + k), dot);
+        _mm512_mask_storeu_pd(d + k, mask, dot);
+    }
+}
+
+__attribute__((target("avx512f")))
+static void cross3AVX512(size_t n, double_t *const *u, const double_t *const *v) {
+    for (size_t k = 0; k < n; k += 8) {
+        __mmask8 mask = tailMask8(n - k);
+        __m512d ux = _mm512_maskz_loadu_pd(mask, u[0] + k), uy = _mm512_maskz_loadu_pd(mask, u[1] + k);
+        __m512d uz = _mm512_maskz_loadu_pd(mask, u[2] + k), vx = _mm512_maskz_loadu_pd(mask, v[0] + k);
+        __m512d vy = _mm512_maskz_loadu_pd(mask, v[1] + k), vz = _mm512_maskz_loadu_pd(mask, v[2] + k);
+        _mm512_mask_storeu_pd(u[0] + k, mask, _mm512_fmsub_pd(uy, vz, _mm512_mul_pd(uz, vy)));
+        _mm512_mask_storeu_pd(u[1] + k, mask, _mm512_fmsub_pd(uz, vx, _mm512_mul_pd(ux, vz)));
+        _mm512_mask_storeu_pd(u[2] + k, mask, _mm512_fmsub_pd(ux, vy, _mm512_mul_pd(uy, vx)));
+    }
+}
+
+__attribute__((target("avx512f")))
+static void norm3AVX512(size_t n, const double_t *const *u, double_t *r) {
+    for (size_t k = 0; k < n; k += 8) {
+        __mmask8 mask = tailMask8(n - k);
+        __m512d x = _mm512_maskz_loadu_pd(mask, u[0] + k), y = _mm512_maskz_loadu_pd(mask, u[1] + k);
+        __m512d z = _mm512_maskz_loadu_pd(mask, u[2] + k);
+        __m512d r2 = _mm512_fmadd_pd(z, z, _mm512_fmadd_pd(y, y, _mm512_mul_pd(x, x)));
+        _mm512_mask_storeu_pd(r + k, mask, _mm512_sqrt_pd(r2));
+    }
+}
+
+__attribute__((target("avx512f")))
+static void normalize3AVX512(size_t n, double_t *const *u) {
+    const __m512d zero = _mm512_setzero_pd(), one = _mm512_set1_pd(1);
+    for (size_t k = 0; k < n; k += 8) {
+        __mmask8 mask = tailMask8(n - k);
+        __m512d x = _mm512_maskz_loadu_pd(mask, u[0] + k), y = _mm512_maskz_loadu_pd(mask, u[1] + k);
+        __m512d z = _mm512_maskz_loadu_pd(mask, u[2] + k);
+        __m512d r = _mm512_sqrt_pd(_mm512_fmadd_pd(z, z, _mm512_fmadd_pd(y, y, _mm512_mul_pd(x, x))));
+        __m512d inv = _mm512_mask_div_pd(one, _mm512_cmp_pd_mask(r, zero, _CMP_GT_OQ), one, r);
+        _mm512_mask_storeu_pd(u[0] + k, mask, _mm512_mul_pd(x, inv));
+        _mm512_mask_storeu_pd(u[1] + k, mask, _mm512_mul_pd(y, inv));
+        _mm512_mask_storeu_pd(u[2] + k, mask, _mm512_mul_pd(z, inv));
+    }
+}
+
+#endif
+
+// DISPATCHER
+
+NCpu &NCpu::instance() {
+    static NCpu cpu;
+    return cpu;
+}
+
+NCpu::NCpu() : _level(Scalar), _max_level(Scalar), _gfni(false), _avx512bw(false), _kernels() {
+    detect();
+
+    Level level = _max_level;
+    const char *env = getenv(NCPU_ENV);
+    if (env != nullptr) {
+        parseLevel(env, level);
+    }
+    setLevel(level);
+}
+
+void NCpu::setLevel(Level level) {
+    _level = min(level, _max_level);
+    _kernels = {dotScalar, dist2Scalar, axpyScalar, gemvScalar, gemvTScalar, gemmScalar, transposeScalar, gfAxpyScalar,
+                dot3Scalar, cross3Scalar, norm3Scalar, normalize3Scalar};
+
+#ifdef NCPU_X86_64
+    switch (_level) {
+        case AVX512:
+            _kernels = {dotAVX512, dist2AVX512, axpyAVX512, gemvAVX512, gemvTAVX512, gemmAVX512, transposeAVX512,
+                        gfAxpyAVX2, dot3AVX512, cross3AVX512, norm3AVX512, normalize3AVX512};
+            if (_avx512bw && _gfni) {
+                _kernels.gfAxpy = gfAxpyGFNI;
+            }
+            break;
+        case AVX2:
+            _kernels = {dotAVX2, dist2AVX2, axpyAVX2, gemvAVX2, gemvTAVX2, gemmAVX2, transposeAVX2, gfAxpyAVX2,
+                        dot3AVX2, cross3AVX2, norm3AVX2, normalize3AVX2};
+            break;
+        case SSE2:
+            _kernels = {dotSSE2, dist2SSE2, axpySSE2, gemvSSE2, gemvTSSE2, gemmSSE2, transposeSSE2, gfAxpyScalar,
+                        dot3SSE2, cross3SSE2, norm3SSE2, normalize3SSE2};
+            break;
+        case Scalar:
+            break;
+    }
+#endif
+}
+
+void NCpu::detect() {
+#ifdef NCPU_X86_64
+    ui_t eax, ebx, ecx, edx;
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) == 0) {
+        return;
+    }
+
+    const bool sse2 = (edx & bit_SSE2) != 0, fma = (ecx & bit_FMA) != 0;
+    const bool avx = (ecx & bit_AVX) != 0 && (ecx & bit_OSXSAVE) != 0;
+
+    // Registers enabled by the operating system
+    ui_t xcr0 = 0, xcr0_high = 0;
+    if (avx) {
+        __asm__ ("xgetbv" : "=a" (xcr0), "=d" (xcr0_high) : "c" (0));
+    }
+    const bool ymm = avx && (xcr0 & 0x06) == 0x06, zmm = ymm && (xcr0 & 0xe0) == 0xe0;
+
+    bool avx2 = false, avx512f = false;
+    if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) != 0) {
+        avx2 = (ebx & bit_AVX2) != 0;
+        avx512f = (ebx & bit_AVX512F) != 0;
+        _avx512bw = zmm && (ebx & bit_AVX512BW) != 0;
+        _gfni = (ecx & bit_GFNI) != 0;
+    }
+
+    if (zmm && avx512f && fma) {
+        _max_level = AVX512;
+    } else if (ymm && avx2 && fma) {
+        _max_level = AVX2;
+    } else if (sse2) {
+        _max_level = SSE2;
+    }
+#endif
+}
+
+// CONVERSION
+
+string NCpu::levelName(Level level) {
+    switch (level) {
+        case SSE2:
+            return "sse2";
+        case AVX2:
+            return "avx2";
+        case AVX512:
+            return "avx512";
+        case Scalar:
+            return "scalar";
+    }
+    return "scalar";
+}
+
+bool NCpu::parseLevel(const string &name, Level &level) {
+    for (Level candidate : {Scalar, SSE2, AVX2, AVX512}) {
+        if (name == levelName(candidate)) {
+            level = candidate;
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,525 @@
+//
+// Created on 17/10/2026.
+//
+
+#include <NEigen.h>
+#include <NBlas.h>
+#include <NArena.h>
+#include <NThreadPool.h>
+
+using namespace std;
+
+// CONSTRUCTION
+
+template<typename T, typename A>
+NEigen<T, A>::NEigen(const NPMatrix<T, A> &m, bool vectors) {
+    const size_t n = m._i2 - m._i1 + 1;
+    compute(NMatrixView<const T>(m.data() + m.vectorIndex(m._i1, m._j1), n, m._j2 - m._j1 + 1, m._p), 0, n,
+            vectors);
+    m.setDefaultBrowseIndices();
+}
+
+template<typename T, typename A>
+NEigen<T, A>::NEigen(const NPMatrix<T, A> &m, size_t k, Selection selection, bool vectors) {
+    const size_t n = m._i2 - m._i1 + 1;
+    assert(k > 0 && k <= n);
+
+    size_t il = (selection == Smallest) ? 0 : n - k;
+    compute(NMatrixView<const T>(m.data() + m.vectorIndex(m._i1, m._j1), n, m._j2 - m._j1 + 1, m._p), il, il + k,
+            vectors);
+    m.setDefaultBrowseIndices();
+}
+
+// PROTECTED METHODS
+
+template<typename T, typename A>
+void NEigen<T, A>::compute(const NMatrixView<const T> &m, size_t il, size_t iu, bool vectors) {
+    assert(m.n() == m.p() && m.n() > 0);
+
+    const size_t n = m.n(), ldt = max(n - 1, (size_t) 1);
+    NPMatrix<T, A> a(m);
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = i + 1; j < n; ++j) {
+            a(i, j) = a(j, i);
+        }
+    }
+
+    NArenaScope scope;
+    vector<T, NArenaAllocator<T>> d(n), e(n), t(ldt * min((size_t) NBLAS_NB, ldt));
+    NBlas<T>::sytrd(n, a.data(), n, d.data(), e.data(), t.data(), ldt);
+
+    _n = n;
+    _k = iu - il;
+    _values = NVector<T, A>(_k);
+    _vectors = vectors ? NPMatrix<T, A>(n, _k) : NPMatrix<T, A>();
+    _converged = true;
+
+    if (_k == n) {
+        _converged = vectors ? stedc(n, d.data(), e.data(), _vectors.data(), n) :
+                     steqr(n, d.data(), e.data(), nullptr, 0);
+
+        vector<size_t> order(n);
+        for (size_t i = 0; i < n; ++i) {
+            order[i] = i;
+        }
+        std::sort(order.begin(), order.end(), [&](size_t i, size_t j) { return d[i] < d[j]; });
+        for (size_t i = 0; i < n; ++i) {
+            _values(i) = d[order[i]];
+        }
+        if (vectors) {
+            NPMatrix<T, A> z(_vectors);
+            for (size_t r = 0; r < n; ++r) {
+                for (size_t c = 0; c < n; ++c) {
+                    _vectors(r, c) = z(r, order[c]);
+                }
+            }
+        }
+    } else {
+        stebz(n, d.data(), e.data(), il, iu, _values.data());
+        if (vectors) {
+            _converged = stein(n, d.data(), e.data(), _k, _values.data(), _vectors.data(), _k);
+        }
+    }
+
+    if (vectors && n > 1) {
+        NBlas<T>::gemqrt(n - 1, n - 1, _k, a.data() + n, n, t.data(), ldt, _vectors.data() + _k, _k, false);
+    }
+}
+
+template<typename T, typename A>
+bool NEigen<T, A>::steqr(size_t n, T *d, T *e, T *z, size_t ldz) {
+    const T eps = numeric_limits<T>::epsilon();
+
+    NArenaScope scope;
+    vector<T, NArenaAllocator<T>> f(n, T(0));
+    std::copy(e, e + n - 1, f.begin());
+    if (z != nullptr) {
+        for (size_t i = 0; i < n; ++i) {
+            std::fill(z + i * ldz, z + i * ldz + n, T(0));
+            z[i * ldz + i] = T(1);
+        }
+    }
+
+    for (size_t l = 0; l < n; ++l) {
+        for (size_t iter = 0;; ++iter) {
+            size_t m = l;
+            while (m + 1 < n && abs(f[m]) > eps * (abs(d[m]) + abs(d[m + 1]))) {
+                ++m;
+            }
+            if (m == l) {
+                break;
+            }
+            if (iter == NEIGEN_MAX_ITERATIONS) {
+                return false;
+            }
+
+            // Implicit QL step with Wilkinson shift, chasing the bulge from m to l
+            T g = (d[l + 1] - d[l]) / (2 * f[l]), r = hypot(g, T(1));
+            g = d[m] - d[l] + f[l] / (g + ((g >= 0) ? r : -r));
+            T s = 1, c = 1, p = 0;
+            bool underflow = false;
+
+            for (size_t i = m; i-- > l;) {
+                T h = s * f[i], b = c * f[i];
+                r = hypot(h, g);
+                f[i + 1] = r;
+                if (r == 0) {
+                    d[i + 1] -= p;
+                    f[m] = 0;
+                    underflow = true;
+                    break;
+                }
+                s = h / r;
+                c = g / r;
+                g = d[i + 1] - p;
+                r = (d[i] - g) * s + 2 * c * b;
+                p = s * r;
+                d[i + 1] = g + p;
+                g = c * r - b;
+
+                for (size_t k = 0; z != nullptr && k < n; ++k) {
+                    T *z_k = z + k * ldz, x = z_k[i + 1];
+                    z_k[i + 1] = s * z_k[i] + c * x;
+                    z_k[i] = c * z_k[i] - s * x;
+                }
+            }
+            if (!underflow) {
+                d[l] -= p;
+                f[l] = g;
+                f[m] = 0;
+            }
+        }
+    }
+    return true;
+}
+
+template<typename T, typename A>
+bool NEigen<T, A>::stedc(size_t n, T *d, T *e, T *z, size_t ldz) {
+    if (n <= NEIGEN_DC_MIN_ORDER) {
+        return steqr(n, d, e, z, ldz);
+    }
+
+    // T = diag(T1, T2) + |beta| w w^T where w = e_(m - 1) + sign(beta) e_m
+    const size_t m = n / 2;
+    const T beta = e[m - 1];
+    d[m - 1] -= abs(beta);
+    d[m] -= abs(beta);
+
+    for (size_t i = 0; i < n; ++i) {
+        T *z_i = z + i * ldz;
+        if (i < m) {
+            std::fill(z_i + m, z_i + n, T(0));
+        } else {
+            std::fill(z_i, z_i + m, T(0));
+        }
+    }
+
+    bool converged[2];
+    NThreadPool::instance().parallelFor(0, 2, 1, [&](size_t h1, size_t h2) {
+        for (size_t h = h1; h < h2; ++h) {
+            converged[h] = (h == 0) ? stedc(m, d, e, z, ldz) : stedc(n - m, d + m, e + m, z + m * ldz + m, ldz);
+        }
+    });
+    return merge(n, m, beta, d, z, ldz) && converged[0] && converged[1];
+}
+
+template<typename T, typename A>
+bool NEigen<T, A>::merge(size_t n, size_t m, T beta, T *d, T *z, size_t ldz) {
+    if (beta == T(0)) {
+        return true;
+    }
+
+    const T eps = numeric_limits<T>::epsilon(), rho = 2 * abs(beta), sign = (beta > 0) ? T(1) : T(-1);
+    NArenaScope scope;
+    vector<T, NArenaAllocator<T>> w(n);
+    vector<size_t, NArenaAllocator<size_t>> order(n), kept;
+    vector<unsigned char, NArenaAllocator<unsigned char>> half(n);
+    kept.reserve(n);
+
+    // w has a norm of sqrt(2) as made of rows of orthogonal matrices, it is normalized into rho
+    T d_max = 0;
+    for (size_t i = 0; i < n; ++i) {
+        w[i] = ((i < m) ? z[(m - 1) * ldz + i] : sign * z[m * ldz + i]) / sqrt(T(2));
+        half[i] = (i < m) ? 1 : 2;
+        order[i] = i;
+        d_max = max(d_max, abs(d[i]));
+    }
+    std::sort(order.begin(), order.end(), [&](size_t i, size_t j) { return d[i] < d[j]; });
+
+    // Deflation of the negligible components of w and of the close eigenvalues
+    const T tol = 8 * eps * max(d_max, rho);
+    size_t prev = n;
+    for (size_t i : order) {
+        if (rho * abs(w[i]) <= tol) {
+            continue;
+        }
+        if (prev < n) {
+            T r = hypot(w[prev], w[i]), c = w[i] / r, s = w[prev] / r;
+            if (abs(c * s * (d[i] - d[prev])) <= tol) {
+                for (size_t row = 0; row < n; ++row) {
+                    T *z_r = z + row * ldz, zp = z_r[prev], zi = z_r[i];
+                    z_r[prev] = c * zp - s * zi;
+                    z_r[i] = s * zp + c * zi;
+                }
+                T dp = c * c * d[prev] + s * s * d[i];
+                d[i] = s * s * d[prev] + c * c * d[i];
+                d[prev] = dp;
+                w[prev] = 0;
+                w[i] = r;
+                half[prev] = half[i] = (unsigned char) (half[prev] | half[i]);
+                prev = i;
+                continue;
+            }
+            kept.push_back(prev);
+        }
+        prev = i;
+    }
+    if (prev < n) {
+        kept.push_back(prev);
+    }
+
+    const size_t k = kept.size();
+    if (k == 0) {
+        return true;
+    }
+
+    vector<T, NArenaAllocator<T>> dk(k), wk(k), tau(k), u(k * k), norms(k, T(0));
+    vector<size_t, NArenaAllocator<size_t>> origin(k);
+    bool converged = true;
+    for (size_t j = 0; j < k; ++j) {
+        dk[j] = d[kept[j]];
+        wk[j] = w[kept[j]];
+    }
+    for (size_t i = 0; i < k; ++i) {
+        converged = secular(k, dk.data(), wk.data(), rho, i, origin[i], tau[i]) && converged;
+    }
+
+    // Recompute w from the computed eigenvalues (Lowner theorem) so that the eigenvectors are orthogonal
+    auto delta = [&](size_t j, size_t i) { return (dk[j] - dk[origin[i]]) - tau[i]; };
+    for (size_t j = 0; j < k; ++j) {
+        T x = -delta(j, j) / rho;
+        for (size_t i = 0; i < k; ++i) {
+            x *= (i == j) ? T(1) : -delta(j, i) / (dk[i] - dk[j]);
+        }
+        T zj = sqrt(abs(x));
+        T *u_j = u.data() + j * k;
+        for (size_t i = 0; i < k; ++i) {
+            u_j[i] = ((wk[j] < 0) ? -zj : zj) / delta(j, i);
+            norms[i] += u_j[i] * u_j[i];
+        }
+    }
+    for (size_t i = 0; i < k; ++i) {
+        norms[i] = T(1) / sqrt(norms[i]);
+    }
+    for (size_t j = 0; j < k; ++j) {
+        for (size_t i = 0; i < k; ++i) {
+            u[j * k + i] *= norms[i];
+        }
+    }
+
+    // Z = Z U restricted to the columns not deflated, the rows of each half only involve its own columns
+    vector<T, NArenaAllocator<T>> q(n * k, T(0));
+    for (unsigned char h = 1; h <= 2; ++h) {
+        const size_t r1 = (h == 1) ? 0 : m, r2 = (h == 1) ? m : n;
+        vector<size_t, NArenaAllocator<size_t>> cols;
+        for (size_t j = 0; j < k; ++j) {
+            if (half[kept[j]] & h) {
+                cols.push_back(j);
+            }
+        }
+
+        const size_t kh = cols.size();
+        vector<T, NArenaAllocator<T>> zh((r2 - r1) * kh), uh(kh * k);
+        for (size_t r = r1; r < r2; ++r) {
+            for (size_t c = 0; c < kh; ++c) {
+                zh[(r - r1) * kh + c] = z[r * ldz + kept[cols[c]]];
+            }
+        }
+        for (size_t c = 0; c < kh; ++c) {
+            std::copy(u.begin() + cols[c] * k, u.begin() + (cols[c] + 1) * k, uh.begin() + c * k);
+        }
+        NBlas<T>::gemm(r2 - r1, k, kh, T(1), zh.data(), kh, uh.data(), k, q.data() + r1 * k, k);
+    }
+
+    for (size_t r = 0; r < n; ++r) {
+        for (size_t i = 0; i < k; ++i) {
+            z[r * ldz + kept[i]] = q[r * k + i];
+        }
+    }
+    for (size_t i = 0; i < k; ++i) {
+        d[kept[i]] = dk[origin[i]] + tau[i];
+    }
+    return converged;
+}
+
+template<typename T, typename A>
+bool NEigen<T, A>::secular(size_t k, const T *d, const T *z, T rho, size_t i, size_t &origin, T &tau) {
+    const T eps = numeric_limits<T>::epsilon();
+    if (k == 1) {
+        origin = 0;
+        tau = rho * z[0] * z[0];
+        return true;
+    }
+
+    // Bracket of the root relative to the closest pole, and poles of the rational model
+    T lo, hi;
+    size_t a;
+    if (i + 1 < k) {
+        const T mid = (d[i + 1] - d[i]) / 2;
+        T f = 1;
+        for (size_t j = 0; j < k; ++j) {
+            f += rho * z[j] * z[j] / ((d[j] - d[i]) - mid);
+        }
+        origin = (f >= 0) ? i : i + 1;
+        lo = (f >= 0) ? T(0) : -mid;
+        hi = (f >= 0) ? mid : T(0);
+        a = i;
+    } else {
+        origin = i;
+        lo = 0;
+        hi = rho * NBlas<T>::norm2(k, z);
+        a = i - 1;
+    }
+    tau = (lo + hi) / 2;
+
+    for (size_t iter = 0; iter < NEIGEN_MAX_ITERATIONS; ++iter) {
+        T f = 1, df_a = 0, df_b = 0, err = 0;
+        for (size_t j = 0; j < k; ++j) {
+            const T delta = (d[j] - d[origin]) - tau, x = rho * z[j] * z[j] / delta;
+            f += x;
+            err += abs(x);
+            (j <= a ? df_a : df_b) += x / delta;
+        }
+        if (abs(f) <= eps * (8 * (1 + err) + abs(tau) * (df_a + df_b))) {
+            return true;
+        }
+        (f < 0 ? lo : hi) = tau;
+
+        // Root of c + s / (delta_a - eta) + S / (delta_b - eta) matching f and its derivative on both sides
+        const T delta_a = (d[a] - d[origin]) - tau, delta_b = (d[a + 1] - d[origin]) - tau;
+        const T s = delta_a * delta_a * df_a, big_s = delta_b * delta_b * df_b;
+        const T c = f - delta_a * df_a - delta_b * df_b;
+        const T qb = -(c * (delta_a + delta_b) + s + big_s), qc = c * delta_a * delta_b + s * delta_b + big_s * delta_a;
+        const T root = sqrt(max(qb * qb - 4 * c * qc, T(0))), q = -(qb + ((qb >= 0) ? root : -root)) / 2;
+
+        T next = (lo + hi) / 2;
+        if (q != 0) {
+            const T eta1 = (c != 0) ? q / c : qc / q, eta2 = qc / q;
+            if (tau + eta1 > lo && tau + eta1 < hi) {
+                next = tau + eta1;
+            } else if (tau + eta2 > lo && tau + eta2 < hi) {
+                next = tau + eta2;
+            }
+        }
+        if (next == tau || hi - lo <= 2 * eps * max(abs(lo), abs(hi))) {
+            return true;
+        }
+        tau = next;
+    }
+    return false;
+}
+
+template<typename T, typename A>
+void NEigen<T, A>::stebz(size_t n, const T *d, const T *e, size_t il, size_t iu, T *w) {
+    const T eps = numeric_limits<T>::epsilon();
+
+    // Gershgorin interval containing the spectrum
+    T lower = d[0], upper = d[0], e_max = 0;
+    for (size_t i = 0; i < n; ++i) {
+        T r = ((i > 0) ? abs(e[i - 1]) : T(0)) + ((i + 1 < n) ? abs(e[i]) : T(0));
+        lower = min(lower, d[i] - r);
+        upper = max(upper, d[i] + r);
+        e_max = max(e_max, (i + 1 < n) ? abs(e[i]) : T(0));
+    }
+    const T norm = max(abs(lower), abs(upper)), pivmin = numeric_limits<T>::min() * max(T(1), e_max * e_max);
+    lower -= 2 * eps * norm * T(n);
+    upper += 2 * eps * norm * T(n);
+
+    // Number of eigenvalues lower than x given by the Sturm sequence of the LDL^T factorization of T - xI
+    auto count = [&](T x) {
+        size_t negative = 0;
+        T q = 0;
+        for (size_t i = 0; i < n; ++i) {
+            q = d[i] - x - ((i > 0) ? e[i - 1] * e[i - 1] / q : T(0));
+            q = (abs(q) <= pivmin) ? -pivmin : q;
+            negative += (q < 0) ? 1 : 0;
+        }
+        return negative;
+    };
+
+    for (size_t j = il; j < iu; ++j) {
+        T lo = (j > il) ? w[j - il - 1] : lower, hi = upper;
+        while (hi - lo > 2 * eps * max(abs(lo), abs(hi)) + eps * norm) {
+            T mid = (lo + hi) / 2;
+            (count(mid) > j ? hi : lo) = mid;
+        }
+        w[j - il] = (lo + hi) / 2;
+    }
+}
+
+template<typename T, typename A>
+bool NEigen<T, A>::stein(size_t n, const T *d, const T *e, size_t k, const T *w, T *z, size_t ldz) {
+    const T eps = numeric_limits<T>::epsilon();
+    T norm = 0;
+    for (size_t i = 0; i < n; ++i) {
+        norm = max(norm, abs(d[i]) + ((i > 0) ? abs(e[i - 1]) : T(0)) + ((i + 1 < n) ? abs(e[i]) : T(0)));
+    }
+    const T separation = T(NEIGEN_STEIN_SEPARATION) * norm, pivmin = max(eps * norm, numeric_limits<T>::min());
+    const T criterion = sqrt(T(0.1) / T(n));
+    bool converged = true;
+
+    NArenaScope scope;
+    vector<T, NArenaAllocator<T>> u0(n), u1(n), u2(n), l(n), vectors(k * n);
+    vector<unsigned char, NArenaAllocator<unsigned char>> swapped(n);
+    size_t cluster = 0;
+    T shift = 0;
+
+    for (size_t i = 0; i < k; ++i) {
+        T *x = vectors.data() + i * n;
+
+        // Eigenvalues of a cluster are orthogonalized together, equal ones being slightly separated
+        if (i > 0 && w[i] - w[i - 1] > separation) {
+            cluster = i;
+        }
+        shift = (i > 0 && w[i] - shift < 10 * eps * norm) ? shift + 10 * eps * norm : w[i];
+
+        // LU factorization of T - shift I with partial pivoting, U having two super-diagonals
+        for (size_t r = 0; r < n; ++r) {
+            u0[r] = d[r] - shift;
+            u1[r] = (r + 1 < n) ? e[r] : T(0);
+            u2[r] = 0;
+        }
+        for (size_t r = 0; r + 1 < n; ++r) {
+            swapped[r] = abs(e[r]) > abs(u0[r]);
+            if (swapped[r]) {
+                l[r] = u0[r] / e[r];
+                T u1_r = u1[r];
+                u0[r] = e[r];
+                u1[r] = u0[r + 1];
+                u2[r] = u1[r + 1];
+                u0[r + 1] = u1_r - l[r] * u1[r];
+                u1[r + 1] = -l[r] * u2[r];
+            } else {
+                u0[r] = (abs(u0[r]) <= pivmin) ? pivmin : u0[r];
+                l[r] = e[r] / u0[r];
+                u0[r + 1] -= l[r] * u1[r];
+            }
+        }
+        u0[n - 1] = (abs(u0[n - 1]) <= pivmin) ? pivmin : u0[n - 1];
+
+        // The right hand side is scaled so that the solution reaches sqrt(0.1 / n) once x is an accurate eigenvector,
+        // the iteration stops after NEIGEN_STEIN_EXTRA_ITERATIONS more steps
+        for (size_t r = 0; r < n; ++r) {
+            x[r] = T(1) + T(((r + 1) * 7919 + i * 104729) % 1031) / T(1031);
+        }
+        size_t checks = 0;
+        for (size_t iter = 0; iter < NEIGEN_STEIN_MAX_ITERATIONS && checks <= NEIGEN_STEIN_EXTRA_ITERATIONS; ++iter) {
+            T sum = 0;
+            for (size_t r = 0; r < n; ++r) {
+                sum += abs(x[r]);
+            }
+            T scale = T(n) * norm * max(eps, abs(u0[n - 1])) / sum;
+            for (size_t r = 0; r < n; ++r) {
+                x[r] *= scale;
+            }
+
+            for (size_t r = 0; r + 1 < n; ++r) {
+                if (swapped[r]) {
+                    std::swap(x[r], x[r + 1]);
+                }
+                x[r + 1] -= l[r] * x[r];
+            }
+            for (size_t r = n; r-- > 0;) {
+                T y = x[r] - ((r + 1 < n) ? u1[r] * x[r + 1] : T(0)) - ((r + 2 < n) ? u2[r] * x[r + 2] : T(0));
+                x[r] = y / u0[r];
+            }
+
+            for (size_t j = cluster; j < i; ++j) {
+                const T *v = vectors.data() + j * n;
+                NBlas<T>::axpy(n, -NBlas<T>::dot(n, v, x), v, x);
+            }
+            T growth = 0;
+            for (size_t r = 0; r < n; ++r) {
+                growth = max(growth, abs(x[r]));
+            }
+            checks += (growth >= criterion) ? 1 : 0;
+        }
+        converged = converged && checks > 0;
+
+        T scale = T(1) / sqrt(NBlas<T>::norm2(n, x));
+        for (size_t r = 0; r < n; ++r) {
+            x[r] *= scale;
+        }
+
+        for (size_t r = 0; r < n; ++r) {
+            z[r * ldz + i] = x[r];
+        }
+    }
+    return converged;
+}
+
+template
+class NEigen<double_t>;
+
+template
+class NEigen<double_t, std::allocator<double_t>>;
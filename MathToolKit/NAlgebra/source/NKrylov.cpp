@@ -0,0 +1,249 @@
+//
+// Created on 17/10/2026.
+//
+
+#include <NKrylov.h>
+#include <NBlas.h>
+
+using namespace std;
+
+// CONSTRUCTION
+
+template<typename T, typename A>
+NKrylov<T, A>::NKrylov(T tol, size_t max_iter, size_t restart) :
+        _tol(tol), _max_iter(max_iter), _restart(restart) {
+    assert(restart > 0);
+}
+
+// SOLVERS
+
+template<typename T, typename A>
+bool NKrylov<T, A>::cg(const NLinearOperator<T, A> &a, const NVector<T, A> &b, NVector<T, A> &x,
+                       const NPreconditioner<T, A> *m) {
+    const size_t n = a.n(), max_iter = prepare(b, 4);
+    NVector<T, A> &r = _work[0], &p = _work[2], &q = _work[3];
+    // Without preconditioner z = r, which avoids a copy per iteration
+    NVector<T, A> &z = (m != nullptr) ? _work[1] : _work[0];
+    assert(b.dim() == n && x.dim() == n);
+
+    if (record(residual(a, b, x, r, q))) {
+        return true;
+    }
+
+    if (m != nullptr) {
+        m->apply(r, z);
+    }
+    std::copy(z.begin(), z.end(), p.begin());
+    T rz = NBlas<T>::dot(n, r.data(), z.data());
+
+    while (_iterations < max_iter) {
+        a(p, q);
+        T pq = NBlas<T>::dot(n, p.data(), q.data());
+        if (pq == T(0)) {
+            break;
+        }
+
+        T alpha = rz / pq;
+        NBlas<T>::axpy(n, alpha, p.data(), x.data());
+        NBlas<T>::axpy(n, -alpha, q.data(), r.data());
+        ++_iterations;
+        if (record(sqrt(NBlas<T>::dot(n, r.data(), r.data())))) {
+            return true;
+        }
+
+        if (m != nullptr) {
+            m->apply(r, z);
+        }
+        T rz_next = NBlas<T>::dot(n, r.data(), z.data()), beta = rz_next / rz;
+        T *p_data = p.data();
+        const T *z_data = z.data();
+        for (size_t k = 0; k < n; ++k) {
+            p_data[k] = z_data[k] + beta * p_data[k];
+        }
+        rz = rz_next;
+    }
+    return false;
+}
+
+template<typename T, typename A>
+bool NKrylov<T, A>::bicgstab(const NLinearOperator<T, A> &a, const NVector<T, A> &b, NVector<T, A> &x,
+                             const NPreconditioner<T, A> *m) {
+    const size_t n = a.n(), max_iter = prepare(b, 8);
+    NVector<T, A> &r = _work[0], &r0 = _work[1], &p = _work[2], &v = _work[3];
+    NVector<T, A> &p_hat = _work[4], &s = _work[5], &s_hat = _work[6], &t = _work[7];
+    assert(b.dim() == n && x.dim() == n);
+
+    if (record(residual(a, b, x, r, v))) {
+        return true;
+    }
+
+    std::copy(r.begin(), r.end(), r0.begin());
+    std::fill(p.begin(), p.end(), T(0));
+    std::fill(v.begin(), v.end(), T(0));
+    T rho = T(1), alpha = T(1), omega = T(1);
+
+    while (_iterations < max_iter) {
+        T rho_next = NBlas<T>::dot(n, r0.data(), r.data());
+        if (rho_next == T(0) || omega == T(0)) {
+            break;
+        }
+
+        T beta = (rho_next / rho) * (alpha / omega);
+        for (size_t k = 0; k < n; ++k) {
+            p(k) = r(k) + beta * (p(k) - omega * v(k));
+        }
+        precondition(m, p, p_hat);
+        a(p_hat, v);
+        alpha = rho_next / NBlas<T>::dot(n, r0.data(), v.data());
+
+        for (size_t k = 0; k < n; ++k) {
+            s(k) = r(k) - alpha * v(k);
+        }
+        precondition(m, s, s_hat);
+        a(s_hat, t);
+        T tt = NBlas<T>::dot(n, t.data(), t.data());
+        omega = (tt == T(0)) ? T(0) : NBlas<T>::dot(n, t.data(), s.data()) / tt;
+
+        NBlas<T>::axpy(n, alpha, p_hat.data(), x.data());
+        NBlas<T>::axpy(n, omega, s_hat.data(), x.data());
+        for (size_t k = 0; k < n; ++k) {
+            r(k) = s(k) - omega * t(k);
+        }
+        rho = rho_next;
+        ++_iterations;
+        if (record(sqrt(NBlas<T>::dot(n, r.data(), r.data())))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+template<typename T, typename A>
+bool NKrylov<T, A>::gmres(const NLinearOperator<T, A> &a, const NVector<T, A> &b, NVector<T, A> &x,
+                          const NPreconditioner<T, A> *m) {
+    const size_t n = a.n(), restart = _restart, ldh = _restart + 1, max_iter = prepare(b, _restart + 3);
+    NVector<T, A> &w = _work[restart + 1], &z = _work[restart + 2];
+    assert(b.dim() == n && x.dim() == n);
+
+    _h.assign(ldh * restart, T(0));
+    _cs.assign(restart, T(0));
+    _sn.assign(restart, T(0));
+    _g.assign(ldh, T(0));
+
+    T beta = residual(a, b, x, _work[0], w);
+    if (record(beta)) {
+        return true;
+    }
+
+    while (_iterations < max_iter) {
+        _work[0] /= beta;
+        std::fill(_g.begin(), _g.end(), T(0));
+        _g[0] = beta;
+
+        size_t k = 0;
+        while (k < restart && _iterations < max_iter) {
+            T *h = _h.data() + k * ldh;
+            precondition(m, _work[k], z);
+            a(z, w);
+
+            for (size_t i = 0; i <= k; ++i) {
+                h[i] = NBlas<T>::dot(n, w.data(), _work[i].data());
+                NBlas<T>::axpy(n, -h[i], _work[i].data(), w.data());
+            }
+            h[k + 1] = sqrt(NBlas<T>::dot(n, w.data(), w.data()));
+            if (h[k + 1] != T(0)) {
+                std::copy(w.begin(), w.end(), _work[k + 1].begin());
+                _work[k + 1] /= h[k + 1];
+            }
+
+            for (size_t i = 0; i < k; ++i) {
+                T h_i = _cs[i] * h[i] + _sn[i] * h[i + 1];
+                h[i + 1] = -_sn[i] * h[i] + _cs[i] * h[i + 1];
+                h[i] = h_i;
+            }
+            T norm = sqrt(h[k] * h[k] + h[k + 1] * h[k + 1]);
+            _cs[k] = (norm == T(0)) ? T(1) : h[k] / norm;
+            _sn[k] = (norm == T(0)) ? T(0) : h[k + 1] / norm;
+            h[k] = norm;
+            h[k + 1] = T(0);
+            _g[k + 1] = -_sn[k] * _g[k];
+            _g[k] *= _cs[k];
+
+            ++k;
+            ++_iterations;
+            if (record(abs(_g[k])) || norm == T(0)) {
+                break;
+            }
+        }
+
+        for (size_t i = k; i-- > 0;) {
+            for (size_t j = i + 1; j < k; ++j) {
+                _g[i] -= _h[j * ldh + i] * _g[j];
+            }
+            _g[i] = (_h[i * ldh + i] == T(0)) ? T(0) : _g[i] / _h[i * ldh + i];
+        }
+        std::fill(w.begin(), w.end(), T(0));
+        for (size_t i = 0; i < k; ++i) {
+            NBlas<T>::axpy(n, _g[i], _work[i].data(), w.data());
+        }
+        precondition(m, w, z);
+        NBlas<T>::axpy(n, T(1), z.data(), x.data());
+
+        beta = residual(a, b, x, _work[0], w);
+        _converged = beta <= _tol * _b_norm;
+        if (_converged || beta == T(0)) {
+            return _converged;
+        }
+    }
+    return false;
+}
+
+// PROTECTED METHODS
+
+template<typename T, typename A>
+size_t NKrylov<T, A>::prepare(const NVector<T, A> &b, size_t count) {
+    const size_t n = b.dim();
+
+    if (_work.size() < count || (!_work.empty() && _work[0].dim() != n)) {
+        _work.assign(max(count, _work.size()), NVector<T, A>(n));
+    }
+    _iterations = 0;
+    _converged = false;
+    _b_norm = sqrt(NBlas<T>::dot(n, b.data(), b.data()));
+    _residuals.clear();
+    return (_max_iter == 0) ? n : _max_iter;
+}
+
+template<typename T, typename A>
+T NKrylov<T, A>::residual(const NLinearOperator<T, A> &a, const NVector<T, A> &b, const NVector<T, A> &x,
+                          NVector<T, A> &r, NVector<T, A> &ax) const {
+    const size_t n = b.dim();
+
+    a(x, ax);
+    for (size_t k = 0; k < n; ++k) {
+        r(k) = b(k) - ax(k);
+    }
+    return sqrt(NBlas<T>::dot(n, r.data(), r.data()));
+}
+
+template<typename T, typename A>
+bool NKrylov<T, A>::record(T r_norm) {
+    _residuals.push_back((_b_norm == T(0)) ? r_norm : r_norm / _b_norm);
+    _converged = _residuals.back() <= _tol;
+    return _converged;
+}
+
+template<typename T, typename A>
+void NKrylov<T, A>::precondition(const NPreconditioner<T, A> *m, const NVector<T, A> &r, NVector<T, A> &z) {
+    if (m != nullptr) {
+        m->apply(r, z);
+    } else {
+        std::copy(r.begin(), r.end(), z.begin());
+    }
+}
+
+template
+class NKrylov<double_t>;
+
+template
+class NKrylov<double_t, std::allocator<double_t>>;
@@ -0,0 +1,259 @@
+//
+// Created on 17/10/2026.
+//
+
+#include <NLU.h>
+#include <NBlas.h>
+#include <NArena.h>
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wabsolute-value"
+
+using namespace std;
+
+// CONSTRUCTION
+
+template<typename T, typename A>
+NLU<T, A>::NLU(const NPMatrix<T, A> &m) {
+    factorize(NMatrixView<const T>(m.data() + m.vectorIndex(m._i1, m._j1), m._i2 - m._i1 + 1, m._j2 - m._j1 + 1,
+                                   m._p));
+    m.setDefaultBrowseIndices();
+}
+
+template<typename T, typename A>
+NLU<T, A>::NLU(const NMatrixView<const T> &m) {
+    factorize(m);
+}
+
+// GETTERS
+
+template<typename T, typename A>
+NPMatrix<T, A> NLU<T, A>::L() const {
+    assert(!_singular);
+
+    const size_t n = this->n();
+    const T *a = _lu->data();
+    NPMatrix<T, A> l = NPMatrix<T, A>::eye(n);
+    for (size_t i = 1; i < n; ++i) {
+        std::copy(a + i * n, a + i * n + i, l.data() + i * n);
+    }
+    return l;
+}
+
+template<typename T, typename A>
+NPMatrix<T, A> NLU<T, A>::U() const {
+    assert(!_singular);
+
+    const size_t n = this->n();
+    const T *a = _lu->data();
+    NPMatrix<T, A> u = NPMatrix<T, A>::zeros(n);
+    for (size_t i = 0; i < n; ++i) {
+        std::copy(a + i * n + i, a + (i + 1) * n, u.data() + i * n + i);
+    }
+    return u;
+}
+
+// ALGEBRA
+
+template<typename T, typename A>
+T NLU<T, A>::det() const {
+    const size_t n = this->n();
+    const T *a = _lu->data();
+
+    if (_singular || n == 0) {
+        return T(0);
+    }
+
+    T det = a[0];
+    for (size_t i = 1; i < n; ++i) {
+        det *= a[i * n + i];
+    }
+    return (((*_perm)[n] - n) % 2 == 0) ? det : -det;
+}
+
+template<typename T, typename A>
+T NLU<T, A>::rcond() const {
+    const size_t n = this->n();
+
+    if (_singular || n == 0) {
+        return T(0);
+    }
+
+    NArenaScope scope;
+    vector<T, NArenaAllocator<T>> x(n, T(1) / T((int) n)), y(n), z(n);
+    T est = T(0);
+
+    for (size_t iter = 0; iter < NLU_RCOND_MAX_ITER; ++iter) {
+        solve(x.data(), y.data());
+
+        T y_norm = T(0);
+        for (size_t i = 0; i < n; ++i) {
+            y_norm += T(abs(y[i]));
+        }
+        if (iter > 0 && !(y_norm > est)) {
+            break;
+        }
+        est = y_norm;
+
+        for (size_t i = 0; i < n; ++i) {
+            z[i] = (y[i] < T(0)) ? T(-1) : T(1);
+        }
+        transSolve(z.data());
+
+        size_t j_max = 0;
+        for (size_t j = 1; j < n; ++j) {
+            if (abs(z[j]) > abs(z[j_max])) {
+                j_max = j;
+            }
+        }
+        if (iter > 0 && !(abs(z[j_max]) > NBlas<T>::dot(n, z.data(), x.data()))) {
+            break;
+        }
+
+        std::fill(x.begin(), x.end(), T(0));
+        x[j_max] = T(1);
+    }
+    return T(T(1) / (_norm * est));
+}
+
+template<typename T, typename A>
+NPMatrix<T, A> NLU<T, A>::inv() const {
+    assert(!_singular);
+
+    NPMatrix<T, A> res = NPMatrix<T, A>::eye(n());
+    return solve(res);
+}
+
+template<typename T, typename A>
+NVector<T, A> &NLU<T, A>::solve(NVector<T, A> &u) const {
+    const size_t n = this->n();
+    assert(u.dim() == n);
+
+    if (!_singular) {
+        NArenaScope scope;
+        vector<T, NArenaAllocator<T>> x(n);
+
+        solve(u.data(), x.data());
+        std::copy(x.begin(), x.end(), u.begin());
+    }
+    return u;
+}
+
+template<typename T, typename A>
+NPMatrix<T, A> &NLU<T, A>::solve(NPMatrix<T, A> &b) const {
+    const size_t n = b._i2 - b._i1 + 1, m = b._j2 - b._j1 + 1;
+    assert(n == this->n());
+
+    if (!_singular) {
+        NBlas<T>::getrs(n, m, _lu->data(), n, _perm->data(), b.data() + b.vectorIndex(b._i1, b._j1), b._p);
+    }
+    return b.clean();
+}
+
+template<typename T, typename A>
+NVector<T, A> &NLU<T, A>::transSolve(NVector<T, A> &u) const {
+    assert(u.dim() == n());
+
+    if (!_singular) {
+        transSolve(u.data());
+    }
+    return u;
+}
+
+template<typename T, typename A>
+NPMatrix<T, A> &NLU<T, A>::transSolve(NPMatrix<T, A> &b) const {
+    const size_t n = b._i2 - b._i1 + 1, m = b._j2 - b._j1 + 1;
+    assert(n == this->n());
+
+    if (!_singular) {
+        NBlas<T>::getrsT(n, m, _lu->data(), n, _perm->data(), b.data() + b.vectorIndex(b._i1, b._j1), b._p);
+    }
+    return b.clean();
+}
+
+// PROTECTED METHODS
+
+template<typename T, typename A>
+void NLU<T, A>::factorize(const NMatrixView<const T> &m) {
+    assert(m.isSquare());
+
+    const size_t n = m.n();
+    auto lu = make_shared<NPMatrix<T, A>>(m);
+    auto perm = make_shared<vector<size_t>>(n + 1);
+    for (size_t i = 0; i <= n; ++i) {
+        (*perm)[i] = i; //Unit p permutation, p[i] initialized with i
+    }
+
+    NArenaScope scope;
+    vector<T, NArenaAllocator<T>> sums(n, T(0));
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            sums[j] += T(abs(m(i, j)));
+        }
+    }
+    _norm = (n > 0) ? *std::max_element(sums.begin(), sums.end()) : T(0);
+
+    _singular = !NBlas<T>::getrf(n, lu->data(), n, perm->data());
+    _lu = std::move(lu);
+    _perm = std::move(perm);
+    _n = n;
+}
+
+template<typename T, typename A>
+void NLU<T, A>::solve(const T *b, T *x) const {
+    const size_t n = this->n();
+    const T *a = _lu->data();
+    const vector<size_t> &perm = *_perm;
+
+    for (size_t i = 0; i < n; ++i) {
+        x[i] = b[perm[i]] - NBlas<T>::dot(i, a + i * n, x);
+    }
+    for (size_t i = 0; i < n; ++i) {
+        size_t k = n - 1 - i;
+        x[k] = T((x[k] - NBlas<T>::dot(i, a + k * n + k + 1, x + k + 1)) / a[k * n + k]);
+    }
+}
+
+template<typename T, typename A>
+void NLU<T, A>::transSolve(T *x) const {
+    const size_t n = this->n();
+    const T *a = _lu->data();
+
+    for (size_t i = 0; i < n; ++i) {
+        x[i] /= a[i * n + i];
+        NBlas<T>::axpy(n - i - 1, -x[i], a + i * n + i + 1, x + i + 1);
+    }
+    for (size_t i = n; i-- > 0;) {
+        NBlas<T>::axpy(i, -x[i], a + i * n, x);
+    }
+
+    NArenaScope scope;
+    vector<T, NArenaAllocator<T>> z(n);
+    for (size_t i = 0; i < n; ++i) {
+        z[(*_perm)[i]] = x[i];
+    }
+    std::copy(z.begin(), z.end(), x);
+}
+
+template
+class NLU<double_t>;
+
+template
+class NLU<char>;
+
+template
+class NLU<uc_t>;
+
+template
+class NLU<int>;
+
+template
+class NLU<AESByte>;
+
+template
+class NLU<Pixel>;
+
+template
+class NLU<double_t, std::allocator<double_t>>;
+
+#pragma clang diagnostic pop
@@ -3,14 +3,18 @@
 //
 
 #include <NPMatrix.h>
+#include <NLU.h>
+#include <NCholesky.h>
+#include <NBlas.h>
+#include <NArena.h>
 
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wabsolute-value"
 
 using namespace std;
 
-template<typename T>
-string NPMatrix<T>::str() const {
+template<typename T, typename A>
+string NPMatrix<T, A>::str() const {
     stringstream stream;
 
     for (size_t i = _i1; i <= _i2; ++i) {
@@ -22,8 +26,8 @@ string NPMatrix<T>::str() const {
 }
 
 
-template<typename T>
-vector<vector<T>> NPMatrix<T>::array() const {
+template<typename T, typename A>
+vector<vector<T>> NPMatrix<T, A>::array() const {
     vector<vector<T>> array{_i2 - _i1 + 1};
     for (size_t i = _i1; i <= _i2; ++i) {
         array[i] = row(i).array();
@@ -34,8 +38,8 @@ vector<vector<T>> NPMatrix<T>::array() const {
 
 // CHARACTERIZATION
 
-template<typename T>
-bool NPMatrix<T>::isUpper() const {
+template<typename T, typename A>
+bool NPMatrix<T, A>::isUpper() const {
     for (size_t i = _i1; i <= _i2; ++i) {
         for (size_t j = _j1; j <= i; ++j) {
             if (abs((*this)(i, j)) > EPSILON) {
@@ -50,8 +54,8 @@ bool NPMatrix<T>::isUpper() const {
     return true;
 }
 
-template<typename T>
-bool NPMatrix<T>::isLower() const {
+template<typename T, typename A>
+bool NPMatrix<T, A>::isLower() const {
     for (size_t i = _i1; i <= _i2; ++i) {
         for (size_t j = i + 1; j <= _j2; ++j) {
             if (abs((*this)(i, j)) > EPSILON) {
@@ -66,8 +70,16 @@ bool NPMatrix<T>::isLower() const {
     return true;
 }
 
-template<typename T>
-bool NPMatrix<T>::isDiagonal() const {
+template<typename T, typename A>
+bool NPMatrix<T, A>::isSymmetric() const {
+    bool symmetric = NMatrixView<const T>(this->data() + vectorIndex(_i1, _j1), _i2 - _i1 + 1, _j2 - _j1 + 1,
+                                          _p).isSymmetric();
+    setDefaultBrowseIndices();
+    return symmetric;
+}
+
+template<typename T, typename A>
+bool NPMatrix<T, A>::isDiagonal() const {
     for (size_t i = _i1; i <= _i2; i++) {
         for (size_t j = _j1; j <= _j2; j++) {
             if (i != j && abs((*this)(i, j)) > EPSILON) {
@@ -84,56 +96,60 @@ bool NPMatrix<T>::isDiagonal() const {
 
 // GETTERS
 
-template<typename T>
-NVector<T> NPMatrix<T>::row(size_t i) const {
+template<typename T, typename A>
+NVector<T, A> NPMatrix<T, A>::row(size_t i) const {
     assert(isValidRowIndex(i));
-    return vector<T>{this->begin() + _p * i, this->begin() + _p * (i + 1)};
+    NVector<T, A> row(_p);
+    std::copy(this->begin() + _p * i, this->begin() + _p * (i + 1), row.begin());
+    return row;
 }
 
-template<typename T>
-NVector<T> NPMatrix<T>::col(size_t j) const {
+template<typename T, typename A>
+NVector<T, A> NPMatrix<T, A>::col(size_t j) const {
     assert(isValidColIndex(j));
 
-    vector<T> data(_n);
+    NVector<T, A> col(_n);
     for (size_t k = 0; k < _n; ++k) {
-        data[k] = (*this)(k, j);
+        col(k) = (*this)(k, j);
     }
-    return NVector<T>(data);
+    return col;
 }
 
-template<typename T>
-vector<NVector<T> > NPMatrix<T>::rows(size_t i1, size_t i2) const {
+template<typename T, typename A>
+vector<NVector<T, A> > NPMatrix<T, A>::rows(size_t i1, size_t i2) const {
 
     auto end = i2 == MAX_SIZE ? _n - 1 : i2;
 
     assert(end >= i1 && isValidRowIndex(i1) && isValidRowIndex(end));
 
-    vector<NVector<T> > rows(end - i1 + 1);
+    vector<NVector<T, A> > rows;
+    rows.reserve(end - i1 + 1);
     for (auto i = i1; i <= end; ++i) {
-        rows[i - i1] = row(i);
+        rows.emplace_back(rowView(i));
     }
     return rows;
 }
 
-template<typename T>
-vector<NVector<T> > NPMatrix<T>::cols(size_t j1, size_t j2) const {
+template<typename T, typename A>
+vector<NVector<T, A> > NPMatrix<T, A>::cols(size_t j1, size_t j2) const {
 
     auto end = j2 == MAX_SIZE ? _p - 1 : j2;
 
     assert(end >= j1 && isValidColIndex(j1) && isValidColIndex(end));
 
-    vector<NVector<T> > cols(end - j1 + 1);
+    vector<NVector<T, A> > cols;
+    cols.reserve(end - j1 + 1);
     for (auto j = j1; j <= end; ++j) {
-        cols[j - j1] = col(j);
+        cols.emplace_back(colView(j));
     }
     return cols;
 }
 
 
-template<typename T>
-NPMatrix<T> NPMatrix<T>::upper() const {
+template<typename T, typename A>
+NPMatrix<T, A> NPMatrix<T, A>::upper() const {
 
-    NPMatrix<T> upper = NPMatrix<T>::zeros(_i2 - _i1 + 1);
+    NPMatrix<T, A> upper = NPMatrix<T, A>::zeros(_i2 - _i1 + 1);
     for (size_t i = _i1; i <= _i2; ++i) {
         for (size_t j = i; j <= _j2; ++j)
             upper(i, j) = (*this)(i, j);
@@ -143,10 +159,10 @@ NPMatrix<T> NPMatrix<T>::upper() const {
     return upper;
 }
 
-template<typename T>
-NPMatrix<T> NPMatrix<T>::lower() const {
+template<typename T, typename A>
+NPMatrix<T, A> NPMatrix<T, A>::lower() const {
 
-    NPMatrix<T> lower = NPMatrix<T>::zeros(_i2 - _i1 + 1);
+    NPMatrix<T, A> lower = NPMatrix<T, A>::zeros(_i2 - _i1 + 1);
     for (size_t i = _i1; i <= _i2; ++i) {
         for (size_t j = _j1; j <= i; ++j)
             lower(i, j) = (*this)(i, j);
@@ -156,45 +172,66 @@ NPMatrix<T> NPMatrix<T>::lower() const {
     return lower;
 }
 
-template<typename T>
-NPMatrix<T> NPMatrix<T>::lupL() const {
-    if (_a == nullptr) { lupUpdate(); }
+template<typename T, typename A>
+NPMatrix<T, A> NPMatrix<T, A>::lupL() const {
+    if (_lu == nullptr) { lupUpdate(); }
 
-    assert(_a != nullptr);
+    NPMatrix<T, A> l = _lu->L();
 
-    NPMatrix<T> l = _a->lower();
-    for (size_t i = 0; i < _a->_n; ++i) {
-        l(i, i) = 1;
+    if (_lu->n() != _n) {
+        lupClear();
+        setDefaultBrowseIndices();
     }
+    return l;
+}
+
+template<typename T, typename A>
+NPMatrix<T, A> NPMatrix<T, A>::lupU() const {
+    if (_lu == nullptr) { lupUpdate(); }
 
-    if (_a->_n != _n) {
+    NPMatrix<T, A> u = _lu->U();
+
+    if (_lu->n() != _n) {
         lupClear();
         setDefaultBrowseIndices();
     }
-    return l;
+    return u;
 }
 
-template<typename T>
-NPMatrix<T> NPMatrix<T>::lupU() const {
-    if (_a == nullptr) { lupUpdate(); }
+template<typename T, typename A>
+NCholesky<T, A> NPMatrix<T, A>::llt() const {
+    if (_llt != nullptr && hasDefaultBrowseIndices()) {
+        return *_llt;
+    }
+
+    auto llt = make_shared<const NCholesky<T, A>>(
+            NMatrixView<const T>(this->data() + vectorIndex(_i1, _j1), _i2 - _i1 + 1, _j2 - _j1 + 1, _p));
+    setDefaultBrowseIndices();
+    if (llt->isPositiveDefinite() && llt->n() == _n) {
+        _llt = llt;
+    }
+    return *llt;
+}
 
-    assert(_a != nullptr);
+template<typename T, typename A>
+NLU<T, A> NPMatrix<T, A>::lu() const {
+    if (_lu == nullptr) { lupUpdate(); }
 
-    NPMatrix<T> u = _a->upper();
+    NLU<T, A> lu = *_lu;
 
-    if (_a->_n != _n) {
+    if (_lu->n() != _n) {
         lupClear();
         setDefaultBrowseIndices();
     }
-    return u;
+    return lu;
 }
 
 
 // ROWS/COLS/SUB SETTERS
 
 
-template<typename T>
-NPMatrix<T> &NPMatrix<T>::setRow(const NVector<T> &u, size_t i1) {
+template<typename T, typename A>
+NPMatrix<T, A> &NPMatrix<T, A>::setRow(const NVector<T, A> &u, size_t i1) {
     assert(u.dim() <= _p && isValidRowIndex(i1));
 
     std::copy(u.begin(), u.end(), this->begin() + _p * i1);
@@ -202,8 +239,8 @@ NPMatrix<T> &NPMatrix<T>::setRow(const NVector<T> &u, size_t i1) {
     return *this;
 }
 
-template<typename T>
-NPMatrix<T> &NPMatrix<T>::setCol(const NVector<T> &u, size_t j1) {
+template<typename T, typename A>
+NPMatrix<T, A> &NPMatrix<T, A>::setCol(const NVector<T, A> &u, size_t j1) {
     assert(u.dim() <= _n && isValidColIndex(j1));
 
     for (size_t i = 0; i < u.dim(); ++i) {
@@ -213,8 +250,8 @@ NPMatrix<T> &NPMatrix<T>::setCol(const NVector<T> &u, size_t j1) {
     return *this;
 }
 
-template<typename T>
-NPMatrix<T> &NPMatrix<T>::setRows(const vector<NVector<T>> &vectors, size_t i1) {
+template<typename T, typename A>
+NPMatrix<T, A> &NPMatrix<T, A>::setRows(const vector<NVector<T, A>> &vectors, size_t i1) {
     size_t size = (vectors.size() + i1 < _n) ? vectors.size() + i1 : _n;
 
     for (auto i = i1; i < size; ++i) {
@@ -224,8 +261,8 @@ NPMatrix<T> &NPMatrix<T>::setRows(const vector<NVector<T>> &vectors, size_t i1)
     return *this;
 }
 
-template<typename T>
-NPMatrix<T> &NPMatrix<T>::setCols(const vector<NVector<T>> &vectors, size_t j1) {
+template<typename T, typename A>
+NPMatrix<T, A> &NPMatrix<T, A>::setCols(const vector<NVector<T, A>> &vectors, size_t j1) {
     size_t size = (vectors.size() + j1 <= _p) ? vectors.size() + j1 : _p;
 
     for (auto j = j1; j < size; ++j) {
@@ -239,50 +276,20 @@ NPMatrix<T> &NPMatrix<T>::setCols(const vector<NVector<T>> &vectors, size_t j1)
 // MANIPULATORS
 
 // TRANSPOSED
-template<typename T>
-NPMatrix<T> & NPMatrix<T>::trans() {
-    if(_j2 - _j1 == 0 || _i2 - _i1 == 0) {
+template<typename T, typename A>
+NPMatrix<T, A> & NPMatrix<T, A>::trans() {
+    if (hasDefaultBrowseIndices()) {
+        NBlas<T>::transpose(_n, _p, this->data());
         std::swap(_n, _p);
-        setDefaultBrowseIndices();
-        return *this;
-    }
-    size_t n = std::min(_i2, _j2);
-
-    for (auto i = _i1; i <= n; ++i) {
-        for (auto j = i + 1; j <= n; ++j) {
-            swap(i, j, j, i);
-        }
-    }
-
-    assert(hasDefaultBrowseIndices() || (_j2 < _n && _i2 < _p));
-
-    if(_j2 - _j1 > _i2 - _i1) {
-        size_t n = _n;
-        resizeRow(_p);
-        for (auto i = _i1; i <= _j2; ++i) {
-            for (auto j = _i2; j <= _j2; ++j) {
-                swap(i, j, j, i);
-            }
-        }
-        resizeCol(n);
-
-    } else if(_j2 - _j1 < _i2 - _i1) {
-        size_t p = _p;
-        resizeCol(_n);
-        for (auto i = _j2; i <= _i2; ++i) {
-            for (auto j = _j1; j <= _i2; ++j) {
-                swap(i, j, j, i);
-            }
-        }
-        resizeRow(p);
+    } else {
+        assert(_i2 - _i1 == _j2 - _j1);
+        NBlas<T>::transpose(_i2 - _i1 + 1, this->data() + vectorIndex(_i1, _j1), _p);
     }
-
-    setDefaultBrowseIndices();
-    return *this;
+    return clean();
 }
 
-template<typename T>
-T NPMatrix<T>::trace() const {
+template<typename T, typename A>
+T NPMatrix<T, A>::trace() const {
     T trace = 0;
     for (size_t i = _i1; i <= _i2; i++) {
         trace += (*this)(i, i);
@@ -295,9 +302,9 @@ T NPMatrix<T>::trace() const {
 // ALGEBRA
 
 
-template<typename T>
-NPMatrix<T> NPMatrix<T>::shifted(const NPMatrix<T> &m) const {
-    NPMatrix<T> shifted = NPMatrix<T>::zeros(_n, m._p + _n);
+template<typename T, typename A>
+NPMatrix<T, A> NPMatrix<T, A>::shifted(const NPMatrix<T, A> &m) const {
+    NPMatrix<T, A> shifted = NPMatrix<T, A>::zeros(_n, m._p + _n);
     for (size_t i = 0; i < _n; i++) {
         for (size_t j = 0; j < _p; j++) {
             shifted(i, j) = (*this)(i, j);
@@ -310,11 +317,11 @@ NPMatrix<T> NPMatrix<T>::shifted(const NPMatrix<T> &m) const {
     return shifted;
 }
 
-template<typename T>
-NPMatrix<T> &NPMatrix<T>::reduce() {
+template<typename T, typename A>
+NPMatrix<T, A> &NPMatrix<T, A>::reduce() {
     size_t r = 0, k, i, j;
-    NVector<T> spin;
-    for (j = 0; j < floor(_p / 2); ++j) {
+    NVector<T, A> spin;
+    for (j = 0; j < _p / 2; ++j) {
 
         k = maxAbsIndexCol(j, r);
         if (abs((*this)(k, j)) > EPSILON) {
@@ -332,21 +339,14 @@ NPMatrix<T> &NPMatrix<T>::reduce() {
     return clean();
 }
 
-template<typename T>
-T NPMatrix<T>::det() const {
-    T det = 0;
-    if (_a == nullptr) { lupUpdate(); }
+template<typename T, typename A>
+T NPMatrix<T, A>::det() const {
+    if (_lu == nullptr && _llt == nullptr) { lupUpdate(); }
 
-    if (_a != nullptr) {
-        det = (*_a)(0, 0);
-        for (size_t i = 1; i < _a->_n; i++) {
-            det *= (*_a)(i, i);
-        }
-        det = (((*_perm)[_a->_n - 1] - (_a->_n - 1)) % 2 == 0) ? det : -det;
+    T det = (_llt != nullptr) ? _llt->det() : _lu->det();
 
-        if (_a->_n != _n) {
-            lupClear();
-        }
+    if (factorOrder() != _n) {
+        lupClear();
     }
     return det;
 }
@@ -355,8 +355,36 @@ T NPMatrix<T>::det() const {
 
 // BI-DIMENSIONAL ACCESSORS
 
-template<typename T>
-NPMatrix<T> &NPMatrix<T>::operator()(size_t i1, size_t j1, size_t i2, size_t j2) {
+template<typename T, typename A>
+NVector<T, A> &NPMatrix<T, A>::product(const NVector<T, A> &x, NVector<T, A> &y) const {
+    assert(x.browseDim() == _j2 - _j1 + 1 && &x != &y);
+
+    const T *px = x.data() + x._k1;
+    T *py = productOutput(y, _i2 - _i1 + 1);
+    NBlas<T>::gemv(_i2 - _i1 + 1, _j2 - _j1 + 1, this->data() + vectorIndex(_i1, _j1), _p, px, py);
+
+    x.setDefaultBrowseIndices();
+    y.setDefaultBrowseIndices();
+    setDefaultBrowseIndices();
+    return y;
+}
+
+template<typename T, typename A>
+NVector<T, A> &NPMatrix<T, A>::transProduct(const NVector<T, A> &x, NVector<T, A> &y) const {
+    assert(x.browseDim() == _i2 - _i1 + 1 && &x != &y);
+
+    const T *px = x.data() + x._k1;
+    T *py = productOutput(y, _j2 - _j1 + 1);
+    NBlas<T>::gemvT(_i2 - _i1 + 1, _j2 - _j1 + 1, this->data() + vectorIndex(_i1, _j1), _p, px, py);
+
+    x.setDefaultBrowseIndices();
+    y.setDefaultBrowseIndices();
+    setDefaultBrowseIndices();
+    return y;
+}
+
+template<typename T, typename A>
+NPMatrix<T, A> &NPMatrix<T, A>::operator()(size_t i1, size_t j1, size_t i2, size_t j2) {
     assert(isValidIndex(i1, j1) && isValidIndex(i2, j2));
     assert(i2 >= i1 && j2 >= j1);
 
@@ -370,30 +398,30 @@ NPMatrix<T> &NPMatrix<T>::operator()(size_t i1, size_t j1, size_t i2, size_t j2)
 
 // STATIC FUNCTIONS
 
-template<typename T>
-NPMatrix<T> NPMatrix<T>::eye(size_t n) {
-    NPMatrix<T> eye = NPMatrix<T>::zeros(n);
+template<typename T, typename A>
+NPMatrix<T, A> NPMatrix<T, A>::eye(size_t n) {
+    NPMatrix<T, A> eye = NPMatrix<T, A>::zeros(n);
     for (size_t k = 0; k < eye.n(); ++k) {
         eye(k, k) = 1;
     }
     return eye;
 }
 
-template<typename T>
-NPMatrix<T> NPMatrix<T>::diag(const vector<T> &data, size_t n) {
-    NPMatrix<T> diag = NPMatrix<T>::zeros(n);
+template<typename T, typename A>
+NPMatrix<T, A> NPMatrix<T, A>::diag(const vector<T> &data, size_t n) {
+    NPMatrix<T, A> diag = NPMatrix<T, A>::zeros(n);
     for (size_t k = 0; k < n; ++k) {
         diag(k, k) = data[k];
     }
     return diag;
 }
 
-template<typename T>
-NPMatrix<T> NPMatrix<T>::ndiag(const vector<NVector<T>> &data) {
+template<typename T, typename A>
+NPMatrix<T, A> NPMatrix<T, A>::ndiag(const vector<NVector<T, A>> &data) {
     auto n = (long) data.size();
     auto middle = (n - 1) / 2;
     auto dim = data[middle].dim();
-    NPMatrix<T> diag = NPMatrix<T>::zeros(dim);
+    NPMatrix<T, A> diag = NPMatrix<T, A>::zeros(dim);
 
     for (long l = -middle; l <= middle; l++) {
         for (size_t k = 0; k < dim - abs(l); k++) {
@@ -407,54 +435,59 @@ NPMatrix<T> NPMatrix<T>::ndiag(const vector<NVector<T>> &data) {
     return diag;
 }
 
-template<typename T>
-NPMatrix<T> NPMatrix<T>::nscalar(const vector<T> &scalars, size_t n) {
+template<typename T, typename A>
+NPMatrix<T, A> NPMatrix<T, A>::nscalar(const vector<T> &scalars, size_t n) {
     auto scalarSize = (long) scalars.size();
     long minSize = n - scalarSize;
 
-    vector<NVector<T> > diags((size_t) (2 * scalarSize - 1));
+    vector<NVector<T, A> > diags((size_t) (2 * scalarSize - 1));
     size_t size = 1;
-    for (size_t l = 0; l < scalarSize; l++) {
-        diags[l] = NVector<T>::scalar(scalars[l], size + minSize);
+    for (size_t l = 0; l < (size_t) scalarSize; l++) {
+        diags[l] = NVector<T, A>::scalar(scalars[l], size + minSize);
         if (l > 0) {
-            diags[l + scalarSize - 1] = NVector<T>::scalar(scalars[scalarSize - l - 1], n - size + 1);
+            diags[l + scalarSize - 1] = NVector<T, A>::scalar(scalars[scalarSize - l - 1], n - size + 1);
         }
         size++;
     }
-    return NPMatrix<T>::ndiag(diags);
+    return NPMatrix<T, A>::ndiag(diags);
 }
 
 // PROTECTED METHODS
 
 
-template<typename T>
-NPMatrix<T>::NPMatrix(const NVector<T> &u, size_t n, size_t p, size_t i1, size_t j1, size_t i2, size_t j2):
-        NVector<T>(u),
+template<typename T, typename A>
+NPMatrix<T, A>::NPMatrix(const NVector<T, A> &u, size_t n, size_t p, size_t i1, size_t j1, size_t i2, size_t j2):
+        NVector<T, A>(u),
         _n(n), _p(p),
         _i1(i1), _j1(j1), _i2(i2), _j2(j2),
-        _a(nullptr), _perm(nullptr) {
+        _lu(nullptr), _llt(nullptr) {
     setDefaultBrowseIndices();
 }
 
 // MANIPULATORS
 
-template<typename T>
-NPMatrix<T> &NPMatrix<T>::swap(const Parts element, size_t k1, size_t k2) {
-
-    NVector<T> temp = (element == Row) ? NPMatrix<T>::row(k1) : col(k1);
+template<typename T, typename A>
+NPMatrix<T, A> &NPMatrix<T, A>::swap(const Parts element, size_t k1, size_t k2) {
 
-    (element == Row) ? setRow(row(k2), k1) : setCol(col(k2), k1);
-    (element == Row) ? setRow(temp, k2) : setCol(temp, k2);
+    if (element == Row) {
+        assert(isValidRowIndex(k1) && isValidRowIndex(k2));
+        std::swap_ranges(this->data() + _p * k1, this->data() + _p * (k1 + 1), this->data() + _p * k2);
+    } else {
+        assert(isValidColIndex(k1) && isValidColIndex(k2));
+        for (size_t i = 0; i < _n; ++i) {
+            std::swap((*this)(i, k1), (*this)(i, k2));
+        }
+    }
 
     return clean();
 }
 
-template<typename T>
-NPMatrix<T> &NPMatrix<T>::shift(const Parts element, size_t k, const long iterations) {
+template<typename T, typename A>
+NPMatrix<T, A> &NPMatrix<T, A>::shift(const Parts element, size_t k, const long iterations) {
 
     assert(element == Row ? isBetweenI12(k + _i1) : isBetweenJ12(k + _j1));
 
-    NVector<T> vector = (element == Row) ? row(k + _i1) : col(k + _j1);
+    NVector<T, A> vector = (element == Row) ? row(k + _i1) : col(k + _j1);
     (element == Row) ? vector(_j1, _j2).shift(iterations) : vector(_i1, _i2).shift(iterations);
     (element == Row) ? setRow(vector, k + _i1) : setCol(vector, k + _j1);
 
@@ -463,237 +496,461 @@ NPMatrix<T> &NPMatrix<T>::shift(const Parts element, size_t k, const long iterat
 
 // MAX/MIN
 
-template<typename T>
-size_t NPMatrix<T>::maxAbsIndex(const Parts element, size_t k, size_t r) const {
-    NVector<T> elem{(element == Row) ? row(k) : col(k)};
-    NVector<T> vector;
-    vector = elem(r, (element == Row) ? _p - 1 : _n - 1);
-    return r + vector.maxAbsIndex();
+template<typename T, typename A>
+size_t NPMatrix<T, A>::maxAbsIndex(const Parts element, size_t k, size_t r) const {
+    NVectorView<const T> elem = (element == Row) ? rowView(k) : colView(k);
+    size_t min_k = r, max_k = r;
+    for (size_t l = r + 1; l < elem.dim(); ++l) {
+        if (elem(l) < elem(min_k)) { min_k = l; }
+        if (elem(max_k) < elem(l)) { max_k = l; }
+    }
+    return (abs(elem(min_k)) > abs(elem(max_k))) ? min_k : max_k;
 }
 
 // PRIVATE METHODS
 
 // ALGEBRAICAL OPERATIONS
 
-template<typename T>
-NVector<T> &NPMatrix<T>::vectorProduct(NVector<T> &u) const {
+template<typename T, typename A>
+T *NPMatrix<T, A>::productOutput(NVector<T, A> &y, size_t dim) {
+    if (y.hasDefaultBrowseIndices() && y.size() != dim) {
+        y.std::vector<T, A>::resize(dim);
+        y.setDefaultBrowseIndices();
+    }
+    assert(y.browseDim() == dim);
+    return y.data() + y._k1;
+}
 
-    NVector<T> res = NVector<T>::zeros(u.dim());
+template<typename T, typename A>
+NVector<T, A> &NPMatrix<T, A>::vectorProduct(NVector<T, A> &u) const {
 
-    assert(matchSizeForProduct(res));
+    assert(matchSizeForProduct(u));
 
-    for (size_t i = _i1; i <= _i2; ++i) {
-        res(i - _i1) = row(i)(_j1, _j2) | u;
-    }
-    u = res;
+    NArenaScope scope;
+    const vector<T, NArenaAllocator<T>> x(u.begin(), u.end());
+
+    T *y = productOutput(u, _i2 - _i1 + 1);
+    NBlas<T>::gemv(_i2 - _i1 + 1, _j2 - _j1 + 1, this->data() + vectorIndex(_i1, _j1), _p, x.data(), y);
+    u.setDefaultBrowseIndices();
 
     setDefaultBrowseIndices();
     return u;
 }
 
-template<typename T>
-NPMatrix<T> &NPMatrix<T>::matrixProduct(const NPMatrix<T> &m) {
+template<typename T, typename A>
+NPMatrix<T, A> &NPMatrix<T, A>::matrixProduct(const NPMatrix<T, A> &m) {
     assert(matchSizeForProduct(m));
     assert((_j2 - _j1 == _i2 - _i1) || hasDefaultBrowseIndices());
 
-    NPMatrix<T> res = NPMatrix<T>::zeros(_i2 - _i1 + 1, m._j2 - m._j1 + 1);
+    return matrixProduct(m.data() + m.vectorIndex(m._i1, m._j1), m._p, m._j2 - m._j1 + 1);
+}
 
+template<typename T, typename A>
+NPMatrix<T, A> &NPMatrix<T, A>::matrixProduct(const T *b, size_t ldb, size_t p) {
+    NArenaScope scope;
+    size_t n = _i2 - _i1 + 1, q = _j2 - _j1 + 1;
+    vector<T, NArenaAllocator<T>> res(n * p);
 
-    for (size_t i = _i1; i <= _i2; ++i) {
-        for (size_t j = m._j1; j <= m._j2; ++j) {
-            res(i - _i1, j - m._j1) = row(i)(_j1, _j2) | m.col(j)(m._i1, m._i2);
-        }
-    }
+    NBlas<T>::gemm(n, p, q, T(1), this->data() + vectorIndex(_i1, _j1), _p, b, ldb, res.data(), p);
 
-    copy(res);
-    lupClear();
-    return *this;
+    return *this = NMatrixView<const T>(res.data(), n, p, p);
 }
 
+// EXPONENTIATION
+
+/**
+ * Square matrix product \f$ C \leftarrow A B \f$ of matrices of order `n` stored contiguously. `c` must not overlap
+ * `a` or `b`.
+ */
 template<typename T>
-NPMatrix<T> &NPMatrix<T>::pow(long exp) {
-    if (exp > 0) {
-        rPow(exp);
-    } else if (exp < 0) {
-        inv();
-        rPow(-exp);
+static void squareProduct(size_t n, const T *a, const T *b, T *c) {
+    std::fill(c, c + n * n, T(0));
+    NBlas<T>::gemm(n, n, n, T(1), a, n, b, n, c, n);
+}
+
+/**
+ * Numerator \f$ V + U \f$ and denominator \f$ V - U \f$ of the Padé approximant \f$ [m/m] \f$ of \f$ e^A \f$, where `a`
+ * points to \f$ A \f$ followed by six work matrices of order `n` and `m` is either 3, 5, 7, 9 or 13. The powers
+ * \f$ A^2, A^4, ... \f$ are computed once and shared by the odd terms \f$ U \f$ and the even ones \f$ V \f$. Returns a
+ * pointer to the numerator, the denominator is stored in the next matrix.
+ */
+template<typename T>
+static T *pade(size_t n, size_t m, T *a) {
+    static const double_t b3[] = {120., 60., 12., 1.};
+    static const double_t b5[] = {30240., 15120., 3360., 420., 30., 1.};
+    static const double_t b7[] = {17297280., 8648640., 1995840., 277200., 25200., 1512., 56., 1.};
+    static const double_t b9[] = {17643225600., 8821612800., 2075673600., 302702400., 30270240., 2162160., 110880.,
+                                  3960., 90., 1.};
+    static const double_t b13[] = {64764752532480000., 32382376266240000., 7771770303897600., 1187353796428800.,
+                                   129060195264000., 10559470521600., 670442572800., 33522128640., 1323241920.,
+                                   40840800., 960960., 16380., 182., 1.};
+    const double_t *b = (m == 3) ? b3 : (m == 5) ? b5 : (m == 7) ? b7 : (m == 9) ? b9 : b13;
+    const size_t nn = n * n;
+    T *a2 = a + nn, *a4 = a2 + nn, *a6 = a4 + nn, *w = a6 + nn, *u = w + nn, *v = u + nn;
+
+    squareProduct(n, a, a, a2);
+    if (m >= 5) {
+        squareProduct(n, a2, a2, a4);
+    }
+    if (m >= 7) {
+        squareProduct(n, a4, a2, a6);
+    }
+
+    if (m <= 9) {
+        // W = b_1 I + b_3 A^2 + ... and V = b_0 I + b_2 A^2 + ..., A^8 being stored in U until U = A W
+        const T *powers[] = {a2, a4, a6, u};
+        if (m == 9) {
+            squareProduct(n, a6, a2, u);
+        }
+        for (size_t k = 0; k < nn; ++k) {
+            T w_k = T(0), v_k = T(0);
+            for (size_t l = 0; 2 * l + 2 < m; ++l) {
+                w_k += T(b[2 * l + 3]) * powers[l][k];
+                v_k += T(b[2 * l + 2]) * powers[l][k];
+            }
+            w[k] = w_k;
+            v[k] = v_k;
+        }
+        for (size_t i = 0; i < n; ++i) {
+            w[i * n + i] += T(b[1]);
+            v[i * n + i] += T(b[0]);
+        }
+        squareProduct(n, a, w, u);
     } else {
-        *this = NPMatrix<T>::eye(n());
+        // U = A (A^6 (b_13 A^6 + b_11 A^4 + b_9 A^2) + b_7 A^6 + b_5 A^4 + b_3 A^2 + b_1 I)
+        for (size_t k = 0; k < nn; ++k) {
+            w[k] = T(b[13]) * a6[k] + T(b[11]) * a4[k] + T(b[9]) * a2[k];
+        }
+        squareProduct(n, a6, w, u);
+        for (size_t k = 0; k < nn; ++k) {
+            u[k] += T(b[7]) * a6[k] + T(b[5]) * a4[k] + T(b[3]) * a2[k];
+        }
+        for (size_t i = 0; i < n; ++i) {
+            u[i * n + i] += T(b[1]);
+        }
+        squareProduct(n, a, u, w);
+
+        // V = A^6 (b_12 A^6 + b_10 A^4 + b_8 A^2) + b_6 A^6 + b_4 A^4 + b_2 A^2 + b_0 I
+        for (size_t k = 0; k < nn; ++k) {
+            u[k] = T(b[12]) * a6[k] + T(b[10]) * a4[k] + T(b[8]) * a2[k];
+        }
+        squareProduct(n, a6, u, v);
+        for (size_t k = 0; k < nn; ++k) {
+            v[k] += T(b[6]) * a6[k] + T(b[4]) * a4[k] + T(b[2]) * a2[k];
+        }
+        for (size_t i = 0; i < n; ++i) {
+            v[i * n + i] += T(b[0]);
+        }
+        std::swap(u, w);
     }
-    return clean();
+
+    // The powers are no longer needed, V + U and V - U overwrite A^2 and A^4
+    for (size_t k = 0; k < nn; ++k) {
+        a2[k] = v[k] + u[k];
+        a4[k] = v[k] - u[k];
+    }
+    return a2;
 }
 
+/**
+ * Exponential of the matrix \f$ A \f$ of order `n` by scaling and squaring, where `a` points to \f$ A \f$ followed by
+ * six work matrices and `perm` has `n + 1` elements. Returns a pointer to \f$ e^A \f$, stored in the work matrices.
+ */
 template<typename T>
-void NPMatrix<T>::rPow(const long exp) {
-    if (exp > 1) {
-        const NPMatrix<T> this_copy{subMatrix(_i1, _j1, _i2, _j2)};
-        matrixProduct(this_copy);
-        if (exp % 2 == 0) {
-            rPow(exp / 2);
-        } else if (exp % 2 == 1) {
-            rPow((exp - 1) / 2);
-            matrixProduct(this_copy);
+static T *padeExponential(size_t n, T *a, size_t *perm, true_type) {
+    // Largest 1-norm for which the Padé approximant of each degree is accurate to the unit roundoff
+    static const size_t degrees[] = {3, 5, 7, 9, 13};
+    static const double_t theta[] = {1.495585217958292e-2, 2.539398330063230e-1, 9.504178996162932e-1,
+                                     2.097847961257068e0, 5.371920351148152e0};
+
+    const size_t nn = n * n;
+
+    // The norm is NaN or infinite if a coefficient is
+    T norm = T(0);
+    for (size_t j = 0; j < n; ++j) {
+        T sum = T(0);
+        for (size_t i = 0; i < n; ++i) {
+            sum += abs(a[i * n + j]);
+        }
+        norm = (sum > norm || sum != sum) ? sum : norm;
+    }
+    const bool finite = (norm - norm == T(0));
+
+    // e^A = (e^(A / 2^s))^(2^s) with the smallest s bringing the norm below theta_13, a finite norm is lower than 1
+    // once halved max_exponent times
+    const size_t max_squarings = (size_t) std::numeric_limits<T>::max_exponent;
+    size_t d = 0, s = 0;
+    while (d < 4 && norm > T(theta[d])) {
+        ++d;
+    }
+    for (; d == 4 && norm > T(theta[4]) && s < max_squarings; ++s) {
+        norm /= T(2);
+    }
+    if (s > 0) {
+        // 2^-s is applied in two normal factors, 2^-max_exponent alone would be subnormal
+        const T scale1 = T(ldexp(1.0, -(int) (s / 2))), scale2 = T(ldexp(1.0, -(int) (s - s / 2)));
+        for (size_t k = 0; k < nn; ++k) {
+            a[k] *= scale1;
+            a[k] *= scale2;
         }
     }
+
+    // V - U tends to b_0 I as A is scaled down, if it is singular A is halved again
+    T *res, *tmp;
+    for (;; ++s) {
+        res = pade(n, degrees[d], a);
+        tmp = res + nn;
+        for (size_t i = 0; i <= n; ++i) {
+            perm[i] = i;
+        }
+        if (NBlas<T>::getrf(n, tmp, n, perm)) {
+            break;
+        }
+        if (!finite || s >= max_squarings) {
+            std::fill(tmp, tmp + nn, std::numeric_limits<T>::quiet_NaN());
+            return tmp;
+        }
+        for (size_t k = 0; k < nn; ++k) {
+            a[k] /= T(2);
+        }
+    }
+    NBlas<T>::getrs(n, n, tmp, n, perm, res, n);
+
+    for (size_t k = 0; k < s; ++k) {
+        squareProduct(n, res, res, tmp);
+        std::swap(res, tmp);
+    }
+    return res;
 }
 
+
+/**
+ * The Padé approximants are only defined over floating point types, `a` is left unchanged.
+ */
 template<typename T>
-NPMatrix<T> &NPMatrix<T>::inv() {
-    size_t i, j, k, l;
-
-    if (_a == nullptr) { lupUpdate(); }
-
-    if (_a != nullptr) {
-        for (j = 0; j < _a->_n; j++) {
-            for (i = 0; i < _a->_n; i++) {
-                (*this)(i + _i1, j + _j1) = (((*_perm)[i] == j) ? 1 : 0);
-                for (l = 0; l < i; ++l) {
-                    (*this)(i + _i1, j + _j1) -= (*_a)(i, l) * (*this)(l, j);
-                }
-            }
-            for (i = 0; i < _a->_n; i++) {
-                k = _a->_n - 1 - i;
-                for (l = k + 1; l < _a->_n; l++) {
-                    (*this)(k + _i1, j + _j1) -= (*_a)(k, l) * (*this)(l, j);
-                }
-                (*this)(k + _i1, j + _j1) /= (*_a)(k, k);
+static T *padeExponential(size_t, T *a, size_t *, false_type) {
+    return a;
+}
+
+template<typename T, typename A>
+NPMatrix<T, A> &NPMatrix<T, A>::pow(long exp) {
+    assert(_i2 - _i1 == _j2 - _j1);
+
+    if (exp < 0) {
+        const size_t i1 = _i1, j1 = _j1, i2 = _i2, j2 = _j2;
+        inv();
+        (*this)(i1, j1, i2, j2);
+    }
+    binaryPow((unsigned long) ((exp < 0) ? -exp : exp));
+    return clean();
+}
+
+template<typename T, typename A>
+void NPMatrix<T, A>::binaryPow(unsigned long exp) {
+    NArenaScope scope;
+    const size_t n = _i2 - _i1 + 1, nn = n * n;
+    vector<T, NArenaAllocator<T>> work(3 * nn);
+    T *base = work.data(), *res = base + nn, *tmp = res + nn;
+    bool identity = true;
+
+    // res = base^(bits of exp already read), base = A^(2^bits)
+    NMatrixView<T>(base, n, n, n).assign(browseView());
+    for (; exp > 0; exp >>= 1) {
+        if (exp & 1) {
+            if (identity) {
+                std::copy(base, base + nn, res);
+                identity = false;
+            } else {
+                squareProduct(n, res, base, tmp);
+                std::swap(res, tmp);
             }
         }
-        if (_a->_n != _n) {
-            lupClear();
+        if (exp > 1) {
+            squareProduct(n, base, base, tmp);
+            std::swap(base, tmp);
         }
     }
-    return *this;
+
+    if (identity) {
+        std::fill(res, res + nn, T(0));
+        for (size_t i = 0; i < n; ++i) {
+            res[i * n + i] = T(1);
+        }
+    }
+    browseView().assign(NMatrixView<const T>(res, n, n, n));
 }
 
-template<typename T>
-NVector<T> &NPMatrix<T>::solve(NVector<T> &u) const {
-    size_t i, l, k;
+template<typename T, typename A>
+NPMatrix<T, A> &NPMatrix<T, A>::expm() {
+    assert(std::is_floating_point<T>::value);
+    assert(_i2 - _i1 == _j2 - _j1);
+
+    NArenaScope scope;
+    const size_t n = _i2 - _i1 + 1, nn = n * n;
+    vector<T, NArenaAllocator<T>> work(7 * nn);
+    vector<size_t, NArenaAllocator<size_t>> perm(n + 1);
+    NMatrixView<T>(work.data(), n, n, n).assign(browseView());
+
+    const T *res = padeExponential(n, work.data(), perm.data(), is_floating_point<T>());
+    browseView().assign(NMatrixView<const T>(res, n, n, n));
+    return clean();
+}
 
-    if (_a == nullptr) { lupUpdate(); }
+template<typename T, typename A>
+NPMatrix<T, A> &NPMatrix<T, A>::inv() {
+    if (_lu == nullptr && _llt == nullptr) { lupUpdate(); }
 
-    if (_i2 - _i1 + 1 == u.dim() && _a != nullptr) {
-        for (i = 0; i < _a->_n; i++) {
-            u(i) = u((*_perm)[i]);
-            for (l = 0; l < i; ++l) {
-                u(i) -= (*_a)(i, l) * u(l);
+    if (_llt != nullptr || !_lu->isSingular()) {
+        const size_t n = factorOrder();
+        T *x = this->data() + vectorIndex(_i1, _j1);
+
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = 0; j < n; ++j) {
+                x[i * _p + j] = (i == j) ? 1 : 0;
             }
         }
-        for (i = 0; i < _a->_n; i++) {
-            k = _a->_n - 1 - i;
-            for (l = k + 1; l < _a->_n; ++l) {
-                u(k) -= (*_a)(k, l) * u(l);
-            }
-            u(k) /= (*_a)(k, k);
+        if (_llt != nullptr) {
+            NBlas<T>::potrs(n, n, _llt->factors().data(), n, x, _p);
+        } else {
+            NBlas<T>::getrs(n, n, _lu->factors().data(), n, _lu->perm().data(), x, _p);
         }
-        if (_a->_n != _n) {
-            lupClear();
+    }
+    return clean();
+}
+
+template<typename T, typename A>
+NVector<T, A> &NPMatrix<T, A>::solve(NVector<T, A> &u) const {
+    if (_lu == nullptr && _llt == nullptr) { lupUpdate(); }
+
+    if (factorOrder() == u.dim()) {
+        if (_llt != nullptr) {
+            _llt->solve(u);
+        } else {
+            _lu->solve(u);
         }
     }
+    if (factorOrder() != _n) {
+        lupClear();
+    }
     return u;
 }
 
+template<typename T, typename A>
+NPMatrix<T, A> &NPMatrix<T, A>::solve(NPMatrix<T, A> &b) const {
+    if (_lu == nullptr && _llt == nullptr) { lupUpdate(); }
 
-// LUP MANAGEMENT
+    if (factorOrder() == b._i2 - b._i1 + 1) {
+        if (_llt != nullptr) {
+            _llt->solve(b);
+        } else {
+            _lu->solve(b);
+        }
+    }
+    if (factorOrder() != _n) {
+        lupClear();
+    }
+    setDefaultBrowseIndices();
+    return b.clean();
+}
 
+template<typename T, typename A>
+NVector<T, A> &NPMatrix<T, A>::transSolve(NVector<T, A> &u) const {
+    if (_lu == nullptr && _llt == nullptr) { lupUpdate(); }
 
-template<typename T>
-void NPMatrix<T>::lupClear() const  {
-    if(_a != nullptr){
-        _a.reset(nullptr);
-        _perm.reset(nullptr);
+    if (factorOrder() == u.dim()) {
+        if (_llt != nullptr) {
+            _llt->solve(u);
+        } else {
+            _lu->transSolve(u);
+        }
+    }
+    if (factorOrder() != _n) {
+        lupClear();
     }
+    setDefaultBrowseIndices();
+    return u;
 }
 
-template<typename T>
-void NPMatrix<T>::lupReset() const {
-    lupClear();
-    _a.reset(new NPMatrix<T>(subMatrix(_i1, _j1, _i2, _j2)));
-    _perm.reset(new vector<size_t>(_a->_n + 1, 0));
-    for (size_t i = 0; i <= _a->_n; ++i)
-        (*_perm)[i] = i; //Unit p permutation, p[i] initialized with i
-}
+template<typename T, typename A>
+NPMatrix<T, A> &NPMatrix<T, A>::transSolve(NPMatrix<T, A> &b) const {
+    if (_lu == nullptr && _llt == nullptr) { lupUpdate(); }
 
-template<typename T>
-void NPMatrix<T>::lupCopy(const NPMatrix &m) const {
-    if(m._a > nullptr) {
-        _a.reset(new NPMatrix<T>(*(m._a)));
-        _perm.reset(new vector<size_t>(m._perm->begin(), m._perm->end()));
-    } else {
+    if (factorOrder() == b._i2 - b._i1 + 1) {
+        if (_llt != nullptr) {
+            _llt->solve(b);
+        } else {
+            _lu->transSolve(b);
+        }
+    }
+    if (factorOrder() != _n) {
         lupClear();
     }
+    setDefaultBrowseIndices();
+    return b.clean();
+}
+
+
+// LUP MANAGEMENT
 
+
+template<typename T, typename A>
+void NPMatrix<T, A>::lupClear() const  {
+    _lu.reset();
+    _llt.reset();
 }
 
-template<typename T>
-void NPMatrix<T>::lupUpdate() const {
+template<typename T, typename A>
+void NPMatrix<T, A>::lupCopy(const NPMatrix &m) const {
+    _lu = m._lu;
+    _llt = m._llt;
+}
+
+template<typename T, typename A>
+void NPMatrix<T, A>::lupUpdate() const {
     //Returns PA such as PA = LU where P is a row p array and A = L * U;
-    size_t i, j, k, i_max;
-
-    lupReset();
-    if (!_a->isUpper() || !_a->isLower()) {
-        for (i = 0; i < _a->_n; ++i) {
-            i_max = _a->col(i)(i, _a->_n - 1).maxAbsIndex() + i;
-            if (abs((*_a)(i_max, i)) > EPSILON) { //matrix is not degenerate
-                if (i_max != i) {
-                    j = (*_perm)[i];
-                    (*_perm)[i] = (*_perm)[i_max];
-                    (*_perm)[i_max] = j;
-
-                    _a->swapRow(i, i_max);
-
-                    (*_perm)[_a->_n]++; //counting pivots starting from a->_n (for determinant)
-                }
-            } else {
-                lupClear();
-                return;
-            }
-            for (j = i + 1; j < _a->_n; ++j) {
-                (*_a)(j, i) /= (*_a)(i, i);
-                for (k = i + 1; k < _a->_n; ++k) {
-                    (*_a)(j, k) -= (*_a)(j, i) * (*_a)(i, k);
-                }
-            }
-        }
-    }
+    _lu = make_shared<const NLU<T, A>>(
+            NMatrixView<const T>(this->data() + vectorIndex(_i1, _j1), _i2 - _i1 + 1, _j2 - _j1 + 1, _p));
+}
+
+template<typename T, typename A>
+size_t NPMatrix<T, A>::factorOrder() const {
+    return (_llt != nullptr) ? _llt->n() : _lu->n();
 }
 
 
 // CHARACTERIZATION
 
-template<typename T>
-bool NPMatrix<T>::hasDefaultBrowseIndices() const {
+template<typename T, typename A>
+bool NPMatrix<T, A>::hasDefaultBrowseIndices() const {
     return _i1 == 0 &&
            _j1 == 0 &&
            (_i2 == _n - 1 || _i2 == 0) &&
            (_j2 == _p - 1 || _j2 == 0) &&
-           NVector<T>::hasDefaultBrowseIndices();
+           NVector<T, A>::hasDefaultBrowseIndices();
 }
 
-template<typename T>
-void NPMatrix<T>::setDefaultBrowseIndices() const {
+template<typename T, typename A>
+void NPMatrix<T, A>::setDefaultBrowseIndices() const {
     _i1 = 0;
     _j1 = 0;
     _i2 = _n - 1;
     _j2 = _p - 1;
-    NVector<T>::setDefaultBrowseIndices();
+    NVector<T, A>::setDefaultBrowseIndices();
 }
 
 // SERIALIZATION
 
-template<typename T>
-NPMatrix<T> &NPMatrix<T>::copy(const NPMatrix<T> &m) {
+template<typename T, typename A>
+NPMatrix<T, A> &NPMatrix<T, A>::copy(const NPMatrix<T, A> &m) {
     if (this != &m) {
         if (hasDefaultBrowseIndices() && m.hasDefaultBrowseIndices()) {
-            vector<T>::operator=(m);
+            vector<T, A>::operator=(m);
             _n = m._n;
             _p = m._p;
             lupCopy(m);
         } else if (hasDefaultBrowseIndices()) {
-            vector<T>::operator=(m.subMatrix(m._i1, m._j1, m._i2, m._j2));
-            _n = m._i2 - m._i1 + 1;
-            _p = m._j2 - m._j1 + 1;
-            lupClear();
+            *this = NMatrixView<const T>(m.data() + m.vectorIndex(m._i1, m._j1), m._i2 - m._i1 + 1,
+                                         m._j2 - m._j1 + 1, m._p);
         } else {
             setSubMatrix(m);
             lupClear();
@@ -704,8 +961,29 @@ NPMatrix<T> &NPMatrix<T>::copy(const NPMatrix<T> &m) {
     return *this;
 }
 
-template<typename T>
-NPMatrix<T> &NPMatrix<T>::copy(const vector<vector<T>> &data) {
+template<typename T, typename A>
+NPMatrix<T, A> &NPMatrix<T, A>::operator=(const NMatrixView<const T> &m) {
+    const T *first = this->data(), *last = this->data() + this->size();
+    bool alias = std::less_equal<const T *>()(first, m.data()) && std::less<const T *>()(m.data(), last);
+    if (hasDefaultBrowseIndices() && alias) {
+        NPMatrix<T, A> res(m);
+        vector<T, A>::swap(res);
+        _n = m.n();
+        _p = m.p();
+    } else if (hasDefaultBrowseIndices()) {
+        vector<T, A>::resize(m.n() * m.p());
+        _n = m.n();
+        _p = m.p();
+        setDefaultBrowseIndices();
+        view().assign(m);
+    } else {
+        browseView().assign(m);
+    }
+    return clean();
+}
+
+template<typename T, typename A>
+NPMatrix<T, A> &NPMatrix<T, A>::copy(const vector<vector<T>> &data) {
     for (size_t i = 0; i < _n; ++i) {
         assert(data[i].size() == data[0].size());
 
@@ -718,9 +996,9 @@ NPMatrix<T> &NPMatrix<T>::copy(const vector<vector<T>> &data) {
 
 // SUB-MATRICES
 
-template<typename T>
-NPMatrix<T> NPMatrix<T>::subMatrix(size_t i1, size_t j1, size_t i2, size_t j2) const {
-    NPMatrix<T> sub_matrix = NPMatrix<T>::zeros(i2 - i1 + 1, j2 - j1 + 1);
+template<typename T, typename A>
+NPMatrix<T, A> NPMatrix<T, A>::subMatrix(size_t i1, size_t j1, size_t i2, size_t j2) const {
+    NPMatrix<T, A> sub_matrix = NPMatrix<T, A>::zeros(i2 - i1 + 1, j2 - j1 + 1);
     for (size_t i = 0; i <= i2 - i1; ++i) {
         for (size_t j = 0; j <= j2 - j1; ++j) {
             sub_matrix(i, j) = (*this)(i + i1, j + j1);
@@ -729,31 +1007,71 @@ NPMatrix<T> NPMatrix<T>::subMatrix(size_t i1, size_t j1, size_t i2, size_t j2) c
     return sub_matrix;
 }
 
-template<typename T>
-NPMatrix<T> &NPMatrix<T>::setSubMatrix(const NPMatrix<T> &m) {
+template<typename T, typename A>
+NPMatrix<T, A> &NPMatrix<T, A>::setSubMatrix(const NPMatrix<T, A> &m) {
     return forEach(m, [](T &x, const T &y) { x = y; });
 }
 
-template<typename T>
-NPMatrix<T> &NPMatrix<T>::forEach(const NPMatrix<T> &m, const function<void(T &, const T &)> &binary_op) {
-    assert(hasSameSize(m));
+// TRANSPOSED VIEW
 
-    for (size_t i = 0; i <= _i2 - _i1; ++i) {
-        for (size_t j = 0; j <= _j2 - _j1; ++j) {
-            binary_op((*this)(i + _i1, j + _j1), m(i + m._i1, j + m._j1));
-        }
-    }
-    return cleanBoth(m);
+template<typename T, typename A>
+NTransposed<T, A>::NTransposed(const NPMatrix<T, A> &m) :
+        _matrix(m), _i1(m._i1), _j1(m._j1), _i2(m._i2), _j2(m._j2) {
+    m.setDefaultBrowseIndices();
 }
 
-template<typename T>
-NPMatrix<T> &NPMatrix<T>::forEach(T s, const function<void(T &, T)> &binary_op) {
-    for (size_t i = _i1; i <= _i2; ++i) {
-        for (size_t j = _j1; j <= _j2; ++j) {
-            binary_op((*this)(i, j), s);
-        }
-    }
-    return clean();
+template<typename T, typename A>
+NTransposed<T, A>::operator NPMatrix<T, A>() const {
+    NPMatrix<T, A> res(n(), p());
+    const NMatrixView<const T> a = view();
+    NBlas<T>::transpose(a.n(), a.p(), a.data(), a.ld(), res.data(), res._p);
+    return res;
+}
+
+template<typename T, typename A>
+NMatrixView<const T> NTransposed<T, A>::block(const NPMatrix<T, A> &m) {
+    NMatrixView<const T> res{m.empty() ? NMatrixView<const T>() :
+                             NMatrixView<const T>(m.data() + m.vectorIndex(m._i1, m._j1), m._i2 - m._i1 + 1,
+                                                  m._j2 - m._j1 + 1, m._p)};
+    m.setDefaultBrowseIndices();
+    return res;
+}
+
+template<typename T, typename A>
+NPMatrix<T, A> NTransposed<T, A>::product(const NMatrixView<const T> &a, bool trans_a,
+                                          const NMatrixView<const T> &b, bool trans_b) {
+    const size_t n = trans_a ? a.p() : a.n(), q = trans_a ? a.n() : a.p(), p = trans_b ? b.n() : b.p();
+    assert(q == (trans_b ? b.p() : b.n()));
+
+    NPMatrix<T, A> res(n, p);
+    NBlas<T>::gemm(n, p, q, T(1), a.data(), trans_a ? 1 : a.ld(), trans_a ? a.ld() : 1,
+                   b.data(), trans_b ? 1 : b.ld(), trans_b ? b.ld() : 1, res.data(), p);
+    return res;
+}
+
+template<typename T, typename A>
+NMatrixView<const T> NTransposed<T, A>::view() const {
+    return _matrix.empty() ? NMatrixView<const T>() :
+           NMatrixView<const T>(_matrix.data() + _matrix.vectorIndex(_i1, _j1), p(), n(), _matrix._p);
+}
+
+template<typename T, typename A>
+const NPMatrix<T, A> &NTransposed<T, A>::select() const {
+    _matrix._i1 = _i1;
+    _matrix._j1 = _j1;
+    _matrix._i2 = _i2;
+    _matrix._j2 = _j2;
+    return _matrix;
+}
+
+template<typename T, typename A>
+NVector<T, A> &NTransposed<T, A>::solve(NVector<T, A> &u) const {
+    return select().transSolve(u);
+}
+
+template<typename T, typename A>
+NPMatrix<T, A> &NTransposed<T, A>::solve(NPMatrix<T, A> &b) const {
+    return select().transSolve(b);
 }
 
 
@@ -775,4 +1093,28 @@ class NPMatrix<AESByte>;
 template
 class NPMatrix<Pixel>;
 
+template
+class NPMatrix<double_t, std::allocator<double_t>>;
+
+template
+class NTransposed<double_t>;
+
+template
+class NTransposed<char>;
+
+template
+class NTransposed<uc_t>;
+
+template
+class NTransposed<int>;
+
+template
+class NTransposed<AESByte>;
+
+template
+class NTransposed<Pixel>;
+
+template
+class NTransposed<double_t, std::allocator<double_t>>;
+
 #pragma clang diagnostic pop
\ No newline at end of file
@@ -0,0 +1,120 @@
+//
+// Created on 17/10/2026.
+//
+
+#include <NPreconditioner.h>
+
+using namespace std;
+
+// JACOBI
+
+template<typename T, typename A>
+NJacobiPreconditioner<T, A>::NJacobiPreconditioner(const NVector<T, A> &diag) :
+        _inv_diag(diag) {
+    for (size_t k = 0; k < _inv_diag.dim(); ++k) {
+        _inv_diag(k) = (_inv_diag(k) == T(0)) ? T(1) : T(1) / _inv_diag(k);
+    }
+}
+
+template<typename T, typename A>
+NJacobiPreconditioner<T, A>::NJacobiPreconditioner(const NPMatrix<T, A> &a) :
+        NJacobiPreconditioner(NVector<T, A>(a.n())) {
+    for (size_t k = 0; k < _inv_diag.dim(); ++k) {
+        _inv_diag(k) = (a(k, k) == T(0)) ? T(1) : T(1) / a(k, k);
+    }
+}
+
+template<typename T, typename A>
+NJacobiPreconditioner<T, A>::NJacobiPreconditioner(const NSparseMatrix<T, A> &a) :
+        NJacobiPreconditioner(NVector<T, A>(a.n())) {
+    for (size_t k = 0; k < _inv_diag.dim(); ++k) {
+        _inv_diag(k) = (a(k, k) == T(0)) ? T(1) : T(1) / a(k, k);
+    }
+}
+
+template<typename T, typename A>
+void NJacobiPreconditioner<T, A>::apply(const NVector<T, A> &r, NVector<T, A> &z) const {
+    const size_t n = _inv_diag.dim();
+    const T *inv_diag = _inv_diag.data(), *r_data = r.data();
+    T *z_data = z.data();
+    assert(r.dim() == n && z.dim() == n);
+
+    for (size_t k = 0; k < n; ++k) {
+        z_data[k] = inv_diag[k] * r_data[k];
+    }
+}
+
+// ILU(0)
+
+template<typename T, typename A>
+NILUPreconditioner<T, A>::NILUPreconditioner(const NSparseMatrix<T, A> &a) :
+        _lu(a), _diag(a.n()) {
+    assert(a.n() == a.p());
+
+    const size_t n = a.n(), none = numeric_limits<size_t>::max();
+    const vector<size_t> &rows = _lu.rows(), &cols = _lu.cols();
+    vector<T, A> &lu = _lu.values();
+    vector<size_t> position(n, none);
+
+    for (size_t i = 0; i < n; ++i) {
+        auto it = lower_bound(cols.begin() + (long) rows[i], cols.begin() + (long) rows[i + 1], i);
+        assert(it != cols.begin() + (long) rows[i + 1] && *it == i);
+        _diag[i] = (size_t) (it - cols.begin());
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t l = rows[i]; l < rows[i + 1]; ++l) {
+            position[cols[l]] = l;
+        }
+
+        for (size_t l = rows[i]; l < _diag[i]; ++l) {
+            const size_t k = cols[l];
+            lu[l] /= lu[_diag[k]];
+            for (size_t m = _diag[k] + 1; m < rows[k + 1]; ++m) {
+                if (position[cols[m]] != none) {
+                    lu[position[cols[m]]] -= lu[l] * lu[m];
+                }
+            }
+        }
+
+        for (size_t l = rows[i]; l < rows[i + 1]; ++l) {
+            position[cols[l]] = none;
+        }
+    }
+}
+
+template<typename T, typename A>
+void NILUPreconditioner<T, A>::apply(const NVector<T, A> &r, NVector<T, A> &z) const {
+    const size_t n = _lu.n();
+    const size_t *rows = _lu.rows().data(), *cols = _lu.cols().data();
+    const T *lu = _lu.values().data(), *r_data = r.data();
+    T *z_data = z.data();
+    assert(r.dim() == n && z.dim() == n);
+
+    for (size_t i = 0; i < n; ++i) {
+        T z_i = r_data[i];
+        for (size_t l = rows[i]; l < _diag[i]; ++l) {
+            z_i -= lu[l] * z_data[cols[l]];
+        }
+        z_data[i] = z_i;
+    }
+    for (size_t i = n; i-- > 0;) {
+        T z_i = z_data[i];
+        for (size_t l = _diag[i] + 1; l < rows[i + 1]; ++l) {
+            z_i -= lu[l] * z_data[cols[l]];
+        }
+        z_data[i] = z_i / lu[_diag[i]];
+    }
+}
+
+template
+class NJacobiPreconditioner<double_t>;
+
+template
+class NJacobiPreconditioner<double_t, std::allocator<double_t>>;
+
+template
+class NILUPreconditioner<double_t>;
+
+template
+class NILUPreconditioner<double_t, std::allocator<double_t>>;
@@ -0,0 +1,113 @@
+//
+// Created on 17/10/2026.
+//
+
+#include <NQR.h>
+#include <NBlas.h>
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wabsolute-value"
+
+using namespace std;
+
+// CONSTRUCTION
+
+template<typename T, typename A>
+NQR<T, A>::NQR(const NPMatrix<T, A> &m) {
+    factorize(NMatrixView<const T>(m.data() + m.vectorIndex(m._i1, m._j1), m._i2 - m._i1 + 1, m._j2 - m._j1 + 1,
+                                   m._p));
+    m.setDefaultBrowseIndices();
+}
+
+template<typename T, typename A>
+NQR<T, A>::NQR(const NMatrixView<const T> &m) {
+    factorize(m);
+}
+
+// GETTERS
+
+template<typename T, typename A>
+NPMatrix<T, A> NQR<T, A>::Q() const {
+    const size_t n = this->n(), p = this->p();
+    NPMatrix<T, A> q = NPMatrix<T, A>::zeros(n, p);
+    for (size_t i = 0; i < p; ++i) {
+        q(i, i) = T(1);
+    }
+
+    NBlas<T>::gemqrt(n, p, p, _qr->data(), p, _t->data(), p, q.data(), p, false);
+    return q;
+}
+
+template<typename T, typename A>
+NPMatrix<T, A> NQR<T, A>::R() const {
+    const size_t p = this->p();
+    const T *a = _qr->data();
+    NPMatrix<T, A> r = NPMatrix<T, A>::zeros(p);
+    for (size_t i = 0; i < p; ++i) {
+        std::copy(a + i * p + i, a + (i + 1) * p, r.data() + i * p + i);
+    }
+    return r;
+}
+
+// ALGEBRA
+
+template<typename T, typename A>
+NVector<T, A> &NQR<T, A>::transApply(NVector<T, A> &u) const {
+    assert(u.dim() == n());
+
+    NBlas<T>::gemqrt(n(), p(), 1, _qr->data(), p(), _t->data(), p(), u.data(), 1, true);
+    return u;
+}
+
+template<typename T, typename A>
+NVector<T, A> &NQR<T, A>::apply(NVector<T, A> &u) const {
+    assert(u.dim() == n());
+
+    NBlas<T>::gemqrt(n(), p(), 1, _qr->data(), p(), _t->data(), p(), u.data(), 1, false);
+    return u;
+}
+
+template<typename T, typename A>
+NVector<T, A> &NQR<T, A>::leastSquares(NVector<T, A> &u) const {
+    assert(u.dim() == n() && _full_rank);
+
+    if (_full_rank) {
+        transApply(u);
+        NBlas<T>::trsmUpper(p(), 1, _qr->data(), p(), u.data(), 1);
+        u.resize(p());
+    }
+    return u;
+}
+
+// PROTECTED METHODS
+
+template<typename T, typename A>
+void NQR<T, A>::factorize(const NMatrixView<const T> &m) {
+    assert(m.n() >= m.p());
+
+    const size_t p = m.p();
+    auto qr = make_shared<NPMatrix<T, A>>(m);
+    auto t = make_shared<NPMatrix<T, A>>(NPMatrix<T, A>::zeros(max(min((size_t) NBLAS_NB, p), (size_t) 1), p));
+
+    NBlas<T>::geqrt(m.n(), p, qr->data(), p, t->data(), p);
+    T scale = T(0);
+    for (size_t i = 0; i < p; ++i) {
+        scale = max(scale, T(abs((*qr)(i, i))));
+    }
+    _full_rank = p > 0;
+    for (size_t i = 0; i < p; ++i) {
+        _full_rank = _full_rank && abs((*qr)(i, i)) > T((double_t) m.n()) * EPSILON * scale;
+    }
+    _qr = std::move(qr);
+    _t = std::move(t);
+    _n = m.n();
+    _p = p;
+}
+
+template
+class NQR<double_t>;
+
+template
+class NQR<double_t, std::allocator<double_t>>;
+
+#pragma clang diagnostic pop
@@ -0,0 +1,201 @@
+//
+// Created on 17/10/2026.
+//
+
+#include <NSVD.h>
+#include <NQR.h>
+#include <NBlas.h>
+#include <NArena.h>
+#include <random>
+
+using namespace std;
+
+/**
+ * Seed of the gaussian matrices of the randomized decomposition.
+ */
+#define NSVD_SEED 20181017
+
+// CONSTRUCTION
+
+template<typename T, typename A>
+NSVD<T, A>::NSVD(const NPMatrix<T, A> &m) {
+    jacobi(NMatrixView<const T>(m.data() + m.vectorIndex(m._i1, m._j1), m._i2 - m._i1 + 1, m._j2 - m._j1 + 1,
+                                m._p));
+    m.setDefaultBrowseIndices();
+}
+
+template<typename T, typename A>
+NSVD<T, A>::NSVD(const NPMatrix<T, A> &m, size_t k, size_t power_iterations, size_t oversampling) {
+    NPMatrix<T, A> a(NMatrixView<const T>(m.data() + m.vectorIndex(m._i1, m._j1), m._i2 - m._i1 + 1,
+                                          m._j2 - m._j1 + 1, m._p));
+    m.setDefaultBrowseIndices();
+
+    const size_t n = a.n(), p = a.p(), l = min(k + oversampling, min(n, p));
+    assert(k > 0 && k <= min(n, p));
+
+    // Orthonormal basis Q of the range of A Omega
+    mt19937_64 generator(NSVD_SEED);
+    normal_distribution<T> normal;
+    NPMatrix<T, A> omega(p, l);
+    for (size_t i = 0; i < p; ++i) {
+        for (size_t j = 0; j < l; ++j) {
+            omega(i, j) = normal(generator);
+        }
+    }
+    NPMatrix<T, A> y = a * omega;
+    NPMatrix<T, A> q = NQR<T, A>(y).Q();
+
+    // Power iterations Q = orth(A orth(A^T Q)), orthonormalizing each product to keep the small singular values
+    for (size_t iter = 0; iter < power_iterations; ++iter) {
+        NPMatrix<T, A> z = a.transposed() * q;
+        z = NQR<T, A>(z).Q();
+        y = a * z;
+        q = NQR<T, A>(y).Q();
+    }
+
+    // B = Q^T A = U_B S V^T and U = Q U_B
+    NPMatrix<T, A> b = q.transposed() * a;
+    jacobi(b.view());
+
+    NPMatrix<T, A> u_b(l, k), vt(k, p);
+    NVector<T, A> s(k);
+    for (size_t j = 0; j < k; ++j) {
+        s(j) = _s(j);
+        for (size_t i = 0; i < l; ++i) {
+            u_b(i, j) = _u(i, j);
+        }
+        std::copy(_vt.data() + j * p, _vt.data() + (j + 1) * p, vt.data() + j * p);
+    }
+    _u = q * u_b;
+    _s = s;
+    _vt = vt;
+}
+
+// ALGEBRA
+
+template<typename T, typename A>
+NPMatrix<T, A> NSVD<T, A>::approximation() const {
+    NPMatrix<T, A> us(_u);
+    for (size_t i = 0; i < us.n(); ++i) {
+        for (size_t j = 0; j < us.p(); ++j) {
+            us(i, j) *= _s(j);
+        }
+    }
+    return us * _vt;
+}
+
+// PROTECTED METHODS
+
+template<typename T, typename A>
+void NSVD<T, A>::jacobi(const NMatrixView<const T> &m) {
+    // B is A if it is tall, else A^T, and is reduced to its R factor if it has more rows than columns
+    const bool wide = m.n() < m.p();
+    const size_t rows = wide ? m.p() : m.n(), cols = wide ? m.n() : m.p();
+    NPMatrix<T, A> b(rows, cols), q;
+    if (wide) {
+        NBlas<T>::transpose(m.n(), m.p(), m.data(), m.ld(), b.data(), cols);
+    } else {
+        b.view().assign(m);
+    }
+
+    NArenaScope scope;
+    size_t len = rows;
+    if (rows > cols) {
+        NQR<T, A> qr{b};
+        q = qr.Q();
+        b = qr.R();
+        len = cols;
+    }
+    vector<T, NArenaAllocator<T>> g(cols * len), v(cols * cols), norms(cols);
+    vector<size_t> order(cols);
+    for (size_t c = 0; c < cols; ++c) {
+        for (size_t r = 0; r < len; ++r) {
+            g[c * len + r] = b(r, c);
+        }
+    }
+
+    _converged = rotate(len, cols, g.data(), v.data());
+
+    for (size_t c = 0; c < cols; ++c) {
+        norms[c] = sqrt(NBlas<T>::norm2(len, g.data() + c * len));
+        order[c] = c;
+    }
+    std::sort(order.begin(), order.end(), [&](size_t i, size_t j) { return norms[i] > norms[j]; });
+
+    // B = U_B S V_B^T where the columns of U_B are the normalized columns of G
+    NPMatrix<T, A> u_b(len, cols);
+    _s = NVector<T, A>(cols);
+    for (size_t j = 0; j < cols; ++j) {
+        const T s = norms[order[j]], inv_s = (s > T(0)) ? T(1) / s : T(0);
+        const T *g_j = g.data() + order[j] * len;
+        _s(j) = s;
+        for (size_t r = 0; r < len; ++r) {
+            u_b(r, j) = g_j[r] * inv_s;
+        }
+    }
+    if (rows > cols) {
+        u_b = q * u_b;
+    }
+
+    // A = B, or A = B^T = V_B S U_B^T
+    NPMatrix<T, A> v_b(cols, cols);
+    for (size_t j = 0; j < cols; ++j) {
+        for (size_t r = 0; r < cols; ++r) {
+            v_b(r, j) = v[order[j] * cols + r];
+        }
+    }
+    _u = wide ? v_b : u_b;
+    _vt = (wide ? u_b : v_b).transposed();
+}
+
+template<typename T, typename A>
+bool NSVD<T, A>::rotate(size_t n, size_t p, T *g, T *v) {
+    const T tol = sqrt(T(n)) * numeric_limits<T>::epsilon();
+    std::fill(v, v + p * p, T(0));
+    for (size_t i = 0; i < p; ++i) {
+        v[i * p + i] = T(1);
+    }
+
+    for (size_t sweep = 0; sweep < NSVD_MAX_SWEEPS; ++sweep) {
+        bool rotated = false;
+
+        for (size_t i = 0; i < p; ++i) {
+            for (size_t j = i + 1; j < p; ++j) {
+                T *g_i = g + i * n, *g_j = g + j * n;
+                const T alpha = NBlas<T>::norm2(n, g_i), beta = NBlas<T>::norm2(n, g_j);
+                const T gamma = NBlas<T>::dot(n, g_i, g_j);
+                if (!(abs(gamma) > tol * sqrt(alpha * beta))) {
+                    continue;
+                }
+                rotated = true;
+
+                // Rotation diagonalizing the Gram matrix [alpha gamma; gamma beta] of the two columns
+                const T zeta = (beta - alpha) / (2 * gamma);
+                const T t = ((zeta >= 0) ? T(1) : T(-1)) / (abs(zeta) + hypot(T(1), zeta));
+                const T c = T(1) / sqrt(1 + t * t), s = c * t;
+                for (size_t r = 0; r < n; ++r) {
+                    const T x = g_i[r], y = g_j[r];
+                    g_i[r] = c * x - s * y;
+                    g_j[r] = s * x + c * y;
+                }
+                T *v_i = v + i * p, *v_j = v + j * p;
+                for (size_t r = 0; r < p; ++r) {
+                    const T x = v_i[r], y = v_j[r];
+                    v_i[r] = c * x - s * y;
+                    v_j[r] = s * x + c * y;
+                }
+            }
+        }
+
+        if (!rotated) {
+            return true;
+        }
+    }
+    return false;
+}
+
+template
+class NSVD<double_t>;
+
+template
+class NSVD<double_t, std::allocator<double_t>>;
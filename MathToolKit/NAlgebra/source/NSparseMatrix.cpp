@@ -0,0 +1,187 @@
+//
+// Created on 17/10/2026.
+//
+
+#include <NSparseMatrix.h>
+#include <NBlas.h>
+#include <NKrylov.h>
+
+using namespace std;
+
+// CONSTRUCTION
+
+template<typename T, typename A>
+NSparseMatrix<T, A>::NSparseMatrix(size_t n, size_t p) :
+        _n(n), _p(p),
+        _rows(n + 1, 0), _cols(), _values() {}
+
+template<typename T, typename A>
+NSparseMatrix<T, A>::NSparseMatrix(size_t n, size_t p, const vector<Triplet> &triplets) :
+        NSparseMatrix(n, p) {
+    vector<pair<size_t, T>> entries(triplets.size());
+    vector<size_t> next(n + 1, 0);
+
+    for (const Triplet &t : triplets) {
+        assert(t.i < n && t.j < p);
+        ++next[t.i + 1];
+    }
+    for (size_t i = 0; i < n; ++i) {
+        next[i + 1] += next[i];
+    }
+    vector<size_t> starts(next);
+    for (const Triplet &t : triplets) {
+        entries[next[t.i]++] = make_pair(t.j, t.value);
+    }
+
+    _cols.reserve(entries.size());
+    _values.reserve(entries.size());
+    for (size_t i = 0; i < n; ++i) {
+        sort(entries.begin() + (long) starts[i], entries.begin() + (long) starts[i + 1],
+             [](const pair<size_t, T> &a, const pair<size_t, T> &b) { return a.first < b.first; });
+
+        for (size_t k = starts[i]; k < starts[i + 1]; ++k) {
+            if (_values.size() > _rows[i] && _cols.back() == entries[k].first) {
+                _values.back() += entries[k].second;
+            } else {
+                _cols.push_back(entries[k].first);
+                _values.push_back(entries[k].second);
+            }
+        }
+        _rows[i + 1] = _values.size();
+    }
+}
+
+template<typename T, typename A>
+NSparseMatrix<T, A>::NSparseMatrix(size_t n, size_t p, vector<size_t> rows, vector<size_t> cols,
+                                   vector<T, A> values) :
+        _n(n), _p(p),
+        _rows(std::move(rows)), _cols(std::move(cols)), _values(std::move(values)) {
+    assert(_rows.size() == n + 1 && _rows[n] == _values.size() && _cols.size() == _values.size());
+}
+
+template<typename T, typename A>
+NSparseMatrix<T, A>::NSparseMatrix(const NPMatrix<T, A> &m) :
+        NSparseMatrix(m.n(), m.p()) {
+    for (size_t i = 0; i < _n; ++i) {
+        for (size_t j = 0; j < _p; ++j) {
+            if (m(i, j) != T(0)) {
+                _cols.push_back(j);
+                _values.push_back(m(i, j));
+            }
+        }
+        _rows[i + 1] = _values.size();
+    }
+}
+
+// CONVERSION
+
+template<typename T, typename A>
+NPMatrix<T, A> NSparseMatrix<T, A>::dense() const {
+    NPMatrix<T, A> res = NPMatrix<T, A>::zeros(_n, _p);
+
+    for (size_t i = 0; i < _n; ++i) {
+        for (size_t k = _rows[i]; k < _rows[i + 1]; ++k) {
+            res(i, _cols[k]) = _values[k];
+        }
+    }
+    return res;
+}
+
+template<typename T, typename A>
+string NSparseMatrix<T, A>::str() const {
+    return dense().str();
+}
+
+// ALGEBRA
+
+template<typename T, typename A>
+NSparseMatrix<T, A> NSparseMatrix<T, A>::trans() const {
+    vector<size_t> rows(_p + 1, 0), cols(nnz());
+    vector<T, A> values(nnz());
+
+    for (size_t k = 0; k < nnz(); ++k) {
+        ++rows[_cols[k] + 1];
+    }
+    for (size_t j = 0; j < _p; ++j) {
+        rows[j + 1] += rows[j];
+    }
+    vector<size_t> next(rows);
+    for (size_t i = 0; i < _n; ++i) {
+        for (size_t k = _rows[i]; k < _rows[i + 1]; ++k) {
+            size_t l = next[_cols[k]]++;
+            cols[l] = i;
+            values[l] = _values[k];
+        }
+    }
+    return NSparseMatrix<T, A>(_p, _n, std::move(rows), std::move(cols), std::move(values));
+}
+
+template<typename T, typename A>
+NVector<T, A> &NSparseMatrix<T, A>::product(const NVector<T, A> &x, NVector<T, A> &y) const {
+    assert(x.dim() == _p && &x != &y);
+
+    if (y.dim() != _n) {
+        y = NVector<T, A>(_n);
+    }
+    NBlas<T>::csrmv(_n, _rows.data(), _cols.data(), _values.data(), x.data(), y.data());
+    return y;
+}
+
+template<typename T, typename A>
+NPMatrix<T, A> &NSparseMatrix<T, A>::product(const NPMatrix<T, A> &b, NPMatrix<T, A> &c) const {
+    const size_t p = b.p();
+    assert(b.n() == _p && c.n() == _n && c.p() == p && &b != &c);
+
+    NBlas<T>::csrmm(_n, p, _rows.data(), _cols.data(), _values.data(), b.data(), p, c.data(), p);
+    return c;
+}
+
+template<typename T, typename A>
+NVector<T, A> &NSparseMatrix<T, A>::transProduct(const NVector<T, A> &x, NVector<T, A> &y) const {
+    assert(x.dim() == _n && &x != &y);
+
+    if (y.dim() != _p) {
+        y = NVector<T, A>(_p);
+    }
+    NBlas<T>::csrmvT(_n, _p, _rows.data(), _cols.data(), _values.data(), x.data(), y.data());
+    return y;
+}
+
+template<>
+NVector<double_t> &NSparseMatrix<double_t>::solve(NVector<double_t> &u) const {
+    NVector<double_t> x = NVector<double_t>::zeros(_n);
+    NKrylov<double_t>().cg(*this, u, x);
+    return u = x;
+}
+
+// BI-DIMENSIONAL ACCESSORS
+
+template<typename T, typename A>
+T NSparseMatrix<T, A>::operator()(size_t i, size_t j) const {
+    assert(i < _n && j < _p);
+
+    auto first = _cols.begin() + (long) _rows[i], last = _cols.begin() + (long) _rows[i + 1];
+    auto it = lower_bound(first, last, j);
+    return (it != last && *it == j) ? _values[(size_t) (it - _cols.begin())] : T(0);
+}
+
+template
+class NSparseMatrix<double_t>;
+
+template
+class NSparseMatrix<char>;
+
+template
+class NSparseMatrix<uc_t>;
+
+template
+class NSparseMatrix<int>;
+
+template
+class NSparseMatrix<AESByte>;
+
+template
+class NSparseMatrix<Pixel>;
+
+template
+class NSparseMatrix<double_t, std::allocator<double_t>>;
@@ -0,0 +1,171 @@
+//
+// Created on 17/10/2026.
+//
+
+#include <NThreadPool.h>
+#include <cstdlib>
+
+using namespace std;
+
+static thread_local bool is_worker = false;
+
+/**
+ * Marks the current thread as a worker until the end of the scope, so that nested loops run serially.
+ */
+struct NWorkerScope {
+    NWorkerScope() : _previous(is_worker) { is_worker = true; }
+
+    ~NWorkerScope() { is_worker = _previous; }
+
+    bool _previous;
+};
+
+NThreadPool &NThreadPool::instance() {
+    static NThreadPool pool(defaultWorkers());
+    return pool;
+}
+
+NThreadPool::NThreadPool(size_t workers) {
+    start(workers);
+}
+
+NThreadPool::~NThreadPool() {
+    stop();
+}
+
+size_t NThreadPool::workers() const {
+    return _workers;
+}
+
+void NThreadPool::setWorkers(size_t workers) {
+    lock_guard<mutex> lock(_submit);
+    stop();
+    start(workers);
+}
+
+void NThreadPool::parallelFor(size_t begin, size_t end, size_t grain,
+                              const function<void(size_t, size_t)> &body) {
+    if (end <= begin) {
+        return;
+    }
+
+    grain = max(grain, (size_t) 1);
+    size_t size = end - begin, workers = _workers;
+    size_t chunk = max(grain, (size + workers - 1) / workers);
+    chunk = (chunk + grain - 1) / grain * grain;
+
+    if (is_worker || chunk >= size) {
+        body(begin, end);
+        return;
+    }
+
+    // The pool runs one loop at a time, a loop submitted while it is busy runs on the calling thread
+    unique_lock<mutex> submit(_submit, try_to_lock);
+    if (!submit.owns_lock()) {
+        NWorkerScope scope;
+        body(begin, end);
+        return;
+    }
+
+    {
+        lock_guard<mutex> lock(_mutex);
+        _body = &body;
+        _begin = begin;
+        _end = end;
+        _chunk = chunk;
+        _tasks = (size + chunk - 1) / chunk;
+        _next = 0;
+        _active = _threads.size();
+        _error = nullptr;
+        ++_generation;
+    }
+    _wake.notify_all();
+
+    {
+        NWorkerScope scope;
+        runTasks();
+    }
+
+    exception_ptr error;
+    {
+        unique_lock<mutex> lock(_mutex);
+        _done.wait(lock, [this] { return _active == 0; });
+        _body = nullptr;
+        swap(error, _error);
+    }
+    if (error != nullptr) {
+        rethrow_exception(error);
+    }
+}
+
+// PROTECTED METHODS
+
+void NThreadPool::start(size_t workers) {
+    _stopped = false;
+    _workers = max(workers, (size_t) 1);
+    for (size_t k = 1; k < _workers; ++k) {
+        _threads.emplace_back(&NThreadPool::work, this, _generation);
+    }
+}
+
+void NThreadPool::stop() {
+    {
+        lock_guard<mutex> lock(_mutex);
+        _stopped = true;
+    }
+    _wake.notify_all();
+
+    for (auto &thread : _threads) {
+        thread.join();
+    }
+    _threads.clear();
+}
+
+void NThreadPool::work(size_t generation) {
+    is_worker = true;
+
+    unique_lock<mutex> lock(_mutex);
+
+    while (true) {
+        _wake.wait(lock, [this, generation] { return _stopped || _generation != generation; });
+        if (_stopped) {
+            return;
+        }
+        generation = _generation;
+
+        lock.unlock();
+        runTasks();
+        lock.lock();
+
+        if (--_active == 0) {
+            _done.notify_all();
+        }
+    }
+}
+
+void NThreadPool::runTasks() {
+    size_t task;
+    try {
+        while ((task = _next++) < _tasks) {
+            size_t b = _begin + task * _chunk;
+            (*_body)(b, min(b + _chunk, _end));
+        }
+    } catch (...) {
+        // The first exception is kept and the remaining tasks are skipped
+        lock_guard<mutex> lock(_mutex);
+        if (_error == nullptr) {
+            _error = current_exception();
+        }
+        _next = _tasks;
+    }
+}
+
+size_t NThreadPool::defaultWorkers() {
+    const char *env = getenv(NTHREADPOOL_ENV);
+    long workers = (env != nullptr) ? strtol(env, nullptr, 10) : 0;
+
+    if (workers > 0) {
+        return (size_t) workers;
+    }
+    return max((size_t) thread::hardware_concurrency(), (size_t) 1);
+}
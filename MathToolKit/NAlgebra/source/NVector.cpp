@@ -11,8 +11,8 @@ using namespace std;
 
 // SERIALIZATION
 
-template<typename T>
-string NVector<T>::str() const {
+template<typename T, typename A>
+string NVector<T, A>::str() const {
     stringstream stream;
 
     stream << '(';
@@ -26,53 +26,53 @@ string NVector<T>::str() const {
 
 // GETTERS
 
-template<typename T>
-size_t NVector<T>::dim() const {
+template<typename T, typename A>
+size_t NVector<T, A>::dim() const {
     auto res = _k2 - _k1 + 1;
     setDefaultBrowseIndices();
     return res;
 }
 
-template<typename T>
-std::vector<T> NVector<T>::array() const {
+template<typename T, typename A>
+std::vector<T> NVector<T, A>::array() const {
     std::vector<T> res(begin(), end());
     setDefaultBrowseIndices();
     return res;
 }
 
-template<typename T>
-NVector<T> &NVector<T>::resize(size_t n) {
-    std::vector<T>::resize(n);
+template<typename T, typename A>
+NVector<T, A> &NVector<T, A>::resize(size_t n) {
+    std::vector<T, A>::resize(n);
     setDefaultBrowseIndices();
     return *this;
 }
 
 // MAX / MIN
 
-template<typename T>
-T NVector<T>::max() const {
+template<typename T, typename A>
+T NVector<T, A>::max() const {
     auto res_it = std::max_element(begin(), end());
     setDefaultBrowseIndices();
     return *res_it;
 }
 
-template<typename T>
-T NVector<T>::min() const {
+template<typename T, typename A>
+T NVector<T, A>::min() const {
     auto res_it = std::min_element(begin(), end());
     setDefaultBrowseIndices();
     return *res_it;
 }
 
-template<typename T>
-size_t NVector<T>::maxIndex() const {
+template<typename T, typename A>
+size_t NVector<T, A>::maxIndex() const {
     auto max_it = std::max_element(begin(), end());
     auto res = (size_t) std::distance(begin(), max_it);
     setDefaultBrowseIndices();
     return res;
 }
 
-template<typename T>
-size_t NVector<T>::minIndex() const {
+template<typename T, typename A>
+size_t NVector<T, A>::minIndex() const {
     auto min_it = std::min_element(begin(), end());
     size_t res = (size_t) std::distance(begin(), min_it);
     setDefaultBrowseIndices();
@@ -81,8 +81,8 @@ size_t NVector<T>::minIndex() const {
 
 // ABSOLUTE VALUE MAX / MIN
 
-template<typename T>
-T NVector<T>::maxAbs() const {
+template<typename T, typename A>
+T NVector<T, A>::maxAbs() const {
 
     auto minmax_it = std::minmax_element(begin(), end());
 
@@ -90,8 +90,8 @@ T NVector<T>::maxAbs() const {
     return abs(*minmax_it.second) > abs(*minmax_it.first) ? abs(*minmax_it.second) : abs(*minmax_it.first);
 }
 
-template<typename T>
-T NVector<T>::minAbs() const {
+template<typename T, typename A>
+T NVector<T, A>::minAbs() const {
 
     auto minmax_it = std::minmax_element(begin(), end());
 
@@ -99,8 +99,8 @@ T NVector<T>::minAbs() const {
     return abs(*minmax_it.second) <= abs(*minmax_it.first) ? abs(*minmax_it.second) : abs(*minmax_it.first);
 }
 
-template<typename T>
-size_t NVector<T>::maxAbsIndex() const {
+template<typename T, typename A>
+size_t NVector<T, A>::maxAbsIndex() const {
     auto min_it = std::min_element(begin(), end()), max_it = std::max_element(begin(), end());
 
     size_t res = (size_t) std::distance(begin(), (abs(*min_it) > abs(*max_it)) ? min_it : max_it);
@@ -110,8 +110,8 @@ size_t NVector<T>::maxAbsIndex() const {
 }
 
 
-template<typename T>
-size_t NVector<T>::minAbsIndex() const {
+template<typename T, typename A>
+size_t NVector<T, A>::minAbsIndex() const {
     auto min_it = std::min_element(begin(), end()), max_it = std::max_element(begin(), end());
 
     size_t res = (size_t) std::distance(begin(), (abs(*min_it) <= abs(*max_it)) ? min_it : max_it);
@@ -126,8 +126,8 @@ size_t NVector<T>::minAbsIndex() const {
 // SWAP
 
 
-template<typename T>
-NVector<T> &NVector<T>::swap(size_t k1, size_t k2) {
+template<typename T, typename A>
+NVector<T, A> &NVector<T, A>::swap(size_t k1, size_t k2) {
     assert(isBetweenK12(k1) && isBetweenK12(k2));
     std::iter_swap(begin() + k1, begin() + k2);
     setDefaultBrowseIndices();
@@ -137,8 +137,8 @@ NVector<T> &NVector<T>::swap(size_t k1, size_t k2) {
 // SHIFT
 
 
-template<typename T>
-NVector<T> &NVector<T>::shift(long iterations) {
+template<typename T, typename A>
+NVector<T, A> &NVector<T, A>::shift(long iterations) {
     auto sized_dim = _k2 - _k1 + 1;
     auto sized_iterations = (abs(iterations) % sized_dim);
     auto shift_index = (iterations >= 0 ? sized_iterations : sized_dim - sized_iterations);
@@ -151,8 +151,8 @@ NVector<T> &NVector<T>::shift(long iterations) {
 
 // FILL
 
-template<typename T>
-NVector<T> &NVector<T>::fill(T s) {
+template<typename T, typename A>
+NVector<T, A> &NVector<T, A>::fill(T s) {
     std::fill(begin(), end(), s);
     setDefaultBrowseIndices();
     return *this;
@@ -161,22 +161,22 @@ NVector<T> &NVector<T>::fill(T s) {
 
 // ACCES OPERATOR
 
-template<typename T>
-T &NVector<T>::operator()(long k) {
+template<typename T, typename A>
+T &NVector<T, A>::operator()(long k) {
     auto index = (k >= 0 ? k : _k2 - k);
     assert(isValidIndex(index));
     return (*this)[index];
 }
 
-template<typename T>
-T NVector<T>::operator()(long k) const {
+template<typename T, typename A>
+T NVector<T, A>::operator()(long k) const {
     auto index = (k >= 0 ? k : _k2 - k);
     assert(isValidIndex(index));
     return (*this).at(index);
 }
 
-template<typename T>
-NVector<T> &NVector<T>::operator()(size_t k1, size_t k2) {
+template<typename T, typename A>
+NVector<T, A> &NVector<T, A>::operator()(size_t k1, size_t k2) {
     assert(isValidIndex(k1) && isValidIndex(k2));
     assert(k2 >= k1);
 
@@ -190,25 +190,25 @@ NVector<T> &NVector<T>::operator()(size_t k1, size_t k2) {
 
 // STATIC METHODS
 
-template<typename T>
-NVector<T> NVector<T>::scalar(T s, size_t dim) {
-    NVector<T> scalar(dim);
+template<typename T, typename A>
+NVector<T, A> NVector<T, A>::scalar(T s, size_t dim) {
+    NVector<T, A> scalar(dim);
     scalar.fill(s);
     return scalar;
 }
 
-template<typename T>
-NVector<T> NVector<T>::cano(size_t k, size_t dim) {
+template<typename T, typename A>
+NVector<T, A> NVector<T, A>::cano(size_t k, size_t dim) {
     assert(k < dim);
 
-    NVector<T> cano = NVector<T>::zeros(dim);
+    NVector<T, A> cano = NVector<T, A>::zeros(dim);
     cano(k) = 1;
     return cano;
 }
 
-template<typename T>
-NVector<T> NVector<T>::sum(const std::vector<NVector> &vectors) {
-    NVector<T> sum = NVector<T>::zeros(vectors[0].dim());
+template<typename T, typename A>
+NVector<T, A> NVector<T, A>::sum(const std::vector<NVector> &vectors) {
+    NVector<T, A> sum = NVector<T, A>::zeros(vectors[0].dim());
 
     for (const auto &vector : vectors) {
         sum += vector;
@@ -216,9 +216,9 @@ NVector<T> NVector<T>::sum(const std::vector<NVector> &vectors) {
     return sum;
 }
 
-template<typename T>
-NVector<T> NVector<T>::sumProd(const std::vector<T> &scalars, const std::vector<NVector> &vectors) {
-    NVector<T> sum_prod = NVector<T>::zeros(vectors[0].dim());
+template<typename T, typename A>
+NVector<T, A> NVector<T, A>::sumProd(const std::vector<T> &scalars, const std::vector<NVector> &vectors) {
+    NVector<T, A> sum_prod = NVector<T, A>::zeros(vectors[0].dim());
 
     assert(scalars.size() == vectors.size());
 
@@ -231,53 +231,28 @@ NVector<T> NVector<T>::sumProd(const std::vector<T> &scalars, const std::vector<
 
 // PROTECTED METHODS
 
-template<typename T>
-NVector<T>::NVector(const vector<T> &data, size_t k1, size_t k2) : vector<T>(data), _k1(k1), _k2(k2) {
+template<typename T, typename A>
+NVector<T, A>::NVector(const vector<T> &data, size_t k1, size_t k2) : vector<T, A>(data.begin(), data.end()), _k1(k1), _k2(k2) {
     setDefaultBrowseIndices();
 }
 
 // EUCLIDEAN SPACE OPERATIONS
 
-template<typename T>
-T NVector<T>::dotProduct(const NVector<T> &u) const {
-    T dot = 0;
-
+template<typename T, typename A>
+T NVector<T, A>::dotProduct(const NVector<T, A> &u) const {
     assert(hasSameSize(u));
-    for (size_t k = 0; k <= _k2 - _k1; ++k) {
-        dot += u[k + u._k1] * (*this)[k + _k1];
-    }
-    setDefaultBrowseIndices();
-    u.setDefaultBrowseIndices();
-    return dot;
-}
-
 
-// MANIPULATORS
-
-template<typename T>
-NVector<T> &NVector<T>::forEach(const NVector<T> &u, const std::function<void(T &, const T &)> &binary_op) {
-    assert(hasSameSize(u));
-    for (size_t k = 0; k <= _k2 - _k1; k++) {
-        binary_op((*this)[k + _k1], u[k + u._k1]);
-    }
+    T dot = NBlas<T>::dot(browseDim(), u.data() + u._k1, this->data() + _k1);
     setDefaultBrowseIndices();
     u.setDefaultBrowseIndices();
-    return *this;
+    return dot;
 }
 
-template<typename T>
-NVector<T> &NVector<T>::forEach(T s, const std::function<void(T &, T)> &binary_op) {
-    for (size_t k = 0; k <= _k2 - _k1; k++) {
-        binary_op((*this)[k + _k1], s);
-    }
-    setDefaultBrowseIndices();
-    return *this;
-}
 
 //CHARACTERIZATION
 
-template<typename T>
-bool NVector<T>::isEqual(const NVector<T> &u) const {
+template<typename T, typename A>
+bool NVector<T, A>::isEqual(const NVector<T, A> &u) const {
     if (!hasSameSize(u))
         return false;
     return distance(u) <= EPSILON;
@@ -285,13 +260,13 @@ bool NVector<T>::isEqual(const NVector<T> &u) const {
 
 // AFFECTATION
 
-template<typename T>
-NVector<T> &NVector<T>::copy(const NVector<T> &u) {
+template<typename T, typename A>
+NVector<T, A> &NVector<T, A>::copy(const NVector<T, A> &u) {
     if (this != &u && u.size() > 0) {
         if (hasDefaultBrowseIndices() && u.hasDefaultBrowseIndices()) {
-            this->std::vector<T>::operator=(u);
+            this->std::vector<T, A>::operator=(u);
         } else if (hasDefaultBrowseIndices()) {
-            this->std::vector<T>::operator=(u.subVector(u._k1, u._k2));
+            this->std::vector<T, A>::operator=(u.subVector(u._k1, u._k2));
         } else {
             setSubVector(u);
         }
@@ -303,23 +278,23 @@ NVector<T> &NVector<T>::copy(const NVector<T> &u) {
 
 // SUB-VECTORS
 
-template<typename T>
-NVector<T> NVector<T>::subVector(size_t k1, size_t k2) const {
+template<typename T, typename A>
+NVector<T, A> NVector<T, A>::subVector(size_t k1, size_t k2) const {
     _k1 = k1;
     _k2 = k2;
     size_t dim = k2 - k1 + 1;
 
     assert(isValidIndex(k1) && isValidIndex(k2) && dim > 0);
 
-    vector<T> data(dim);
+    NVector<T, A> data(dim);
     std::copy(begin(), end(), data.begin());
     setDefaultBrowseIndices();
 
     return data;
 }
 
-template<typename T>
-void NVector<T>::setSubVector(const NVector<T> &u) {
+template<typename T, typename A>
+void NVector<T, A>::setSubVector(const NVector<T, A> &u) {
 
     assert(hasSameSize(u));
 
@@ -347,5 +322,8 @@ class NVector<AESByte>;
 template
 class NVector<Pixel>;
 
+template
+class NVector<double_t, std::allocator<double_t>>;
+
 
 #pragma clang diagnostic pop
\ No newline at end of file
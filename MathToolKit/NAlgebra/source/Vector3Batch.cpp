@@ -0,0 +1,187 @@
+//
+// Created on 17/10/2026.
+//
+
+#include <Vector3Batch.h>
+#include <NCpu.h>
+#include <NArena.h>
+#include <NThreadPool.h>
+
+using namespace std;
+
+/**
+ * Call `body(k1, k2)` on sub-ranges of `[0, n)`, concurrently if the batch is large enough.
+ */
+template<typename F>
+static void forEachRange(size_t n, const F &body) {
+    if (n < 2 * NTHREADPOOL_MIN_SIZE) {
+        body(0, n);
+        return;
+    }
+    NThreadPool::instance().parallelFor(0, n, NTHREADPOOL_MIN_SIZE, body);
+}
+
+static inline vec_t &fit(vec_t &u, size_t n) {
+    if (u.dim() != n) {
+        u.resize(n);
+    }
+    return u;
+}
+
+// CONSTRUCTION
+
+Vector3Batch::Vector3Batch(size_t size) : _x(size, 0), _y(size, 0), _z(size, 0) {}
+
+Vector3Batch::Vector3Batch(const vector<Vector3> &vectors) : Vector3Batch(vectors.size()) {
+    for (size_t k = 0; k < vectors.size(); ++k) {
+        set(k, vectors[k]);
+    }
+}
+
+// GETTERS
+
+vec_t &Vector3Batch::r(vec_t &r) const {
+    const NCpuKernels &kernels = NCpu::instance().kernels();
+
+    fit(r, size());
+    forEachRange(size(), [&](size_t k1, size_t k2) {
+        const double_t *u[3] = {x() + k1, y() + k1, z() + k1};
+        kernels.norm3(k2 - k1, u, r.data() + k1);
+    });
+    return r;
+}
+
+vec_t &Vector3Batch::theta(vec_t &theta) const {
+    fit(theta, size());
+    for (size_t k = 0; k < size(); ++k) {
+        theta(k) = atan2(_y[k], _x[k]);
+    }
+    return theta;
+}
+
+vec_t &Vector3Batch::phi(vec_t &phi) const {
+    fit(phi, size());
+    for (size_t k = 0; k < size(); ++k) {
+        phi(k) = atan2(sqrt(_x[k] * _x[k] + _y[k] * _y[k]), _z[k]);
+    }
+    return phi;
+}
+
+// SETTERS
+
+void Vector3Batch::resize(size_t size) {
+    _x.resize(size, 0);
+    _y.resize(size, 0);
+    _z.resize(size, 0);
+}
+
+void Vector3Batch::append(const Vector3 &u) {
+    _x.push_back(u.x());
+    _y.push_back(u.y());
+    _z.push_back(u.z());
+}
+
+void Vector3Batch::setRThetaZ(const vec_t &r, const vec_t &theta, const vec_t &z) {
+    assert(theta.dim() == r.dim() && z.dim() == r.dim());
+
+    resize(r.dim());
+    for (size_t k = 0; k < size(); ++k) {
+        _x[k] = r(k) * cos(theta(k));
+        _y[k] = r(k) * sin(theta(k));
+        _z[k] = z(k);
+    }
+}
+
+void Vector3Batch::setRThetaPhi(const vec_t &r, const vec_t &theta, const vec_t &phi) {
+    assert(theta.dim() == r.dim() && phi.dim() == r.dim());
+
+    resize(r.dim());
+    for (size_t k = 0; k < size(); ++k) {
+        const double_t r_xy = r(k) * sin(phi(k));
+        _x[k] = r_xy * cos(theta(k));
+        _y[k] = r_xy * sin(theta(k));
+        _z[k] = r(k) * cos(phi(k));
+    }
+}
+
+// CONVERSION
+
+vector<Vector3> Vector3Batch::vectors() const {
+    vector<Vector3> vectors(size());
+    for (size_t k = 0; k < size(); ++k) {
+        vectors[k] = (*this)[k];
+    }
+    return vectors;
+}
+
+string Vector3Batch::str() const {
+    stringstream stream;
+
+    for (size_t k = 0; k < size(); ++k) {
+        stream << (*this)[k].str() << endl;
+    }
+    return stream.str();
+}
+
+// ALGEBRA
+
+vec_t &Vector3Batch::dotProduct(const Vector3Batch &v, vec_t &d) const {
+    const NCpuKernels &kernels = NCpu::instance().kernels();
+    assert(v.size() == size());
+
+    fit(d, size());
+    forEachRange(size(), [&](size_t k1, size_t k2) {
+        const double_t *u_k[3] = {x() + k1, y() + k1, z() + k1}, *v_k[3] = {v.x() + k1, v.y() + k1, v.z() + k1};
+        kernels.dot3(k2 - k1, u_k, v_k, d.data() + k1);
+    });
+    return d;
+}
+
+Vector3Batch &Vector3Batch::cross(const Vector3Batch &v) {
+    const NCpuKernels &kernels = NCpu::instance().kernels();
+    assert(v.size() == size());
+
+    forEachRange(size(), [&](size_t k1, size_t k2) {
+        double_t *u_k[3] = {x() + k1, y() + k1, z() + k1};
+        const double_t *v_k[3] = {v.x() + k1, v.y() + k1, v.z() + k1};
+        kernels.cross3(k2 - k1, u_k, v_k);
+    });
+    return *this;
+}
+
+Vector3Batch &Vector3Batch::normalize() {
+    const NCpuKernels &kernels = NCpu::instance().kernels();
+
+    forEachRange(size(), [&](size_t k1, size_t k2) {
+        double_t *u_k[3] = {x() + k1, y() + k1, z() + k1};
+        kernels.normalize3(k2 - k1, u_k);
+    });
+    return *this;
+}
+
+vec_t &Vector3Batch::angle(const Vector3Batch &v, vec_t &angle) const {
+    const NCpuKernels &kernels = NCpu::instance().kernels();
+    const double_t eps = numeric_limits<double_t>::epsilon();
+    assert(v.size() == size());
+
+    fit(angle, size());
+    forEachRange(size(), [&](size_t k1, size_t k2) {
+        const size_t n = k2 - k1;
+        const double_t *u_k[3] = {x() + k1, y() + k1, z() + k1}, *v_k[3] = {v.x() + k1, v.y() + k1, v.z() + k1};
+
+        NArenaScope scope;
+        vector<double_t, NArenaAllocator<double_t>> w_x(u_k[0], u_k[0] + n), w_y(u_k[1], u_k[1] + n);
+        vector<double_t, NArenaAllocator<double_t>> w_z(u_k[2], u_k[2] + n), u_norm(n), v_norm(n), w_norm(n);
+        double_t *w_k[3] = {w_x.data(), w_y.data(), w_z.data()}, *dot = angle.data() + k1;
+
+        kernels.cross3(n, w_k, v_k);
+        kernels.norm3(n, w_k, w_norm.data());
+        kernels.norm3(n, u_k, u_norm.data());
+        kernels.norm3(n, v_k, v_norm.data());
+        kernels.dot3(n, u_k, v_k, dot);
+        for (size_t k = 0; k < n; ++k) {
+            dot[k] = (u_norm[k] > eps && v_norm[k] > eps) ? atan(w_norm[k] / dot[k]) : 0;
+        }
+    });
+    return angle;
+}
@@ -4,10 +4,19 @@
 
 #include <gtest/gtest.h>
 #include <NPMatrix.h>
+#include <NLU.h>
+#include <NCholesky.h>
+#include <NBandMatrix.h>
+#include <NThreadPool.h>
+#include <chrono>
 
 #define NPMATRIX_SMALL_DIM_TEST 500
 #define NPMATRIX_ITERATIONS_TEST 100
 #define NPMATRIX_SMALL_EXP_TEST 5
+#define NPMATRIX_PRODUCT_DIM_TEST 500
+#define NPMATRIX_PRODUCT_ITERATIONS_TEST 5
+#define NPMATRIX_SCALING_DIM_TEST 2000
+#define NPMATRIX_LUP_DIM_TEST 1000
 
 using namespace std;
 
@@ -26,7 +35,7 @@ protected:
             _t0 = clock();
             test(_a, _b);
             _t1 = clock();
-            _elapsed_time += ((_t1 - _t0) / (double_t) CLOCKS_PER_SEC) / NPMATRIX_ITERATIONS_TEST;
+            _elapsed_time += ((double_t) (_t1 - _t0) / (double_t) CLOCKS_PER_SEC) / NPMATRIX_ITERATIONS_TEST;
         }
         cout << op << " AVG ELAPSED TIME : " << _elapsed_time << "s" << endl;
     }
@@ -36,7 +45,7 @@ protected:
             _t0 = clock();
             test(_a, _s);
             _t1 = clock();
-            _elapsed_time += ((_t1 - _t0) / (double_t) CLOCKS_PER_SEC) / NPMATRIX_ITERATIONS_TEST;
+            _elapsed_time += ((double_t) (_t1 - _t0) / (double_t) CLOCKS_PER_SEC) / NPMATRIX_ITERATIONS_TEST;
         }
         cout << op << " AVG ELAPSED TIME : " << _elapsed_time << "s" << endl;
     }
@@ -46,7 +55,7 @@ protected:
             _t0 = clock();
             test(_u, _a);
             _t1 = clock();
-            _elapsed_time += ((_t1 - _t0) / (double_t) CLOCKS_PER_SEC) / NPMATRIX_ITERATIONS_TEST;
+            _elapsed_time += ((double_t) (_t1 - _t0) / (double_t) CLOCKS_PER_SEC) / NPMATRIX_ITERATIONS_TEST;
         }
         cout << op << " AVG ELAPSED TIME : " << _elapsed_time << "s" << endl;
     }
@@ -73,6 +82,16 @@ TEST_F(NPMatrixBenchTest, VectorProd) {
     iterateTestVector([](vec_t &u, const mat_t &a) { u *= a; }, "* (VECTOR)");
 }
 
+TEST_F(NPMatrixBenchTest, VectorProdOutput) {
+    vec_t y;
+    iterateTestVector([&y](vec_t &u, const mat_t &a) { a.product(u, y); }, "* (VECTOR OUTPUT)");
+}
+
+TEST_F(NPMatrixBenchTest, TransposedVectorProd) {
+    vec_t y;
+    iterateTestVector([&y](vec_t &u, const mat_t &a) { a.transProduct(u, y); }, "* (TRANSPOSED VECTOR)");
+}
+
 TEST_F(NPMatrixBenchTest, MatrixProd) {
     iterateTestMatrix([](mat_t &a, const mat_t &b) { a *= b; }, "* (MATRIX)");
 }
@@ -82,17 +101,131 @@ TEST_F(NPMatrixBenchTest, DotProduct) {
 }
 
 TEST_F(NPMatrixBenchTest, Pow) {
-    iterateTestScalar([](mat_t &a, double_t s) { a ^= NPMATRIX_SMALL_EXP_TEST; }, "*");
+    iterateTestScalar([](mat_t &a, double_t) { a ^= NPMATRIX_SMALL_EXP_TEST; }, "*");
 }
 
 TEST_F(NPMatrixBenchTest, Inv) {
-    iterateTestScalar([](mat_t &a, double_t s) { a ^= -1; }, "INVERSION");
+    iterateTestScalar([](mat_t &a, double_t) { a ^= -1; }, "INVERSION");
 }
 
 TEST_F(NPMatrixBenchTest, Det) {
-    iterateTestScalar([](mat_t &a, double_t s) { a.det(); }, "DETERMINANT");
+    iterateTestScalar([](mat_t &a, double_t) { a.det(); }, "DETERMINANT");
 }
 
 TEST_F(NPMatrixBenchTest, Solve) {
     iterateTestVector([](vec_t &u, const mat_t &a) { u %= a; }, "% (SOLVE)");
-}
\ No newline at end of file
+}
+
+TEST_F(NPMatrixBenchTest, SolveMultiple) {
+    iterateTestMatrix([](mat_t &a, const mat_t &b) {
+        mat_t x{b};
+        x %= a;
+    }, "% (SOLVE MULTIPLE)");
+}
+
+TEST_F(NPMatrixBenchTest, MatrixProdPacked) {
+    mat_t a = mat_t::ones(NPMATRIX_PRODUCT_DIM_TEST), b = 2 * mat_t::ones(NPMATRIX_PRODUCT_DIM_TEST), c;
+
+    for (int k = 0; k < NPMATRIX_PRODUCT_ITERATIONS_TEST; ++k) {
+        _t0 = clock();
+        c = a * b;
+        _t1 = clock();
+        _elapsed_time += ((double_t) (_t1 - _t0) / (double_t) CLOCKS_PER_SEC) / NPMATRIX_PRODUCT_ITERATIONS_TEST;
+    }
+    cout << "* (MATRIX PACKED) AVG ELAPSED TIME : " << _elapsed_time << "s" << endl;
+    ASSERT_EQ(c, 2 * NPMATRIX_PRODUCT_DIM_TEST * mat_t::ones(NPMATRIX_PRODUCT_DIM_TEST));
+}
+
+TEST_F(NPMatrixBenchTest, MatrixProdRowCol) {
+    mat_t a = mat_t::ones(NPMATRIX_PRODUCT_DIM_TEST), b = 2 * mat_t::ones(NPMATRIX_PRODUCT_DIM_TEST);
+    mat_t c = mat_t::zeros(NPMATRIX_PRODUCT_DIM_TEST);
+
+    for (int k = 0; k < NPMATRIX_PRODUCT_ITERATIONS_TEST; ++k) {
+        _t0 = clock();
+        for (size_t i = 0; i < NPMATRIX_PRODUCT_DIM_TEST; ++i) {
+            for (size_t j = 0; j < NPMATRIX_PRODUCT_DIM_TEST; ++j) {
+                c(i, j) = a.row(i) | b.col(j);
+            }
+        }
+        _t1 = clock();
+        _elapsed_time += ((double_t) (_t1 - _t0) / (double_t) CLOCKS_PER_SEC) / NPMATRIX_PRODUCT_ITERATIONS_TEST;
+    }
+    cout << "* (MATRIX ROW/COL) AVG ELAPSED TIME : " << _elapsed_time << "s" << endl;
+    ASSERT_EQ(c, 2 * NPMATRIX_PRODUCT_DIM_TEST * mat_t::ones(NPMATRIX_PRODUCT_DIM_TEST));
+}
+
+TEST_F(NPMatrixBenchTest, MatrixProdScaling) {
+    mat_t a = mat_t::ones(NPMATRIX_SCALING_DIM_TEST), b = 2 * mat_t::ones(NPMATRIX_SCALING_DIM_TEST), c;
+    size_t max_workers = std::max((size_t) std::thread::hardware_concurrency(), (size_t) 1), workers = 1;
+    double_t serial_time = 0;
+
+    while (workers <= max_workers) {
+        NThreadPool::instance().setWorkers(workers);
+
+        auto t0 = std::chrono::steady_clock::now();
+        c = a * b;
+        auto t1 = std::chrono::steady_clock::now();
+
+        double_t elapsed_time = std::chrono::duration<double_t>(t1 - t0).count();
+        serial_time = (workers == 1) ? elapsed_time : serial_time;
+        cout << "* (MATRIX) " << workers << " WORKERS ELAPSED TIME : " << elapsed_time << "s"
+             << " SPEEDUP : " << serial_time / elapsed_time << endl;
+
+        workers = (workers == max_workers) ? max_workers + 1 : std::min(2 * workers, max_workers);
+    }
+    NThreadPool::instance().setWorkers(max_workers);
+}
+
+TEST_F(NPMatrixBenchTest, LUPDense) {
+    mat_t a{NPMATRIX_LUP_DIM_TEST, NPMATRIX_LUP_DIM_TEST};
+    for (size_t i = 0; i < NPMATRIX_LUP_DIM_TEST; ++i) {
+        for (size_t j = 0; j < NPMATRIX_LUP_DIM_TEST; ++j) {
+            a(i, j) = (double_t) ((7 * i + 3 * j) % 11) - 5 + ((i == j) ? NPMATRIX_LUP_DIM_TEST : 0);
+        }
+    }
+
+    auto t0 = std::chrono::steady_clock::now();
+    double_t det = a.det();
+    auto t1 = std::chrono::steady_clock::now();
+
+    cout << "DETERMINANT (DENSE) ELAPSED TIME : " << std::chrono::duration<double_t>(t1 - t0).count() << "s" << endl;
+    ASSERT_TRUE(det != 0);
+}
+
+TEST_F(NPMatrixBenchTest, CholeskyDense) {
+    mat_t a{NPMATRIX_LUP_DIM_TEST, NPMATRIX_LUP_DIM_TEST};
+    for (size_t i = 0; i < NPMATRIX_LUP_DIM_TEST; ++i) {
+        for (size_t j = 0; j < NPMATRIX_LUP_DIM_TEST; ++j) {
+            a(i, j) = (double_t) ((7 * (i + j)) % 11) - 5 + ((i == j) ? 6 * NPMATRIX_LUP_DIM_TEST : 0);
+        }
+    }
+    vec_t x_lu = vec_t::ones(NPMATRIX_LUP_DIM_TEST), x_llt{x_lu};
+
+    auto t0 = std::chrono::steady_clock::now();
+    NLU<double_t> lu{a};
+    auto t1 = std::chrono::steady_clock::now();
+    NCholesky<double_t> llt{a};
+    auto t2 = std::chrono::steady_clock::now();
+
+    cout << "FACTORIZATION (LU) ELAPSED TIME : " << std::chrono::duration<double_t>(t1 - t0).count() << "s" << endl;
+    cout << "FACTORIZATION (CHOLESKY) ELAPSED TIME : " << std::chrono::duration<double_t>(t2 - t1).count() << "s"
+         << endl;
+    ASSERT_NEAR((double) (lu.solve(x_lu) / llt.solve(x_llt)), 0, 1e-12);
+}
+
+TEST_F(NPMatrixBenchTest, BandSolve) {
+    const size_t n = 1000000;
+    band_t t = band_t::nscalar({-1, 4}, n), b = band_t::nscalar({1, -1, 6}, n);
+    vec_t x = vec_t::ones(n), u = t * x, v = b * x;
+
+    auto t0 = std::chrono::steady_clock::now();
+    t.solve(u);
+    auto t1 = std::chrono::steady_clock::now();
+    b.solve(v);
+    auto t2 = std::chrono::steady_clock::now();
+
+    cout << "SOLVE (TRIDIAGONAL) ELAPSED TIME : " << std::chrono::duration<double_t>(t1 - t0).count() << "s" << endl;
+    cout << "SOLVE (PENTADIAGONAL) ELAPSED TIME : " << std::chrono::duration<double_t>(t2 - t1).count() << "s" << endl;
+    ASSERT_NEAR((double) (u / x), 0, 1e-10);
+    ASSERT_NEAR((double) (v / x), 0, 1e-10);
+}
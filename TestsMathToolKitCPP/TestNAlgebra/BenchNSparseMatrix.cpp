@@ -0,0 +1,90 @@
+//
+// Created on 17/10/2026.
+//
+
+#include <gtest/gtest.h>
+#include <NSparseMatrix.h>
+#include <NKrylov.h>
+#include <chrono>
+
+#define NSPARSEMATRIX_LAPLACIAN_SIDE_TEST 3163
+#define NSPARSEMATRIX_ITERATIONS_TEST 10
+#define NSPARSEMATRIX_CG_ITERATIONS_TEST 100
+
+using namespace std;
+
+class NSparseMatrixBenchTest : public ::testing::Test {
+
+protected:
+    void SetUp() override {
+        const size_t m = NSPARSEMATRIX_LAPLACIAN_SIDE_TEST, n = m * m;
+        vector<size_t> rows(n + 1), cols;
+        vector<double_t, NAlignedAllocator<double_t>> values;
+
+        cols.reserve(5 * n);
+        values.reserve(5 * n);
+        for (size_t i = 0; i < n; ++i) {
+            rows[i] = values.size();
+            if (i >= m) {
+                cols.push_back(i - m);
+                values.push_back(-1);
+            }
+            if (i % m > 0) {
+                cols.push_back(i - 1);
+                values.push_back(-1);
+            }
+            cols.push_back(i);
+            values.push_back(4);
+            if (i % m + 1 < m) {
+                cols.push_back(i + 1);
+                values.push_back(-1);
+            }
+            if (i + m < n) {
+                cols.push_back(i + m);
+                values.push_back(-1);
+            }
+        }
+        rows[n] = values.size();
+        _a = sparse_t(n, n, std::move(rows), std::move(cols), std::move(values));
+    }
+
+    sparse_t _a;
+};
+
+TEST_F(NSparseMatrixBenchTest, Laplacian2D) {
+    const size_t n = _a.n();
+    vec_t x = vec_t::ones(n), y{x}, z{x};
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (size_t k = 0; k < NSPARSEMATRIX_ITERATIONS_TEST; ++k) {
+        _a.product(x, y);
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    for (size_t k = 0; k < NSPARSEMATRIX_ITERATIONS_TEST; ++k) {
+        _a.transProduct(x, z);
+    }
+    auto t2 = std::chrono::steady_clock::now();
+
+    cout << "UNKNOWNS : " << n << ", NON-ZEROS : " << _a.nnz() << endl;
+    cout << "SPMV AVG ELAPSED TIME : " << std::chrono::duration<double_t>(t1 - t0).count() /
+                                         NSPARSEMATRIX_ITERATIONS_TEST << "s" << endl;
+    cout << "TRANSPOSED SPMV AVG ELAPSED TIME : " << std::chrono::duration<double_t>(t2 - t1).count() /
+                                                    NSPARSEMATRIX_ITERATIONS_TEST << "s" << endl;
+    ASSERT_EQ(y, z);
+}
+
+TEST_F(NSparseMatrixBenchTest, ConjugateGradient) {
+    const size_t n = _a.n();
+    vec_t sol = vec_t::ones(n), b = _a * sol, x = vec_t::zeros(n);
+
+    auto t0 = std::chrono::steady_clock::now();
+    NKrylov<double_t> solver{0, NSPARSEMATRIX_CG_ITERATIONS_TEST};
+    solver.cg(_a, b, x);
+    size_t iter = solver.iterations();
+    auto t1 = std::chrono::steady_clock::now();
+
+    cout << "CG ITERATION AVG ELAPSED TIME : " << std::chrono::duration<double_t>(t1 - t0).count() / (double_t) iter
+         << "s" << endl;
+    ASSERT_EQ(iter, NSPARSEMATRIX_CG_ITERATIONS_TEST);
+    ASSERT_LT((double) !(x - sol), (double) !sol);
+}
@@ -3,10 +3,13 @@
 //
 
 #include <NVector.h>
+#include <chrono>
 #include <gtest/gtest.h>
 
 #define NVECTOR_SMALL_DIM_TEST 1000000
 #define NVECTOR_ITERATIONS_TEST 1000
+#define NVECTOR_BANDWIDTH_DIM_TEST 10000000
+#define NVECTOR_BANDWIDTH_ITERATIONS_TEST 50
 
 using namespace std;
 
@@ -40,6 +43,26 @@ protected:
         cout << op << " AVG ELAPSED TIME : " << _elapsed_time << "s" << endl;
     }
 
+    /**
+     * @brief Print the throughput of a kernel reading `vectors` arrays of `NVECTOR_BANDWIDTH_DIM_TEST` doubles.
+     */
+    void iterateTestBandwidth(const std::function<double_t(const vec_t &, const vec_t &)> &test, size_t vectors,
+                              std::string op = "") {
+        vec_t u = vec_t::scalar(3, NVECTOR_BANDWIDTH_DIM_TEST), v = vec_t::scalar(6, NVECTOR_BANDWIDTH_DIM_TEST);
+        double_t sink = 0;
+
+        auto t0 = chrono::steady_clock::now();
+        for (int k = 0; k < NVECTOR_BANDWIDTH_ITERATIONS_TEST; ++k) {
+            sink += test(u, v);
+        }
+        chrono::duration<double_t> elapsed = chrono::steady_clock::now() - t0;
+
+        double_t bytes = (double_t) vectors * NVECTOR_BANDWIDTH_DIM_TEST * sizeof(double_t);
+        double_t time = elapsed.count() / NVECTOR_BANDWIDTH_ITERATIONS_TEST;
+        cout << op << " AVG ELAPSED TIME : " << time << "s " << bytes / time / 1e9 << " GB/s" << endl;
+        ASSERT_GT(sink, 0);
+    }
+
     clock_t _t0;
     clock_t _t1;
     double_t _elapsed_time;
@@ -58,7 +81,7 @@ TEST_F(NVectorBenchTest, Sub) {
 }
 
 TEST_F(NVectorBenchTest, Prod) {
-    iterateTestScalar([](vec_t &u, double_t s) { u /= s; }, "*");
+    iterateTestScalar([](vec_t &u, double_t s) { u *= s; }, "*");
 }
 
 TEST_F(NVectorBenchTest, Div) {
@@ -67,4 +90,28 @@ TEST_F(NVectorBenchTest, Div) {
 
 TEST_F(NVectorBenchTest, DotProduct) {
     iterateTestVector([](vec_t &u, const vec_t &v) { u | v; }, "|");
-}
\ No newline at end of file
+}
+
+TEST_F(NVectorBenchTest, LinearCombination) {
+    vec_t w{_u};
+    iterateTestVector([&w](vec_t &u, const vec_t &v) { w = 0.5 * u + 0.25 * v - w / 2.0; }, "a * u + b * v - w / c");
+}
+
+TEST_F(NVectorBenchTest, BandwidthCopy) {
+    iterateTestBandwidth([](const vec_t &u, const vec_t &v) {
+        vec_t w{u};
+        return w(0) + v(0);
+    }, 2, "copy");
+}
+
+TEST_F(NVectorBenchTest, BandwidthDotProduct) {
+    iterateTestBandwidth([](const vec_t &u, const vec_t &v) { return u | v; }, 2, "|");
+}
+
+TEST_F(NVectorBenchTest, BandwidthNorm) {
+    iterateTestBandwidth([](const vec_t &u, const vec_t &) { return !u; }, 1, "!");
+}
+
+TEST_F(NVectorBenchTest, BandwidthDistance) {
+    iterateTestBandwidth([](const vec_t &u, const vec_t &v) { return u / v; }, 2, "/");
+}
@@ -0,0 +1,150 @@
+//
+// Created on 17/10/2026.
+//
+
+#include <NArena.h>
+#include <NPMatrix.h>
+#include <gtest/gtest.h>
+
+class NArenaTest : public ::testing::Test {
+
+protected:
+    void SetUp() override {
+        _workers = NThreadPool::instance().workers();
+        NThreadPool::instance().setWorkers(1);
+    }
+
+    void TearDown() override {
+        NThreadPool::instance().setWorkers(_workers);
+    }
+
+    size_t _workers{};
+};
+
+TEST_F(NArenaTest, Scope) {
+    NArena &arena = NArena::local();
+    ASSERT_EQ(arena.used(), 0);
+
+    {
+        NArenaScope scope;
+        std::vector<double_t, NArenaAllocator<double_t>> u(10, 1.0);
+        ASSERT_EQ((size_t) u.data() % NALIGNED_ALLOCATOR_ALIGNMENT, 0);
+
+        size_t used = arena.used();
+        {
+            NArenaScope inner_scope;
+            std::vector<char, NArenaAllocator<char>> v(3);
+            std::vector<double_t, NArenaAllocator<double_t>> w(3);
+            ASSERT_EQ((size_t) w.data() % NALIGNED_ALLOCATOR_ALIGNMENT, 0);
+            ASSERT_GT(arena.used(), used);
+        }
+        ASSERT_EQ(arena.used(), used);
+        ASSERT_EQ(u, (std::vector<double_t, NArenaAllocator<double_t>>(10, 1.0)));
+    }
+    ASSERT_EQ(arena.used(), 0);
+
+    size_t heap_allocations = arena.heapAllocations(), capacity = arena.capacity();
+    {
+        NArenaScope scope;
+        std::vector<char, NArenaAllocator<char>> u(capacity + 1);
+        ASSERT_EQ(arena.heapAllocations(), heap_allocations + 1);
+    }
+    ASSERT_GT(arena.capacity(), capacity);
+    ASSERT_EQ(arena.used(), 0);
+
+    heap_allocations = arena.heapAllocations();
+    {
+        NArenaScope scope;
+        std::vector<char, NArenaAllocator<char>> u(capacity + 1);
+    }
+    ASSERT_EQ(arena.heapAllocations(), heap_allocations);
+}
+
+TEST_F(NArenaTest, NestedGrowth) {
+    NArena &arena = NArena::local();
+    ASSERT_EQ(arena.depth(), 0);
+
+    NArenaScope scope;
+    std::vector<double_t, NArenaAllocator<double_t>> u(4, 1.0);
+    {
+        NArenaScope inner_scope;
+        ASSERT_EQ(arena.depth(), 2);
+#ifndef NDEBUG
+        ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+        ASSERT_DEATH(u.resize(1024), "");
+#endif
+    }
+    u.resize(1024, 2.0);
+    ASSERT_EQ(u[3], 1.0);
+    ASSERT_EQ(u[1023], 2.0);
+}
+
+TEST_F(NArenaTest, Capacity) {
+    NArena &arena = NArena::local();
+
+    size_t heap_allocations = arena.heapAllocations();
+    {
+        NArenaScope scope;
+        std::vector<char, NArenaAllocator<char>> u(2 * NARENA_MAX_CAPACITY);
+        ASSERT_EQ(arena.heapAllocations(), heap_allocations + 1);
+    }
+    ASSERT_EQ(arena.capacity(), NARENA_MAX_CAPACITY);
+    ASSERT_EQ(arena.used(), 0);
+
+    heap_allocations = arena.heapAllocations();
+    {
+        NArenaScope scope;
+        std::vector<char, NArenaAllocator<char>> u(2 * NARENA_MAX_CAPACITY);
+        ASSERT_EQ(arena.heapAllocations(), heap_allocations + 1);
+    }
+    ASSERT_EQ(arena.capacity(), NARENA_MAX_CAPACITY);
+
+    {
+        NArenaScope scope;
+        arena.trim();
+        ASSERT_EQ(arena.capacity(), NARENA_MAX_CAPACITY);
+    }
+    arena.trim();
+    ASSERT_EQ(arena.capacity(), NARENA_INITIAL_CAPACITY);
+    ASSERT_EQ(arena.peak(), 0);
+
+    {
+        NArenaScope scope;
+        std::vector<char, NArenaAllocator<char>> u(NARENA_INITIAL_CAPACITY / 2);
+    }
+    ASSERT_EQ(arena.capacity(), NARENA_INITIAL_CAPACITY);
+}
+
+TEST_F(NArenaTest, SteadyState) {
+    NArena &arena = NArena::local();
+    const size_t n = 70;
+
+    mat_t m = mat_t::nscalar({1, 0.5}, n), b = mat_t::eye(n), expect_pow = m * m * m;
+    vec_t u = vec_t::ones(n);
+
+    auto iteration = [&]() {
+        m *= b;
+        u *= m;
+        u /= !u;
+        m ^= 3;
+        m = expect_pow(0, 0, n / 2, n / 2);
+        m = expect_pow;
+        m.swapRow(0, 1);
+        m.swapRow(0, 1);
+    };
+
+    iteration();
+    ASSERT_EQ(m, expect_pow);
+
+    size_t heap_allocations = arena.heapAllocations(), allocations = arena.allocations();
+    const double_t *data = m.data();
+    for (int k = 0; k < 10; ++k) {
+        iteration();
+    }
+
+    ASSERT_EQ(arena.heapAllocations(), heap_allocations);
+    ASSERT_GT(arena.allocations(), allocations);
+    ASSERT_EQ(arena.used(), 0);
+    ASSERT_EQ(m.data(), data);
+    ASSERT_EQ(m, expect_pow);
+}
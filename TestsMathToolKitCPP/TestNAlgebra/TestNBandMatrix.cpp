@@ -0,0 +1,84 @@
+//
+// Created on 17/10/2026.
+//
+
+#include <NPMatrix.h>
+#include <NBandMatrix.h>
+#include <gtest/gtest.h>
+
+class NBandMatrixTest : public ::testing::Test {
+
+protected:
+    void SetUp() override {
+
+        _a = {{4, 1, 0, 0},
+              {2, 5, 1, 0},
+              {1, 3, 6, 2},
+              {0, 1, 2, 7}};
+
+        _t = {{2,  -1, 0,  0},
+              {-1, 2,  -1, 0},
+              {0,  -1, 2,  -1},
+              {0,  0,  -1, 2}};
+    }
+
+    mat_t _a, _t;
+};
+
+TEST_F(NBandMatrixTest, Conversion) {
+    band_t a{_a}, t{_t}, a_wide{_a, 3, 3};
+
+    ASSERT_EQ(a.kl(), 2);
+    ASSERT_EQ(a.ku(), 1);
+    ASSERT_EQ(t.kl(), 1);
+    ASSERT_EQ(t.ku(), 1);
+    ASSERT_EQ(a.dense(), _a);
+    ASSERT_EQ(a_wide.dense(), _a);
+    ASSERT_EQ(a, a_wide);
+    ASSERT_NE(a, t);
+
+    ASSERT_DOUBLE_EQ(a(2, 0), 1);
+    ASSERT_DOUBLE_EQ(((const band_t &) a)(0, 3), 0);
+    ASSERT_EQ(band_t(_a, 0, 0).dense(), mat_t::ndiag({vec_t{4, 5, 6, 7}}));
+
+    ASSERT_EQ(band_t::nscalar({-1, 2}, 4), t);
+    ASSERT_EQ(band_t::nscalar({-1, 2}, 4).dense(), mat_t::nscalar({-1, 2}, 4));
+    ASSERT_EQ(band_t::nscalar({1, 2, 3}, 5).dense(), mat_t::nscalar({1, 2, 3}, 5));
+    ASSERT_EQ(band_t::ndiag({{1, 2}, {3, 4, 5}, {6, 7}}).dense(), mat_t::ndiag({{1, 2}, {3, 4, 5}, {6, 7}}));
+    ASSERT_EQ(a.str(), _a.str());
+}
+
+TEST_F(NBandMatrixTest, Algebra) {
+    band_t a{_a}, t{_t};
+    vec_t u{1, 2, 3, 4}, v{u}, w{u};
+
+    ASSERT_EQ(a * u, _a * u);
+    ASSERT_EQ(t * u, _t * u);
+
+    ASSERT_NEAR((double) (a.solve(v) / (_a % u)), 0, 1e-14);
+    ASSERT_NEAR((double) (t.solve(w) / (_t % u)), 0, 1e-14);
+    ASSERT_NEAR((double) ((a % u) / (_a % u)), 0, 1e-14);
+
+    ASSERT_NEAR((double) a.det(), (double) _a.det(), 1e-12);
+    ASSERT_NEAR((double) t.det(), 5, 1e-12);
+
+    band_t p = band_t::nscalar({1, 0}, 3);
+    ASSERT_NEAR((double) p.det(), 0, 1e-12);
+    ASSERT_NEAR((double) band_t::nscalar({1, 1, 0}, 3).det(), (double) mat_t::nscalar({1, 1, 0}, 3).det(), 1e-12);
+
+    band_t s{mat_t{{1, 2, 0}, {2, 4, 0}, {0, 0, 1}}};
+    vec_t x{1, 2, 3}, expect_x{x}, y{1, 2}, expect_y{y};
+    ASSERT_EQ(s.solve(x), expect_x);
+    ASSERT_EQ(band_t::nscalar({1, 1}, 2).solve(y), expect_y);
+    ASSERT_DOUBLE_EQ((double) s.det(), 0);
+}
+
+TEST_F(NBandMatrixTest, Large) {
+    const size_t n = 100000;
+    band_t t = band_t::nscalar({-1, 4}, n), b = band_t::nscalar({1, -1, 6}, n);
+    vec_t x = vec_t::ones(n), y = vec_t::zeros(n), u = t * x, v = b * x;
+
+    ASSERT_NEAR((double) (t.solve(u) / x), 0, 1e-10);
+    ASSERT_NEAR((double) (t.product(x, y) / (t * x)), 0, 1e-14);
+    ASSERT_NEAR((double) (b.solve(v) / x), 0, 1e-10);
+}
@@ -0,0 +1,146 @@
+//
+// Created on 17/10/2026.
+//
+
+#include <NPMatrix.h>
+#include <NBatchMatrix.h>
+#include <gtest/gtest.h>
+
+class NBatchMatrixTest : public ::testing::Test {
+
+protected:
+    static mat_t matrix(size_t n, size_t p, size_t k) {
+        mat_t m(n, p);
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = 0; j < p; ++j) {
+                m(i, j) = sin((double_t) (7 * k + 3 * i * p + j)) + ((i == j) ? (double_t) (k % 3 + 1) : 0);
+            }
+        }
+        return m;
+    }
+
+    static std::vector<mat_t> matrices(size_t count, size_t n, size_t p) {
+        std::vector<mat_t> matrices;
+        for (size_t k = 0; k < count; ++k) {
+            matrices.push_back(matrix(n, p, k));
+        }
+        return matrices;
+    }
+
+    static void assertNear(const mat_t &a, const mat_t &b, double_t tol) {
+        ASSERT_EQ(a.n(), b.n());
+        ASSERT_EQ(a.p(), b.p());
+        for (size_t i = 0; i < a.n(); ++i) {
+            for (size_t j = 0; j < a.p(); ++j) {
+                ASSERT_NEAR(a(i, j), b(i, j), tol);
+            }
+        }
+    }
+};
+
+TEST_F(NBatchMatrixTest, Layout) {
+    std::vector<mat_t> m = matrices(11, 3, 4);
+    batch_t batch{m}, square{3, 2, 2};
+
+    ASSERT_EQ(batch.count(), 11);
+    ASSERT_EQ(batch.n(), 3);
+    ASSERT_EQ(batch.p(), 4);
+    ASSERT_EQ(batch.groups(), 2);
+    for (size_t k = 0; k < m.size(); ++k) {
+        ASSERT_EQ(batch.matrix(k), m[k]);
+        ASSERT_DOUBLE_EQ(batch(k, 2, 1), m[k](2, 1));
+    }
+    ASSERT_DOUBLE_EQ(batch.data()[(4 * 1 + 2) * NBATCHMATRIX_LANES + 5], m[5](1, 2));
+    ASSERT_DOUBLE_EQ(batch.data()[(12 + 0) * NBATCHMATRIX_LANES + 2], m[NBATCHMATRIX_LANES + 2](0, 0));
+
+    ASSERT_EQ(square.matrix(2), mat_t::zeros(2, 2));
+    ASSERT_DOUBLE_EQ(square.data()[3 * NBATCHMATRIX_LANES + 3], 1);
+    square.setMatrix(1, mat_t::eye(2));
+    ASSERT_EQ(square.matrix(1), mat_t::eye(2));
+    ASSERT_EQ(square.str(), mat_t::zeros(2, 2).str() + "\n" + mat_t::eye(2).str() + "\n" +
+                            mat_t::zeros(2, 2).str() + "\n");
+}
+
+TEST_F(NBatchMatrixTest, Det) {
+    for (size_t n : {1, 3, 5, 16}) {
+        std::vector<mat_t> m = matrices(21, n, n);
+        m[4] = mat_t::zeros(n, n);
+        batch_t batch{m};
+        vec_t dets;
+
+        batch.detBatched(dets);
+        ASSERT_EQ(dets.dim(), m.size());
+        for (size_t k = 0; k < m.size(); ++k) {
+            ASSERT_NEAR(dets(k), m[k].det(), 1e-10 * std::max(1.0, std::abs(dets(k))));
+        }
+        ASSERT_DOUBLE_EQ(dets(4), 0);
+    }
+}
+
+TEST_F(NBatchMatrixTest, Solve) {
+    for (size_t n : {1, 3, 5, 16}) {
+        std::vector<mat_t> m = matrices(21, n, n), b = matrices(21, n, 2);
+        m[9] = mat_t::zeros(n, n);
+        batch_t batch{m}, x{b};
+
+        ASSERT_FALSE(batch.solveBatched(x));
+        for (size_t k = 0; k < m.size(); ++k) {
+            assertNear(k == 9 ? b[k] : m[k] % b[k], x.matrix(k), 1e-10);
+        }
+
+        m[9] = mat_t::eye(n);
+        batch.setMatrix(9, m[9]);
+        x = batch_t{b};
+        ASSERT_TRUE(batch.solveBatched(x));
+        for (size_t k = 0; k < m.size(); ++k) {
+            assertNear(m[k] * x.matrix(k), b[k], 1e-10);
+        }
+    }
+}
+
+TEST_F(NBatchMatrixTest, Inv) {
+    for (size_t n : {2, 4, 16}) {
+        std::vector<mat_t> m = matrices(13, n, n);
+        batch_t batch{m}, inv;
+
+        ASSERT_TRUE(batch.invBatched(inv));
+        ASSERT_EQ(inv.count(), m.size());
+        ASSERT_EQ(inv.p(), n);
+        for (size_t k = 0; k < m.size(); ++k) {
+            assertNear(inv.matrix(k), (m[k] ^ -1), 1e-10);
+        }
+
+        m[0] = mat_t::zeros(n, n);
+        batch.setMatrix(0, m[0]);
+        ASSERT_FALSE(batch.invBatched(inv));
+        assertNear(inv.matrix(1), (m[1] ^ -1), 1e-10);
+    }
+}
+
+TEST_F(NBatchMatrixTest, Gemm) {
+    std::vector<mat_t> a = matrices(19, 3, 4), b = matrices(19, 4, 5);
+    batch_t c = batch_t{a} * batch_t{b};
+
+    ASSERT_EQ(c.count(), 19);
+    ASSERT_EQ(c.n(), 3);
+    ASSERT_EQ(c.p(), 5);
+    for (size_t k = 0; k < a.size(); ++k) {
+        assertNear(c.matrix(k), a[k] * b[k], 1e-12);
+    }
+}
+
+TEST_F(NBatchMatrixTest, LargeBatch) {
+    const size_t count = 30001;
+    batch_t a{count, 3, 3}, b{count, 3, 1};
+    for (size_t k = 0; k < count; ++k) {
+        a.setMatrix(k, matrix(3, 3, k % 97) + mat_t::eye(3) * 4);
+        b.setMatrix(k, matrix(3, 1, k));
+    }
+    batch_t x{b};
+
+    ASSERT_TRUE(a.solveBatched(x));
+    batch_t ax = a * x;
+    for (size_t k = 0; k < count; k += 101) {
+        assertNear(ax.matrix(k), b.matrix(k), 1e-12);
+    }
+}
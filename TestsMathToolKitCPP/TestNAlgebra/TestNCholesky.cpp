@@ -0,0 +1,118 @@
+//
+// Created on 17/10/2026.
+//
+
+#include <NPMatrix.h>
+#include <NLU.h>
+#include <NCholesky.h>
+#include <gtest/gtest.h>
+
+class NCholeskyTest : public ::testing::Test {
+
+protected:
+    void SetUp() override {
+
+        _b = {{2,  -1, 0},
+              {-1, 2,  -1},
+              {0,  -1, 2}};
+
+        _s = {{1, 2},
+              {2, 1}};
+    }
+
+    mat_t _b, _s;
+
+    const mat_t _b_inv{{0.75, 0.50, 0.25},
+                       {0.50, 1.00, 0.50},
+                       {0.25, 0.50, 0.75}};
+};
+
+TEST_F(NCholeskyTest, Factors) {
+    NCholesky<double_t> llt{_b};
+    mat_t l = llt.L(), l_trans{l}, opp_b{-_b};
+    mat_t expect_low{{sqrt(2.0),       0,                0},
+                     {-sqrt(0.5),      sqrt(1.5),        0},
+                     {0,               -sqrt(2.0 / 3.0), sqrt(4.0 / 3.0)}};
+
+    ASSERT_EQ(llt.n(), 3);
+    ASSERT_TRUE(llt.isPositiveDefinite());
+    ASSERT_NEAR((double) (l / expect_low), 0, 5e-16);
+    ASSERT_NEAR((double) (l * l_trans.trans() / _b), 0, 5e-15);
+
+    ASSERT_FALSE(NCholesky<double_t>(_s).isPositiveDefinite());
+    ASSERT_FALSE(NCholesky<double_t>(opp_b).isPositiveDefinite());
+}
+
+TEST_F(NCholeskyTest, Algebra) {
+    NCholesky<double_t> llt{_b};
+    vec_t u{1, 2, 5}, expect_sol{3, 5, 5};
+    mat_t b{{1, 1},
+            {2, 0},
+            {5, 1}};
+    mat_t expect_sol_mat{{3, 1},
+                         {5, 1},
+                         {5, 1}};
+
+    ASSERT_DOUBLE_EQ((double) llt.det(), 4);
+    ASSERT_NEAR((double) (llt.solve(u) / expect_sol), 0, 5e-15);
+    ASSERT_NEAR((double) (llt.solve(b) / expect_sol_mat), 0, 5e-15);
+    ASSERT_NEAR((double) (llt.inv() / _b_inv), 0, 1e-15);
+
+    vec_t v{1, 2}, expect_v{v};
+    ASSERT_EQ(NCholesky<double_t>(_s).solve(v), expect_v);
+    ASSERT_DOUBLE_EQ((double) NCholesky<double_t>(_s).det(), 0);
+}
+
+TEST_F(NCholeskyTest, Blocked) {
+    const size_t n = 150;
+    mat_t a = mat_t::nscalar({-1, 2}, n), b{n, n};
+
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            b(i, j) = (double_t) ((7 * i + 3 * j) % 11) - 5;
+        }
+    }
+    mat_t b_trans{b}, s = b_trans.trans() * b + mat_t::eye(n);
+    NCholesky<double_t> llt_a{a}, llt_s{s};
+
+    ASSERT_TRUE(llt_s.isPositiveDefinite());
+    ASSERT_NEAR((double) llt_a.det(), n + 1, 1e-9);
+
+    mat_t l = llt_s.L(), l_trans{l};
+    ASSERT_NEAR((double) (l * l_trans.trans() / s), 0, 1e-9);
+
+    mat_t x = mat_t::nscalar({1, 0.5}, n)(0, 0, n - 1, 69), rhs = s * x;
+    ASSERT_NEAR((double) (llt_s.solve(rhs) / x), 0, 1e-9);
+    ASSERT_NEAR((double) (s * llt_s.inv() / mat_t::eye(n)), 0, 1e-9);
+
+    vec_t u = vec_t::ones(n), v{u};
+    ASSERT_NEAR((double) (s * llt_s.solve(v) / u), 0, 1e-9);
+}
+
+TEST_F(NCholeskyTest, MatrixOptIn) {
+    const size_t n = 16;
+    mat_t a = mat_t::nscalar({-1, 2}, n), c, s = mat_t::nscalar({1, 3, 1}, n);
+    vec_t u = vec_t::ones(n);
+
+    ASSERT_TRUE(_b.isSymmetric());
+    ASSERT_FALSE(mat_t({{1, 2}, {3, 4}}).isSymmetric());
+
+    ASSERT_NEAR((double) a.det(), n + 1, 1e-12);
+    ASSERT_TRUE(a.llt().isPositiveDefinite());
+    ASSERT_EQ(&a.llt().factors(), &a.llt().factors());
+    ASSERT_NEAR((double) a.det(), n + 1, 1e-12);
+
+    c = a;
+    ASSERT_EQ(&c.llt().factors(), &a.llt().factors());
+    ASSERT_NEAR((double) (a * (a ^ -1) / mat_t::eye(n)), 0, 1e-12);
+    ASSERT_NEAR((double) (a * (a % u) / u), 0, 1e-12);
+
+    ASSERT_FALSE(s.llt().isPositiveDefinite());
+    ASSERT_NE(&s.llt().factors(), &s.llt().factors());
+    ASSERT_NEAR((double) s.det(), (double) s.lu().det(), 1e-9);
+    ASSERT_NEAR((double) (s * (s % u) / u), 0, 1e-12);
+
+    ASSERT_EQ(&_b.llt().factors(), &_b.llt().factors());
+    ASSERT_DOUBLE_EQ((double) _b.det(), 4);
+    ASSERT_NE(&_b(0, 0, 1, 1).llt().factors(), &_b.llt().factors());
+}
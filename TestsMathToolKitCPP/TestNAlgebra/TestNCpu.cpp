@@ -0,0 +1,190 @@
+//
+// Created on 17/10/2026.
+//
+
+#include <NPMatrix.h>
+#include <NCpu.h>
+#include <gtest/gtest.h>
+
+class NCpuTest : public ::testing::Test {
+
+protected:
+    void SetUp() override {
+        _level = NCpu::instance().level();
+    }
+
+    void TearDown() override {
+        NCpu::instance().setLevel(_level);
+    }
+
+    std::vector<NCpu::Level> levels() const {
+        std::vector<NCpu::Level> levels;
+        for (NCpu::Level level : {NCpu::Scalar, NCpu::SSE2, NCpu::AVX2, NCpu::AVX512}) {
+            if (level <= NCpu::instance().maxLevel()) {
+                levels.push_back(level);
+            }
+        }
+        return levels;
+    }
+
+    NCpu::Level _level{};
+};
+
+TEST_F(NCpuTest, Level) {
+    NCpu &cpu = NCpu::instance();
+    NCpu::Level level{};
+
+    ASSERT_LE(cpu.level(), cpu.maxLevel());
+
+    cpu.setLevel(NCpu::Scalar);
+    ASSERT_EQ(cpu.level(), NCpu::Scalar);
+
+    cpu.setLevel(NCpu::AVX512);
+    ASSERT_EQ(cpu.level(), cpu.maxLevel());
+
+    ASSERT_TRUE(NCpu::parseLevel("avx2", level));
+    ASSERT_EQ(level, NCpu::AVX2);
+    ASSERT_EQ(NCpu::levelName(NCpu::SSE2), "sse2");
+    ASSERT_FALSE(NCpu::parseLevel("AVX2", level));
+    ASSERT_EQ(level, NCpu::AVX2);
+}
+
+TEST_F(NCpuTest, DoubleKernels) {
+    for (NCpu::Level level : levels()) {
+        NCpu::instance().setLevel(level);
+
+        for (size_t n = 0; n < 70; n += 3) {
+            std::vector<double_t> x(n), y(n), z(n);
+            double_t expect_dot = 0, expect_dist = 0;
+            for (size_t k = 0; k < n; ++k) {
+                x[k] = (double_t) k / 8 - 2;
+                y[k] = 3 - (double_t) (k % 7);
+                z[k] = y[k] + 0.5 * x[k];
+                expect_dot += x[k] * y[k];
+                expect_dist += (x[k] - y[k]) * (x[k] - y[k]);
+            }
+
+            ASSERT_NEAR(NBlas<double_t>::dot(n, x.data(), y.data()), expect_dot, 1e-12);
+            ASSERT_NEAR(NBlas<double_t>::dist2(n, x.data(), y.data()), expect_dist, 1e-12);
+
+            NBlas<double_t>::axpy(n, 0.5, x.data(), y.data());
+            ASSERT_EQ(y, z);
+        }
+
+        mat_t a = mat_t::nscalar({-1, 2}, 13), b = mat_t::ones(13, 11), expect_prod = mat_t::zeros(13, 11);
+        expect_prod.setRow(vec_t::ones(11), 0).setRow(vec_t::ones(11), 12);
+        ASSERT_EQ(a * b, expect_prod);
+    }
+}
+
+TEST_F(NCpuTest, MatrixVectorKernels) {
+    const size_t lda = 41;
+    std::vector<double_t> a(13 * lda), x(lda), y(lda);
+    for (size_t k = 0; k < a.size(); ++k) {
+        a[k] = (double_t) (k % 11) - 4;
+    }
+    for (size_t k = 0; k < x.size(); ++k) {
+        x[k] = (double_t) k / 4 - 3;
+    }
+
+    for (NCpu::Level level : levels()) {
+        NCpu::instance().setLevel(level);
+
+        for (size_t n : {0, 1, 3, 4, 5, 8, 13}) {
+            for (size_t p : {0, 1, 2, 5, 8, 9, 17, 40}) {
+                NBlas<double_t>::gemv(n, p, a.data(), lda, x.data(), y.data());
+                for (size_t i = 0; i < n; ++i) {
+                    double_t expect = 0;
+                    for (size_t j = 0; j < p; ++j) {
+                        expect += a[i * lda + j] * x[j];
+                    }
+                    ASSERT_NEAR(y[i], expect, 1e-12);
+                }
+
+                NBlas<double_t>::gemvT(n, p, a.data(), lda, x.data(), y.data());
+                for (size_t j = 0; j < p; ++j) {
+                    double_t expect = 0;
+                    for (size_t i = 0; i < n; ++i) {
+                        expect += a[i * lda + j] * x[i];
+                    }
+                    ASSERT_NEAR(y[j], expect, 1e-12);
+                }
+            }
+        }
+    }
+}
+
+TEST_F(NCpuTest, TransposeKernels) {
+    const size_t lda = 83, ldb = 79;
+    std::vector<double_t> a(75 * lda), b(lda * ldb);
+    for (size_t k = 0; k < a.size(); ++k) {
+        a[k] = (double_t) k;
+    }
+
+    for (NCpu::Level level : levels()) {
+        NCpu::instance().setLevel(level);
+
+        for (size_t n : {0, 1, 3, 8, 17, 33, 75}) {
+            for (size_t p : {1, 2, 8, 12, 41, 70}) {
+                NBlas<double_t>::transpose(n, p, a.data(), lda, b.data(), ldb);
+                for (size_t i = 0; i < n; ++i) {
+                    for (size_t j = 0; j < p; ++j) {
+                        ASSERT_EQ(b[j * ldb + i], a[i * lda + j]);
+                    }
+                }
+
+                std::vector<double_t> c(a.begin(), a.begin() + (std::ptrdiff_t) (n * p));
+                NBlas<double_t>::transpose(n, p, c.data());
+                for (size_t k = 0; k < n * p; ++k) {
+                    ASSERT_EQ(c[(k % p) * n + k / p], a[k]);
+                }
+            }
+
+            std::vector<double_t> square(a);
+            NBlas<double_t>::transpose(n, square.data() + 2, lda);
+            for (size_t i = 0; i < n; ++i) {
+                for (size_t j = 0; j < n; ++j) {
+                    ASSERT_EQ(square[j * lda + i + 2], a[i * lda + j + 2]);
+                }
+                ASSERT_EQ(square[i * lda + n + 2], a[i * lda + n + 2]);
+            }
+        }
+    }
+}
+
+TEST_F(NCpuTest, GaloisKernels) {
+    mat_aes_t a(5, 70), b(70, 67);
+    for (size_t i = 0; i < a.n(); ++i) {
+        for (size_t j = 0; j < a.p(); ++j) {
+            a(i, j) = AESByte((int) (7 * i + 3 * j));
+        }
+    }
+    for (size_t i = 0; i < b.n(); ++i) {
+        for (size_t j = 0; j < b.p(); ++j) {
+            b(i, j) = AESByte((int) (i * j + 1));
+        }
+    }
+
+    mat_aes_t expect_prod(5, 67);
+    for (size_t i = 0; i < a.n(); ++i) {
+        for (size_t j = 0; j < b.p(); ++j) {
+            AESByte c;
+            for (size_t k = 0; k < a.p(); ++k) {
+                c += a(i, k) * b(k, j);
+            }
+            expect_prod(i, j) = c;
+        }
+    }
+
+    ASSERT_EQ(AESByte(0x57) * AESByte(0x83), AESByte(0xc1));
+    for (NCpu::Level level : levels()) {
+        NCpu::instance().setLevel(level);
+
+        mat_aes_t prod = a * b;
+        for (size_t i = 0; i < prod.n(); ++i) {
+            for (size_t j = 0; j < prod.p(); ++j) {
+                ASSERT_EQ(prod(i, j), expect_prod(i, j));
+            }
+        }
+    }
+}
@@ -0,0 +1,171 @@
+//
+// Created on 17/10/2026.
+//
+
+#include <NPMatrix.h>
+#include <NEigen.h>
+#include <gtest/gtest.h>
+
+typedef NEigen<double_t> eigen_t;
+
+class NEigenTest : public ::testing::Test {
+
+protected:
+    void SetUp() override {
+        _sym = mat_t::zeros(150, 150);
+        for (size_t i = 0; i < _sym.n(); ++i) {
+            for (size_t j = 0; j <= i; ++j) {
+                _sym(i, j) = _sym(j, i) = sin((double_t) (i * _sym.p() + j));
+            }
+        }
+
+        _repeated = mat_t::eye(100);
+        for (size_t i = 0; i < _repeated.n(); ++i) {
+            for (size_t j = 0; j < _repeated.p(); ++j) {
+                _repeated(i, j) += 1;
+            }
+        }
+    }
+
+    /**
+     * Check A V = V L and V^T V = I.
+     */
+    static void assertDecomposition(const mat_t &a, const eigen_t &eigen, double_t tol) {
+        const mat_t &v = eigen.vectors();
+        mat_t av = a * v;
+        ASSERT_EQ(v.n(), a.n());
+        ASSERT_EQ(v.p(), eigen.k());
+
+        for (size_t i = 0; i < v.n(); ++i) {
+            for (size_t c = 0; c < v.p(); ++c) {
+                ASSERT_NEAR(av(i, c), eigen.values()(c) * v(i, c), tol);
+            }
+        }
+        for (size_t c1 = 0; c1 < v.p(); ++c1) {
+            for (size_t c2 = 0; c2 < v.p(); ++c2) {
+                double_t dot = 0;
+                for (size_t i = 0; i < v.n(); ++i) {
+                    dot += v(i, c1) * v(i, c2);
+                }
+                ASSERT_NEAR(dot, (c1 == c2) ? 1 : 0, tol);
+            }
+        }
+    }
+
+    mat_t _sym, _repeated;
+};
+
+TEST_F(NEigenTest, Small) {
+    mat_t a{{2, 1},
+            {1, 2}};
+    eigen_t eigen{a};
+
+    ASSERT_TRUE(eigen.isConverged());
+    ASSERT_EQ(eigen.n(), 2);
+    ASSERT_EQ(eigen.k(), 2);
+    ASSERT_NEAR(eigen.values()(0), 1, 1e-15);
+    ASSERT_NEAR(eigen.values()(1), 3, 1e-15);
+    assertDecomposition(a, eigen, 1e-15);
+
+    mat_t one{{-4}};
+    eigen_t scalar{one};
+    ASSERT_DOUBLE_EQ(scalar.values()(0), -4);
+    ASSERT_DOUBLE_EQ(std::abs(scalar.vectors()(0, 0)), 1);
+}
+
+TEST_F(NEigenTest, Spectrum) {
+    eigen_t eigen{_sym}, values{_sym, false};
+
+    ASSERT_TRUE(eigen.isConverged());
+    for (size_t i = 1; i < eigen.k(); ++i) {
+        ASSERT_LE(eigen.values()(i - 1), eigen.values()(i));
+    }
+    assertDecomposition(_sym, eigen, 1e-12);
+
+    double_t trace = 0;
+    for (size_t i = 0; i < eigen.k(); ++i) {
+        trace += eigen.values()(i);
+        ASSERT_NEAR(values.values()(i), eigen.values()(i), 1e-12);
+    }
+    ASSERT_NEAR(trace, _sym.trace(), 1e-11);
+    ASSERT_EQ(values.vectors().n(), 0);
+}
+
+TEST_F(NEigenTest, Deflation) {
+    eigen_t eigen{_repeated};
+
+    ASSERT_TRUE(eigen.isConverged());
+    for (size_t i = 0; i + 1 < eigen.k(); ++i) {
+        ASSERT_NEAR(eigen.values()(i), 1, 1e-12);
+    }
+    ASSERT_NEAR(eigen.values()(eigen.k() - 1), 101, 1e-12);
+    assertDecomposition(_repeated, eigen, 1e-12);
+
+    mat_t diagonal = mat_t::zeros(70, 70);
+    for (size_t i = 0; i < diagonal.n(); ++i) {
+        diagonal(i, i) = (double_t) ((i * 37) % 70);
+    }
+    eigen_t diagonal_eigen{diagonal};
+    for (size_t i = 0; i < diagonal.n(); ++i) {
+        ASSERT_DOUBLE_EQ(diagonal_eigen.values()(i), (double_t) i);
+    }
+    assertDecomposition(diagonal, diagonal_eigen, 1e-15);
+}
+
+TEST_F(NEigenTest, Selection) {
+    eigen_t eigen{_sym}, smallest{_sym, 5, eigen_t::Smallest}, largest{_sym, 7, eigen_t::Largest};
+
+    ASSERT_EQ(smallest.k(), 5);
+    ASSERT_EQ(largest.k(), 7);
+    for (size_t i = 0; i < smallest.k(); ++i) {
+        ASSERT_NEAR(smallest.values()(i), eigen.values()(i), 1e-12);
+    }
+    for (size_t i = 0; i < largest.k(); ++i) {
+        ASSERT_NEAR(largest.values()(i), eigen.values()(eigen.k() - largest.k() + i), 1e-12);
+    }
+    assertDecomposition(_sym, smallest, 1e-10);
+    assertDecomposition(_sym, largest, 1e-10);
+
+    eigen_t cluster{_repeated, 3, eigen_t::Smallest};
+    assertDecomposition(_repeated, cluster, 1e-10);
+
+    eigen_t values{_sym, 4, eigen_t::Largest, false};
+    ASSERT_NEAR(values.values()(3), eigen.values()(eigen.k() - 1), 1e-12);
+}
+
+TEST_F(NEigenTest, Clustered) {
+    // Wilkinson matrix W21+, its largest eigenvalues come in pairs closer than 1e-13
+    mat_t wilkinson = mat_t::zeros(21, 21);
+    for (size_t i = 0; i < wilkinson.n(); ++i) {
+        wilkinson(i, i) = std::abs(10 - (double_t) i);
+        if (i + 1 < wilkinson.n()) {
+            wilkinson(i, i + 1) = wilkinson(i + 1, i) = 1;
+        }
+    }
+    eigen_t pairs{wilkinson, 6, eigen_t::Largest};
+    ASSERT_TRUE(pairs.isConverged());
+    ASSERT_LT(pairs.values()(5) - pairs.values()(4), 1e-13);
+    assertDecomposition(wilkinson, pairs, 1e-13);
+
+    // Q D Q with a symmetric reflector Q and 20 eigenvalues spread over 2e-8
+    const size_t n = 80;
+    vec_t v = vec_t::zeros(n);
+    mat_t q = mat_t::eye(n), d = mat_t::zeros(n, n);
+    for (size_t i = 0; i < n; ++i) {
+        v(i) = cos((double_t) (3 * i + 1));
+        d(i, i) = (i < 20) ? 1 + 1e-9 * (double_t) i : 2 + (double_t) i;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            q(i, j) -= 2 * v(i) * v(j) / (v | v);
+        }
+    }
+    mat_t a = q * d * q;
+
+    eigen_t cluster{a, 20, eigen_t::Smallest};
+    ASSERT_TRUE(cluster.isConverged());
+    for (size_t i = 0; i < cluster.k(); ++i) {
+        ASSERT_NEAR(cluster.values()(i), d(i, i), 1e-13);
+    }
+    assertDecomposition(a, cluster, 1e-13);
+}
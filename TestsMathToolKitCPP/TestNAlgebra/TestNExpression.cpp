@@ -0,0 +1,127 @@
+//
+// Created on 17/10/2026.
+//
+
+#include <NPMatrix.h>
+#include <gtest/gtest.h>
+
+class NExpressionTest : public ::testing::Test {
+
+protected:
+    void SetUp() override {
+        _u = {1, 2, 3};
+        _v = {1, -1, 1};
+        _w = {2, 0, 4};
+
+        _a = {{2,  -1, 0},
+              {-1, 2,  -1},
+              {0,  -1, 2}};
+
+        _b = {{1, 0, 0},
+              {0, 1, 0},
+              {0, 0, 1}};
+    }
+
+    vec_t _u, _v, _w;
+    mat_t _a, _b;
+};
+
+TEST_F(NExpressionTest, VectorChain) {
+    vec_t x{2 * _u + _v * 3 - _w / 2};
+    ASSERT_EQ(x, vec_t({4, 1, 7}));
+
+    x = -(_u - _v) + _w;
+    ASSERT_EQ(x, vec_t({2, -3, 2}));
+
+    x += _u - _v;
+    ASSERT_EQ(x, _w);
+
+    x -= 2 * _w;
+    ASSERT_EQ(x, -_w);
+}
+
+TEST_F(NExpressionTest, InPlace) {
+    vec_t x(3);
+    const double_t *data = x.data();
+
+    x = _u + _v + _w;
+    ASSERT_EQ(x.data(), data);
+    ASSERT_EQ(x, vec_t({4, 1, 8}));
+
+    x = x - _u;
+    ASSERT_EQ(x.data(), data);
+    ASSERT_EQ(x, vec_t({3, -1, 5}));
+
+    x = _u + vec_t({1, 1, 1, 1}) (0, 2);
+    ASSERT_EQ(x, vec_t({2, 3, 4}));
+
+    x = vec_t({1, 1}) + vec_t({1, 2});
+    ASSERT_EQ(x.dim(), 2);
+}
+
+TEST_F(NExpressionTest, SubRange) {
+    vec_t x = vec_t::zeros(4);
+
+    x(1, 3) = _u(0, 2) + _w;
+    ASSERT_EQ(x, vec_t({0, 3, 2, 7}));
+
+    ASSERT_EQ(_u(1, 2) + _w(0, 1), vec_t({4, 3}));
+
+    // The operand overlaps the result with an offset, evaluation goes through a buffer
+    const auto &e = x(0, 2) + _u;
+    x(1, 3) = e;
+    ASSERT_EQ(x, vec_t({0, 1, 5, 5}));
+}
+
+TEST_F(NExpressionTest, Storage) {
+    static_assert(!std::is_move_constructible<decltype(_u + _v)>::value, "auto must not store an expression");
+    static_assert(!std::is_move_constructible<decltype(2 * (_u + _v))>::value, "auto must not store an expression");
+
+    vec_t y{_u};
+    auto s = 2 * y;
+    auto t = vec_t({1, 1, 1}) + y;
+    auto d = (_u + _v) - vec_t({1, 1, 1});
+    static_assert(std::is_same<decltype(s), vec_t>::value, "product by a scalar is a value");
+    static_assert(std::is_same<decltype(t), vec_t>::value, "temporary operand is reused");
+    static_assert(std::is_same<decltype(d), vec_t>::value, "temporary operand is reused");
+
+    y = _w;
+    ASSERT_EQ(s, vec_t({2, 4, 6}));
+    ASSERT_EQ(t, vec_t({2, 3, 4}));
+    ASSERT_EQ(d, vec_t({1, 0, 3}));
+    ASSERT_EQ(vec_t({1, 1, 1}) - _u, vec_t({0, -1, -2}));
+    ASSERT_EQ(_u - (_v + vec_t({1, 1, 1})), vec_t({-1, 2, 1}));
+}
+
+TEST_F(NExpressionTest, Conversion) {
+    ASSERT_EQ(!(_u - _u), 0);
+    ASSERT_EQ((_u + _v) | _w, 20);
+    ASSERT_EQ((_u + _v) / (_v + _u), 0);
+    ASSERT_EQ((_u + _v).n(), 1);
+    ASSERT_EQ((_u + _v).p(), 3);
+
+    std::stringstream stream;
+    stream << _u + _v;
+    ASSERT_EQ(stream.str(), vec_t({2, 1, 4}).str());
+}
+
+TEST_F(NExpressionTest, MatrixChain) {
+    mat_t c{_a + 2 * _b};
+    ASSERT_EQ(c, mat_t({{4, -1, 0}, {-1, 4, -1}, {0, -1, 4}}));
+
+    c = c / 2 - _b;
+    ASSERT_EQ(c, 0.5 * _a);
+
+    c(0, 0, 1, 1) = _a(1, 1, 2, 2) - _b(0, 0, 1, 1);
+    ASSERT_EQ(c, mat_t({{1, -1, 0}, {-1, 1, -0.5}, {0, -0.5, 1}}));
+
+    c += _a - _b;
+    c -= c - _b;
+    ASSERT_EQ(c, _b);
+}
+
+TEST_F(NExpressionTest, MatrixProduct) {
+    ASSERT_EQ((_a + _b) * (_a - _b), _a * _a - _b);
+    ASSERT_EQ((_a + _b) * (_u - _v), (_a + _b) * vec_t({0, 3, 2}));
+    ASSERT_EQ((_a + _b) * _u, _a * _u + _u);
+}
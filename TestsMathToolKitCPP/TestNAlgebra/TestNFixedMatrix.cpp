@@ -0,0 +1,60 @@
+//
+// Created on 17/10/2026.
+//
+
+#include <NFixedMatrix.h>
+#include <gtest/gtest.h>
+
+class NFixedMatrixTest : public ::testing::Test {
+
+protected:
+    void SetUp() override {
+        _a = {{2, -1, 0,  1},
+              {1, 3,  -2, 0},
+              {0, 1,  4,  -1},
+              {3, 0,  1,  2}};
+
+        _b = {{2,  1, 0},
+              {-1, 3, 1},
+              {1,  0, 4}};
+    }
+
+    mat4_t _a;
+    mat3_t _b;
+};
+
+TEST_F(NFixedMatrixTest, Construction) {
+    mat_t a = _a.matrix();
+
+    ASSERT_EQ(mat4_t::n(), 4);
+    ASSERT_EQ(sizeof(mat4_t), 16 * sizeof(double_t));
+    ASSERT_EQ(mat4_t(a), _a);
+    ASSERT_EQ(a(1, 2), -2);
+    ASSERT_EQ(_a.str(), a.str());
+    ASSERT_EQ(mat4_t::eye().matrix(), mat_t::eye(4));
+    ASSERT_EQ(_a.row(1), vec4_t({1, 3, -2, 0}));
+    ASSERT_EQ(_a.col(1), vec4_t({-1, 3, 1, 0}));
+    ASSERT_EQ(_a.trans().row(1), _a.col(1));
+    ASSERT_EQ((NFixedMatrix<double_t, 2, 3>{{1, 2, 3}, {4, 5, 6}}).trans(),
+              (NFixedMatrix<double_t, 3, 2>{{1, 4}, {2, 5}, {3, 6}}));
+}
+
+TEST_F(NFixedMatrixTest, Algebra) {
+    mat_t a = _a.matrix(), b = _b.matrix(), a_inv = a ^ -1, b_inv = b ^ -1;
+    vec4_t u{1, 2, 3, 4};
+
+    ASSERT_EQ((_a + _a).matrix(), mat_t(a + a));
+    ASSERT_EQ((_a - 2 * _a).matrix(), mat_t(-a));
+    ASSERT_EQ((_a * _a).matrix(), mat_t(a * a));
+    ASSERT_EQ((_a * u).vector(), a * u.vector());
+    ASSERT_EQ((NFixedMatrix<double_t, 2, 4>{{1, 0, 0, 0}, {0, 1, 0, 0}} * _a).row(1), _a.row(1));
+
+    ASSERT_NEAR((double) _a.det(), (double) a.det(), 1e-12);
+    ASSERT_NEAR((double) _b.det(), (double) b.det(), 1e-12);
+    ASSERT_NEAR((double) mat2_t({{1, 2}, {3, 4}}).det(), -2, 1e-15);
+    ASSERT_NEAR((double) (_a.inv().matrix() / a_inv), 0, 1e-14);
+    ASSERT_NEAR((double) (_b.inv().matrix() / b_inv), 0, 1e-14);
+    ASSERT_NEAR((double) (mat2_t({{1, 2}, {3, 4}}).inv() / mat2_t({{-2, 1}, {1.5, -0.5}})), 0, 1e-15);
+    ASSERT_NEAR((double) (NFixedMatrix<double_t, 1, 1>{{4}}.inv()(0, 0)), 0.25, 1e-15);
+    ASSERT_NEAR((double) (_a * (_a % u) / u), 0, 1e-14);
+}
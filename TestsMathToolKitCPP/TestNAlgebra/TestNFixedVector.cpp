@@ -0,0 +1,48 @@
+//
+// Created on 17/10/2026.
+//
+
+#include <NFixedVector.h>
+#include <gtest/gtest.h>
+
+class NFixedVectorTest : public ::testing::Test {
+
+protected:
+    void SetUp() override {
+        _u = {1, 2, 3, 4};
+        _v = {-1, 0, 1, 2};
+    }
+
+    vec4_t _u, _v;
+};
+
+TEST_F(NFixedVectorTest, Construction) {
+    vec_t u{1, 2, 3, 4};
+
+    ASSERT_EQ(vec4_t::dim(), 4);
+    ASSERT_EQ(sizeof(vec4_t), 4 * sizeof(double_t));
+    ASSERT_EQ(vec4_t(), vec4_t::zeros());
+    ASSERT_EQ(vec4_t({1, 2}), vec4_t({1, 2, 0, 0}));
+    ASSERT_EQ(vec4_t(u), _u);
+    ASSERT_EQ(_u.vector(), u);
+    ASSERT_EQ(_u.str(), u.str());
+    ASSERT_EQ(vec4_t::cano(2), vec4_t({0, 0, 1, 0}));
+    ASSERT_EQ(vec4_t::scalar(2), 2 * vec4_t::ones());
+    ASSERT_DOUBLE_EQ(_u(3), 4);
+}
+
+TEST_F(NFixedVectorTest, Algebra) {
+    vec_t u = _u.vector(), v = _v.vector();
+
+    ASSERT_EQ((_u + _v).vector(), vec_t(u + v));
+    ASSERT_EQ((_u - _v).vector(), vec_t(u - v));
+    ASSERT_EQ((-_u).vector(), vec_t(-u));
+    ASSERT_EQ((3 * _u / 2).vector(), vec_t(3 * u / 2));
+    ASSERT_DOUBLE_EQ(_u | _v, u | v);
+    ASSERT_DOUBLE_EQ(!_u, !u);
+    ASSERT_DOUBLE_EQ(_u / _v, u / v);
+
+    ASSERT_TRUE(vec4_t::zeros() == 0);
+    ASSERT_TRUE(_u != 0);
+    ASSERT_NE(_u, _v);
+}
@@ -0,0 +1,130 @@
+//
+// Created on 17/10/2026.
+//
+
+#include <NPMatrix.h>
+#include <NBandMatrix.h>
+#include <NSparseMatrix.h>
+#include <NKrylov.h>
+#include <gtest/gtest.h>
+
+class NKrylovTest : public ::testing::Test {
+
+protected:
+    void SetUp() override {
+        const size_t m = 30, n = m * m;
+        vector<sparse_t::Triplet> laplacian, convection;
+
+        for (size_t i = 0; i < n; ++i) {
+            laplacian.push_back({i, i, 4});
+            convection.push_back({i, i, 5});
+            if (i % m > 0) {
+                laplacian.push_back({i, i - 1, -1});
+                convection.push_back({i, i - 1, -2});
+            }
+            if (i % m + 1 < m) {
+                laplacian.push_back({i, i + 1, -1});
+                convection.push_back({i, i + 1, -0.5});
+            }
+            if (i >= m) {
+                laplacian.push_back({i, i - m, -1});
+                convection.push_back({i, i - m, -1.5});
+            }
+            if (i + m < n) {
+                laplacian.push_back({i, i + m, -1});
+                convection.push_back({i, i + m, -0.5});
+            }
+        }
+        _l = sparse_t(n, n, laplacian);
+        _c = sparse_t(n, n, convection);
+        _x = vec_t::zeros(n);
+        for (size_t k = 0; k < n; ++k) {
+            _x(k) = (double_t) (k % 13) - 6;
+        }
+    }
+
+    sparse_t _l, _c;
+    vec_t _x;
+};
+
+TEST_F(NKrylovTest, ConjugateGradient) {
+    const size_t n = _l.n();
+    vec_t b = _l * _x, x = vec_t::zeros(n), y = vec_t::zeros(n), z = vec_t::zeros(n);
+    NJacobiPreconditioner<double_t> jacobi{_l};
+    NILUPreconditioner<double_t> ilu{_l};
+    NKrylov<double_t> solver{1e-12};
+
+    ASSERT_TRUE(solver.cg(_l, b, x));
+    ASSERT_NEAR((double) (x / _x), 0, 1e-8);
+    ASSERT_EQ(solver.residuals().size(), solver.iterations() + 1);
+    ASSERT_DOUBLE_EQ(solver.residuals().front(), 1);
+    ASSERT_LE(solver.residuals().back(), solver.tolerance());
+    size_t iterations = solver.iterations();
+
+    ASSERT_TRUE(solver.cg(_l, b, y, &jacobi));
+    ASSERT_NEAR((double) (y / _x), 0, 1e-8);
+
+    ASSERT_TRUE(solver.cg(_l, b, z, &ilu));
+    ASSERT_NEAR((double) (z / _x), 0, 1e-8);
+    ASSERT_LT(solver.iterations(), iterations);
+
+    ASSERT_TRUE(solver.cg(_l, b, z));
+    ASSERT_EQ(solver.iterations(), 0);
+    ASSERT_EQ(solver.residuals().size(), 1);
+}
+
+TEST_F(NKrylovTest, NonSymmetric) {
+    const size_t n = _c.n();
+    vec_t b = _c * _x, x = vec_t::zeros(n), y = vec_t::zeros(n), z = vec_t::zeros(n), w = vec_t::zeros(n);
+    NILUPreconditioner<double_t> ilu{_c};
+    NKrylov<double_t> solver{1e-12};
+
+    ASSERT_TRUE(solver.bicgstab(_c, b, x));
+    ASSERT_NEAR((double) (x / _x), 0, 1e-8);
+    size_t iterations = solver.iterations();
+
+    ASSERT_TRUE(solver.bicgstab(_c, b, y, &ilu));
+    ASSERT_NEAR((double) (y / _x), 0, 1e-8);
+    ASSERT_LT(solver.iterations(), iterations);
+
+    ASSERT_TRUE(solver.gmres(_c, b, z));
+    ASSERT_NEAR((double) (z / _x), 0, 1e-8);
+    ASSERT_NEAR(solver.residuals().back(), (double) (!(b - _c * z) / !b), 1e-12);
+    iterations = solver.iterations();
+
+    ASSERT_TRUE(solver.gmres(_c, b, w, &ilu));
+    ASSERT_NEAR((double) (w / _x), 0, 1e-8);
+    ASSERT_LT(solver.iterations(), iterations);
+
+    solver.setRestart(5);
+    solver.setMaxIterations(10);
+    w = vec_t::zeros(n);
+    ASSERT_FALSE(solver.gmres(_c, b, w));
+    ASSERT_FALSE(solver.isConverged());
+    ASSERT_EQ(solver.iterations(), 10);
+}
+
+TEST_F(NKrylovTest, Operators) {
+    const size_t n = 50;
+    mat_t a = mat_t::nscalar({-1, 3}, n);
+    band_t band = band_t::nscalar({-1, 3}, n);
+    vec_t sol = vec_t::ones(n), b = a * sol, x = vec_t::zeros(n), y{x}, z{x};
+    NJacobiPreconditioner<double_t> jacobi{a};
+    NKrylov<double_t> solver;
+
+    ASSERT_TRUE(solver.cg(a, b, x, &jacobi));
+    ASSERT_NEAR((double) (x / sol), 0, 1e-8);
+
+    ASSERT_TRUE(solver.gmres(band, b, y));
+    ASSERT_NEAR((double) (y / sol), 0, 1e-8);
+
+    NLinearOperator<double_t> free{n, [](const vec_t &u, vec_t &v) {
+        const size_t dim = u.dim();
+        for (size_t k = 0; k < dim; ++k) {
+            v(k) = 3 * u(k) - ((k > 0) ? u(k - 1) : 0) - ((k + 1 < dim) ? u(k + 1) : 0);
+        }
+    }};
+    ASSERT_EQ(free.n(), n);
+    ASSERT_TRUE(solver.bicgstab(free, b, z));
+    ASSERT_NEAR((double) (z / sol), 0, 1e-8);
+}
@@ -0,0 +1,158 @@
+//
+// Created on 17/10/2026.
+//
+
+#include <NPMatrix.h>
+#include <NLU.h>
+#include <thread>
+#include <gtest/gtest.h>
+
+class NLUTest : public ::testing::Test {
+
+protected:
+    void SetUp() override {
+
+        _b = {{2,  -1, 0},
+              {-1, 2,  -1},
+              {0,  -1, 2}};
+
+        _c = {{0, 0,  0},
+              {1, 2,  1},
+              {5, 10, 2}};
+
+        _p = {{0, 1, 0},
+              {0, 0, 2},
+              {4, 0, 0}};
+    }
+
+    mat_t _b, _c, _p;
+};
+
+TEST_F(NLUTest, Factors) {
+    NLU<double_t> lu{_b};
+    mat_t expect_low{{1,          0,          0},
+                     {-1.0 / 2.0, 1,          0},
+                     {0,          -2.0 / 3.0, 1}};
+    mat_t expect_up{{2, -1,        0},
+                    {0, 3.0 / 2.0, -1},
+                    {0, 0,         4.0 / 3.0}};
+
+    ASSERT_EQ(lu.n(), 3);
+    ASSERT_FALSE(lu.isSingular());
+    ASSERT_NEAR((double) (lu.L() / expect_low), 0, 5e-16);
+    ASSERT_NEAR((double) (lu.U() / expect_up), 0, 5e-16);
+
+    NLU<double_t> lu_p{_p};
+    ASSERT_EQ(lu_p.perm(), std::vector<size_t>({2, 0, 1, 5}));
+    ASSERT_EQ(lu_p.L() * lu_p.U(), mat_t({{4, 0, 0}, {0, 1, 0}, {0, 0, 2}}));
+}
+
+TEST_F(NLUTest, Algebra) {
+    NLU<double_t> lu{_b};
+    vec_t u{1, 2, 5}, expect_sol{3, 5, 5};
+    mat_t b{{1, 1},
+            {2, 0},
+            {5, 1}};
+    mat_t expect_sol_mat{{3, 1},
+                         {5, 1},
+                         {5, 1}};
+
+    ASSERT_DOUBLE_EQ((double) lu.det(), 4);
+    ASSERT_DOUBLE_EQ((double) NLU<double_t>(_p).det(), 8);
+    ASSERT_NEAR((double) (lu.solve(u) / expect_sol), 0, 5e-15);
+    ASSERT_NEAR((double) (lu.solve(b) / expect_sol_mat), 0, 5e-15);
+    ASSERT_NEAR((double) (lu.inv() / (_b ^ -1)), 0, 5e-16);
+
+    mat_t d = mat_t::ones(4);
+    d(1, 1, 3, 3) = _b;
+    NLU<double_t> lu_d{d(1, 1, 3, 3)};
+    ASSERT_EQ(d.row(0), vec_t::ones(4));
+    ASSERT_DOUBLE_EQ((double) lu_d.det(), 4);
+    ASSERT_DOUBLE_EQ((double) NLU<double_t>(d.view(1, 1, 3, 3)).det(), 4);
+}
+
+TEST_F(NLUTest, Singular) {
+    NLU<double_t> lu{_c};
+    vec_t u{1, 2, 5}, expect_u{u};
+
+    ASSERT_TRUE(lu.isSingular());
+    ASSERT_DOUBLE_EQ((double) lu.det(), 0);
+    ASSERT_DOUBLE_EQ((double) lu.rcond(), 0);
+    ASSERT_EQ(lu.solve(u), expect_u);
+}
+
+TEST_F(NLUTest, RCond) {
+    const size_t n = 50;
+    mat_t a = mat_t::nscalar({-1, 2}, n), hilbert{6, 6};
+    for (size_t i = 0; i < hilbert.n(); ++i) {
+        for (size_t j = 0; j < hilbert.p(); ++j) {
+            hilbert(i, j) = 1.0 / (double_t) (i + j + 1);
+        }
+    }
+
+    ASSERT_DOUBLE_EQ((double) NLU<double_t>(mat_t::eye(5)).rcond(), 1);
+    ASSERT_DOUBLE_EQ((double) NLU<double_t>(_p).rcond(), 0.25);
+
+    double_t a_inv_norm = 0;
+    mat_t a_inv = a ^ -1;
+    for (size_t j = 0; j < n; ++j) {
+        double_t col_norm = 0;
+        for (size_t i = 0; i < n; ++i) {
+            col_norm += std::abs(a_inv(i, j));
+        }
+        a_inv_norm = std::max(a_inv_norm, col_norm);
+    }
+    ASSERT_NEAR((double) NLU<double_t>(a).rcond(), 1 / (4 * a_inv_norm), 1e-12);
+    ASSERT_LT((double) NLU<double_t>(hilbert).rcond(), 1e-6);
+}
+
+TEST_F(NLUTest, Shared) {
+    mat_t b{_b};
+    NLU<double_t> lu = _b.lu(), lu_copy{lu};
+
+    ASSERT_EQ(&lu_copy.factors(), &lu.factors());
+    ASSERT_DOUBLE_EQ((double) _b.det(), 4);
+    ASSERT_EQ(&_b.lu().factors(), &lu.factors());
+
+    b = _b;
+    ASSERT_EQ(&b.lu().factors(), &lu.factors());
+
+    b.setRow(vec_t{3, -1, 0}, 0);
+    ASSERT_DOUBLE_EQ((double) b.det(), 7);
+    ASSERT_NE(&b.lu().factors(), &lu.factors());
+
+    _b = mat_t::eye(3);
+    ASSERT_DOUBLE_EQ((double) lu.det(), 4);
+}
+
+TEST_F(NLUTest, Threads) {
+    const size_t n = 100, threads = 4;
+    mat_t a{n, n};
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            a(i, j) = (double_t) ((7 * i + 3 * j) % 11) - 5 + ((i == j) ? 0.5 : 0);
+        }
+    }
+    const NLU<double_t> lu{a};
+    std::vector<vec_t> x(threads);
+    std::vector<std::thread> workers;
+
+    for (size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&lu, &x, t, n]() {
+            for (size_t k = 0; k < 50; ++k) {
+                vec_t u = vec_t::zeros(lu.n());
+                u(t) = 1;
+                x[t] = lu.solve(u);
+            }
+        });
+    }
+    for (std::thread &worker : workers) {
+        worker.join();
+    }
+
+    for (size_t t = 0; t < threads; ++t) {
+        vec_t e = vec_t::zeros(n);
+        e(t) = 1;
+        ASSERT_NEAR((double) (a * x[t] / e), 0, 1e-9);
+    }
+}
@@ -0,0 +1,166 @@
+//
+// Created on 17/10/2026.
+//
+
+#include <NPMatrix.h>
+#include <gtest/gtest.h>
+
+class NMatrixViewTest : public ::testing::Test {
+
+protected:
+    void SetUp() override {
+
+        _a = {{1, 0, 0},
+              {0, 1, 0},
+              {0, 0, 1}};
+
+        _b = {{2,  -1, 0},
+              {-1, 2,  -1},
+              {0,  -1, 2}};
+
+        _d = {{2,  -1, 0,  3},
+              {-1, 2,  -1, 4},
+              {0,  -1, 2,  5}};
+
+        _u = {1, 2, 3, 4};
+    }
+
+    mat_t _a, _b, _d;
+    vec_t _u;
+};
+
+TEST_F(NMatrixViewTest, VectorAccess) {
+    auto u = _u.view(1, 3);
+
+    ASSERT_EQ(u.dim(), 3);
+    ASSERT_EQ(u(0), 2);
+    ASSERT_EQ(u(1, 2)(1), 4);
+
+    u(0) = 5;
+    ASSERT_EQ(_u, vec_t({1, 5, 3, 4}));
+    ASSERT_EQ(vec_t(u), vec_t({5, 3, 4}));
+}
+
+TEST_F(NMatrixViewTest, VectorAlgebra) {
+    vec_t v{1, 1, 1, 1};
+    auto u = _u.view(0, 1);
+
+    u += v.view(2, 3);
+    ASSERT_EQ(_u, vec_t({2, 3, 3, 4}));
+
+    u *= 2;
+    u -= v.view(0, 1);
+    ASSERT_EQ(_u, vec_t({3, 5, 3, 4}));
+
+    ASSERT_EQ(u.dot(v.view(0, 1)), 8);
+    ASSERT_EQ(_u.view().norm(), !_u);
+
+    _u.view(2, 3).fill(0);
+    ASSERT_EQ(_u, vec_t({3, 5, 0, 0}));
+}
+
+TEST_F(NMatrixViewTest, MatrixAccess) {
+    auto d = _d.view(1, 1, 2, 3);
+
+    ASSERT_EQ(d.n(), 2);
+    ASSERT_EQ(d.p(), 3);
+    ASSERT_EQ(d.ld(), 4);
+    ASSERT_EQ(d(1, 2), 5);
+    ASSERT_EQ(d(1, 1, 1, 2)(0, 1), 5);
+    ASSERT_EQ(vec_t(d.row(1)), vec_t({-1, 2, 5}));
+    ASSERT_EQ(vec_t(d.col(2)), vec_t({4, 5}));
+    ASSERT_EQ(vec_t(_d.colView(3)), vec_t({3, 4, 5}));
+
+    d(0, 0) = 7;
+    ASSERT_EQ(_d(1, 1), 7);
+
+    mat_t sub{_d.view(0, 1, 1, 2)};
+    ASSERT_EQ(sub, mat_t({{-1, 0}, {7, -1}}));
+}
+
+TEST_F(NMatrixViewTest, MatrixAlgebra) {
+    auto d = _d.view(0, 0, 2, 2);
+
+    d += _a.view();
+    ASSERT_EQ(_d, mat_t({{3, -1, 0, 3}, {-1, 3, -1, 4}, {0, -1, 3, 5}}));
+
+    d -= _b.view();
+    d *= 2;
+    ASSERT_EQ(_d, mat_t({{2, 0, 0, 3}, {0, 2, 0, 4}, {0, 0, 2, 5}}));
+
+    _d.view(0, 3, 2, 3).assign(_b.view(0, 1, 2, 1));
+    ASSERT_EQ(_d.col(3), vec_t({-1, 2, -1}));
+
+    _a += _b.view();
+    ASSERT_EQ(_a, mat_t({{3, -1, 0}, {-1, 3, -1}, {0, -1, 3}}));
+
+    _a(0, 0, 1, 1) -= _b.view(1, 1, 2, 2);
+    ASSERT_EQ(_a, mat_t({{1, 0, 0}, {0, 1, -1}, {0, -1, 3}}));
+}
+
+TEST_F(NMatrixViewTest, Product) {
+    mat_t c = mat_t::zeros(3, 2);
+
+    c.view().addProduct(_b.view(), _d.view(0, 2, 2, 3));
+    ASSERT_EQ(c, _b * _d(0, 2, 2, 3));
+
+    double_t c00 = c(0, 0);
+    c.view(0, 0, 1, 1).addProduct(_a.view(0, 0, 1, 1), _a.view(0, 0, 1, 1), -1);
+    ASSERT_EQ(c(0, 0), c00 - 1);
+
+    vec_t y(3);
+    _b.view().prod(_u.view(0, 2), y.view());
+    ASSERT_EQ(y, _b * vec_t({1, 2, 3}));
+
+    mat_t e = mat_t::zeros(3);
+    _d.view(0, 0, 2, 2).prod(_u.view(1, 3), e.colView(1));
+    ASSERT_EQ(e.col(1), _b * vec_t({2, 3, 4}));
+
+    vec_t z(4);
+    _d.view().transProd(_u.view(0, 2), z.view());
+    ASSERT_EQ(z, _d.transProduct(vec_t({1, 2, 3}), y));
+
+    _d.view(0, 0, 2, 2).transProd(_u.view(1, 3), e.rowView(2));
+    ASSERT_EQ(e.row(2), _b * vec_t({2, 3, 4}));
+}
+
+TEST_F(NMatrixViewTest, Inversion) {
+    ASSERT_NEAR(_b.view().det(), 4, 1e-12);
+    ASSERT_NEAR(_d.view(0, 1, 2, 3).det(), 22, 1e-12);
+    ASSERT_NEAR(_d.view(0, 1, 1, 2).det(), 1, 1e-12);
+    ASSERT_EQ(mat_t::ones(3).view().det(), 0);
+
+    vec_t x{1, 2, 3};
+    ASSERT_TRUE(_b.view().solve(x.view()));
+    ASSERT_EQ(x, _b % vec_t({1, 2, 3}));
+
+    mat_t e{_d};
+    ASSERT_TRUE(_d.view(0, 0, 2, 2).solve(e.colView(3)));
+    ASSERT_EQ(e.col(3), _b % _d.col(3));
+    ASSERT_FALSE(mat_t::ones(3).view().solve(x.view()));
+
+    _d.view(0, 1, 2, 3).trans();
+    ASSERT_EQ(_d(0, 1, 2, 3), mat_t({{-1, 2, -1}, {0, -1, 2}, {3, 4, 5}}));
+}
+
+TEST_F(NMatrixViewTest, LUPCache) {
+    ASSERT_NEAR(_b.det(), 4, 1e-12);
+
+    auto b = _b.view();
+    b *= 2;
+    ASSERT_NEAR(_b.det(), 32, 1e-12);
+}
+
+TEST_F(NMatrixViewTest, BrowseIndices) {
+    _d(0, 0, 1, 1);
+    mat_t sub{_d.view(1, 2, 2, 3)};
+    ASSERT_EQ(sub, mat_t({{-1, 4}, {2, 5}}));
+
+    _d = _a.view(0, 0, 1, 1);
+    ASSERT_EQ(_d, mat_t({{1, 0, 0, 3}, {0, 1, -1, 4}, {0, -1, 2, 5}}));
+
+    _d = _b.view();
+    ASSERT_EQ(_d, _b);
+    ASSERT_EQ(_d.n(), 3);
+    ASSERT_EQ(_d.p(), 3);
+}
@@ -254,6 +254,75 @@ TEST_F(NPMatrixTest, Transposed) {
     v.trans();
     EXPECT_EQ(v.n(), 3);
     ASSERT_EQ(v.p(), 1);
+
+    for (size_t n : {2, 5, 12, 40, 70}) {
+        for (size_t p : {3, 4, 12, 41}) {
+            mat_t m(n, p), t;
+            for (size_t i = 0; i < n; ++i) {
+                for (size_t j = 0; j < p; ++j) {
+                    m(i, j) = (double_t) (i * p + j);
+                }
+            }
+            t = m;
+            t.trans();
+
+            ASSERT_EQ(t.n(), p);
+            ASSERT_EQ(t.p(), n);
+            for (size_t i = 0; i < n; ++i) {
+                for (size_t j = 0; j < p; ++j) {
+                    ASSERT_EQ(t(j, i), m(i, j));
+                }
+            }
+            ASSERT_EQ(mat_t(m.transposed()), t);
+        }
+    }
+}
+
+TEST_F(NPMatrixTest, LazyTransposed) {
+    const size_t n = 70, p = 45;
+    mat_t a(n, p), b(n, 30), c(30, p), s = mat_t::eye(n), a_trans;
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < p; ++j) {
+            a(i, j) = sin((double_t) (i * p + j));
+        }
+        for (size_t j = 0; j < b.p(); ++j) {
+            b(i, j) = cos((double_t) (i + 3 * j));
+        }
+        for (size_t j = 0; j < n; ++j) {
+            s(i, j) += (double_t) ((i * 7 + j * 3) % 5) / n;
+        }
+    }
+    for (size_t i = 0; i < c.n(); ++i) {
+        for (size_t j = 0; j < p; ++j) {
+            c(i, j) = (double_t) ((i + j) % 7) - 3;
+        }
+    }
+    a_trans = a.transposed();
+    mat_t b_trans = b.transposed(), c_trans = c.transposed();
+
+    ASSERT_EQ(a.transposed().n(), p);
+    ASSERT_EQ(a.transposed().p(), n);
+    ASSERT_EQ(a.transposed()(3, 5), a(5, 3));
+    ASSERT_NEAR((double) (a.transposed() * b / (a_trans * b)), 0, 1e-12);
+    ASSERT_NEAR((double) (b * c_trans.transposed() / (b * c)), 0, 1e-12);
+    ASSERT_NEAR((double) (c_trans.transposed() * a.transposed() / (c * a_trans)), 0, 1e-12);
+    ASSERT_NEAR((double) (a.transposed() * a / (a_trans * a)), 0, 1e-12);
+
+    vec_t x = b.col(0);
+    ASSERT_NEAR((double) (a.transposed() * x / (a_trans * x)), 0, 1e-12);
+
+    // Sub-block selected by the browse indices
+    const mat_t &const_trans = a_trans;
+    mat_t block_trans = const_trans(2, 1, 31, 10);
+    ASSERT_NEAR((double) (a(1, 2, 10, 31).transposed() * c(0, 0, 9, 5) / (block_trans * c(0, 0, 9, 5))), 0, 1e-12);
+    ASSERT_EQ(a.transposed().n(), p);
+
+    // Solves with the transposed LU and Cholesky factors
+    mat_t s_trans = s.transposed(), spd = a_trans * a + mat_t::eye(p);
+    ASSERT_NEAR((double) (s_trans * (s.transposed() % x) / x), 0, 1e-12);
+    ASSERT_NEAR((double) (s_trans * (s.transposed() % b) / b), 0, 1e-12);
+    ASSERT_NEAR((double) (s.transposed() % b / (s_trans % b)), 0, 1e-12);
+    ASSERT_NEAR((double) (spd * (spd.transposed() % c_trans) / c_trans), 0, 1e-10);
 }
 
 TEST_F(NPMatrixTest, MatrixProd) {
@@ -284,6 +353,24 @@ TEST_F(NPMatrixTest, VectorProd) {
 
 }
 
+TEST_F(NPMatrixTest, VectorProdOutput) {
+    vec_t x{1, 2, 3, 4}, y, expect_prod{12, 16, 24}, expect_trans{0, 0, 4, 26};
+
+    ASSERT_EQ(_d.product(x, y), expect_prod);
+    ASSERT_EQ(_d.transProduct(vec_t{1, 2, 3}, y), expect_trans);
+
+    const double_t *data = y.data();
+    _d.transProduct(vec_t{1, 2, 3}, y);
+    ASSERT_EQ(y.data(), data);
+    ASSERT_EQ(y, expect_trans);
+
+    _d(0, 1, 2, 3).product(x(1, 3), y(0, 2));
+    ASSERT_EQ(y, vec_t({10, 17, 24, 26}));
+
+    _d(1, 0, 2, 2).transProduct(x(0, 1), y(1, 3));
+    ASSERT_EQ(y, vec_t({10, -1, 0, 3}));
+}
+
 TEST_F(NPMatrixTest, GaussJordan) {
     _c = _b.shifted(_a);
     _c.reduce();
@@ -297,10 +384,97 @@ TEST_F(NPMatrixTest, Pow) {
     EXPECT_EQ(_b ^ 2, b_pow_2);
     EXPECT_EQ(_b ^ 3, b_pow_3);
 
+    mat_t expect = mat_t::eye(3);
+    for (long k = 0; k <= 20; ++k) {
+        ASSERT_NEAR((double) ((_c ^ k) / expect), 0, 1e-12 * !expect);
+        expect *= _c;
+    }
+
+    // Two states Markov chain, P^k = L + (1 - a - b)^k (I - L) where L is the stationary limit
+    double_t a = 0.3, b = 0.1;
+    mat_t chain{{1 - a, a},
+                {b,     1 - b}};
+    mat_t limit{{b / (a + b), a / (a + b)},
+                {b / (a + b), a / (a + b)}};
+    for (long k : {1L, 2L, 7L, 64L, 10000L}) {
+        mat_t expect_chain = limit + (mat_t::eye(2) - limit) * std::pow(1 - a - b, (double_t) k);
+        ASSERT_NEAR((double) ((chain ^ k) / expect_chain), 0, 1e-12);
+    }
+
+    // Powers of a block, including negative ones
+    mat_t e = mat_t::eye(5), b_inv = _b ^ -1;
+    e(1, 1, 3, 3) = _b;
+    e(1, 1, 3, 3) ^= -2;
+    ASSERT_NEAR((double) (e(1, 1, 3, 3) / (b_inv * b_inv)), 0, 5e-15);
+    ASSERT_EQ(e(0, 0), 1);
+    ASSERT_EQ(e(4, 4), 1);
+    e(1, 1, 3, 3) ^= 0;
+    ASSERT_EQ(e, mat_t::eye(5));
+
     _b ^= 2;
     ASSERT_EQ(_b, b_pow_2);
 }
 
+TEST_F(NPMatrixTest, Expm) {
+    mat_t zero = mat_t::zeros(3, 3);
+    ASSERT_EQ(zero.expm(), _a);
+
+    mat_t diagonal = mat_t::zeros(4, 4);
+    double_t values[] = {1, -2, 0.5, 30};
+    for (size_t i = 0; i < 4; ++i) {
+        diagonal(i, i) = values[i];
+    }
+    diagonal.expm();
+    for (size_t i = 0; i < 4; ++i) {
+        for (size_t j = 0; j < 4; ++j) {
+            ASSERT_NEAR(diagonal(i, j), (i == j) ? exp(values[i]) : 0, 1e-14 * exp(values[i]));
+        }
+    }
+
+    mat_t nilpotent{{0, 1, 2},
+                    {0, 0, 3},
+                    {0, 0, 0}};
+    mat_t expect_nilpotent = _a + nilpotent + nilpotent * nilpotent / 2;
+    ASSERT_NEAR((double) (nilpotent.expm() / expect_nilpotent), 0, 1e-14);
+
+    // Generator of the rotations, covering every degree of the approximant and the squarings
+    for (double_t theta : {1e-3, 0.2, 0.9, 2.0, 5.0, 40.0}) {
+        mat_t rotation{{0,     -theta},
+                       {theta, 0}};
+        mat_t expect_rotation{{cos(theta), -sin(theta)},
+                              {sin(theta), cos(theta)}};
+        ASSERT_NEAR((double) (rotation.expm() / expect_rotation), 0, 1e-13);
+    }
+
+    // e^B e^-B = I and exponential of a block
+    mat_t exp_b{_b}, exp_opp_b{-_b};
+    exp_b.expm();
+    exp_opp_b.expm();
+    ASSERT_NEAR((double) (exp_b * exp_opp_b / _a), 0, 1e-13);
+
+    mat_t e = mat_t::eye(5);
+    e(1, 1, 3, 3) = _b;
+    e(1, 1, 3, 3).expm();
+    ASSERT_NEAR((double) (e(1, 1, 3, 3) / exp_b), 0, 1e-15 * !exp_b);
+    ASSERT_EQ(e(0, 0), 1);
+    ASSERT_EQ(e(4, 4), 1);
+
+    // Norm close to the largest double_t, the number of squarings is bounded by its max_exponent
+    mat_t huge{{-1e308, 0},
+               {0,      -1e308}};
+    ASSERT_EQ(huge.expm(), mat_t::zeros(2, 2));
+
+    // The approximant of a non-finite matrix cannot be inverted, the result is NaN rather than A
+    mat_t undefined = mat_t::eye(2);
+    undefined(0, 1) = std::numeric_limits<double_t>::quiet_NaN();
+    undefined.expm();
+    for (size_t i = 0; i < 2; ++i) {
+        for (size_t j = 0; j < 2; ++j) {
+            ASSERT_TRUE(std::isnan(undefined(i, j)));
+        }
+    }
+}
+
 TEST_F(NPMatrixTest, LUP) {
     mat_t b_lup_low = _b.lupL();
     mat_t b_lup_up = _b.lupU();
@@ -355,6 +529,34 @@ TEST_F(NPMatrixTest, Solve) {
     ASSERT_NEAR((double) (_b * (_b % u) / u), 0, 5e-15);
 }
 
+TEST_F(NPMatrixTest, SolveMultiple) {
+    mat_t b{{1, 1},
+            {2, 0},
+            {5, 1}};
+    mat_t expect_sol{{3, 1},
+                     {5, 1},
+                     {5, 1}};
+
+    ASSERT_NEAR((double) (_b % b / expect_sol), 0, 5e-15);
+
+    mat_t d{_d};
+    d(0, 1, 2, 2) %= _b;
+    ASSERT_NEAR((double) (d.col(1) / (_b % _d.col(1))), 0, 5e-15);
+    ASSERT_NEAR((double) (d.col(2) / (_b % _d.col(2))), 0, 5e-15);
+    ASSERT_EQ(d.col(0), _d.col(0));
+    ASSERT_EQ(d.col(3), _d.col(3));
+
+    mat_t c{_c};
+    ASSERT_EQ(c %= _b, _b % _c);
+
+    mat_t e = mat_t::ones(4);
+    e(1, 1, 3, 3) = _b;
+    e(1, 1, 3, 3) ^= -1;
+    ASSERT_NEAR((double) (e(1, 1, 3, 3) / (_b ^ -1)), 0, 5e-16);
+    ASSERT_EQ(e.row(0), vec_t::ones(4));
+    ASSERT_EQ(e.col(0), vec_t::ones(4));
+}
+
 TEST_F(NPMatrixTest, StaticGenerators) {
     mat_t expect_zeros{{0, 0, 0},
                        {0, 0, 0}};
@@ -378,3 +580,63 @@ TEST_F(NPMatrixTest, StaticGenerators) {
     EXPECT_EQ(mat_t::ndiag(data), _b);
     EXPECT_EQ(mat_t::nscalar({-1, 2}, 3), _b);
 }
+
+TEST_F(NPMatrixTest, MatrixProdBlocked) {
+    const size_t n = 131, q = 263, p = 70;
+    mat_t a{n, q}, b{q, p}, expect_prod = mat_t::zeros(n, p);
+
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t k = 0; k < q; ++k) {
+            a(i, k) = (double_t) ((i + 2 * k) % 7) - 3;
+        }
+    }
+    for (size_t k = 0; k < q; ++k) {
+        for (size_t j = 0; j < p; ++j) {
+            b(k, j) = (double_t) ((3 * k + j) % 5) - 2;
+        }
+    }
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < p; ++j) {
+            for (size_t k = 0; k < q; ++k) {
+                expect_prod(i, j) += a(i, k) * b(k, j);
+            }
+        }
+    }
+
+    ASSERT_EQ(a * b, expect_prod);
+
+    mat_t expect_sub_prod = mat_t::zeros(40);
+    for (size_t i = 0; i < 40; ++i) {
+        for (size_t j = 0; j < 40; ++j) {
+            for (size_t k = 0; k < 40; ++k) {
+                expect_sub_prod(i, j) += a(i + 1, k + 2) * b(k + 2, j + 3);
+            }
+        }
+    }
+
+    ASSERT_EQ(a(1, 2, 40, 41) * b(2, 3, 41, 42), expect_sub_prod);
+}
+
+TEST_F(NPMatrixTest, LUPBlocked) {
+    const size_t n = 150;
+    mat_t a = mat_t::nscalar({-1, 2}, n), b{n, n};
+    vec_t u = vec_t::ones(n);
+
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            b(i, j) = (double_t) ((7 * i + 3 * j) % 11) - 5 + ((i == j) ? 0.5 : 0);
+        }
+    }
+
+    ASSERT_NEAR((double) a.det(), n + 1, 1e-9);
+    a.swapRow(0, n - 1);
+    ASSERT_NEAR((double) a.det(), -1.0 * (n + 1), 1e-9);
+
+    mat_t b_lup_low = b.lupL(), b_lup_up = b.lupU();
+    ASSERT_NEAR((double) (b * (b % u) / u), 0, 1e-9);
+    ASSERT_NEAR((double) (b * (b ^ -1) / mat_t::eye(n)), 0, 1e-9);
+
+    mat_t x = mat_t::nscalar({1, 0.5}, n)(0, 0, n - 1, 69), rhs = b * x;
+    ASSERT_NEAR((double) (b % rhs / x), 0, 1e-9);
+    ASSERT_NEAR((double) (!(b_lup_low * b_lup_up) - !b), 0, 1e-9);
+}
@@ -0,0 +1,144 @@
+//
+// Created on 17/10/2026.
+//
+
+#include <NPMatrix.h>
+#include <NQR.h>
+#include <thread>
+#include <gtest/gtest.h>
+
+class NQRTest : public ::testing::Test {
+
+protected:
+    void SetUp() override {
+
+        _a = {{1, 1},
+              {1, 2},
+              {1, 3},
+              {1, 4}};
+
+        _tall = mat_t::zeros(300, 150);
+        for (size_t i = 0; i < _tall.n(); ++i) {
+            for (size_t j = 0; j < _tall.p(); ++j) {
+                _tall(i, j) = sin((double_t) (i * _tall.p() + j)) + ((i == j) ? 2 : 0);
+            }
+        }
+    }
+
+    static mat_t gram(const mat_t &q) {
+        mat_t g = mat_t::zeros(q.p(), q.p());
+        for (size_t i = 0; i < q.p(); ++i) {
+            for (size_t j = 0; j < q.p(); ++j) {
+                for (size_t k = 0; k < q.n(); ++k) {
+                    g(i, j) += q(k, i) * q(k, j);
+                }
+            }
+        }
+        return g;
+    }
+
+    mat_t _a, _tall;
+};
+
+TEST_F(NQRTest, Factors) {
+    NQR<double_t> qr{_a};
+    mat_t q = qr.Q(), r = qr.R();
+
+    ASSERT_EQ(qr.n(), 4);
+    ASSERT_EQ(qr.p(), 2);
+    ASSERT_TRUE(qr.isFullRank());
+    ASSERT_EQ(q.n(), 4);
+    ASSERT_EQ(q.p(), 2);
+    ASSERT_NEAR((double) (q * r / _a), 0, 1e-14);
+    ASSERT_NEAR((double) (gram(q) / mat_t::eye(2)), 0, 1e-15);
+    ASSERT_DOUBLE_EQ(r(1, 0), 0);
+    ASSERT_NEAR(std::abs(r(0, 0)), 2, 1e-15);
+
+    mat_t rank_deficient{{1, 2},
+                         {2, 4},
+                         {3, 6}};
+    ASSERT_FALSE(NQR<double_t>(rank_deficient).isFullRank());
+}
+
+TEST_F(NQRTest, Blocked) {
+    NQR<double_t> qr = _tall.qr();
+    mat_t q = qr.Q(), r = qr.R();
+
+    ASSERT_NEAR((double) (q * r / _tall), 0, 1e-12);
+    ASSERT_NEAR((double) (gram(q) / mat_t::eye(_tall.p())), 0, 1e-12);
+    for (size_t i = 1; i < r.n(); ++i) {
+        ASSERT_DOUBLE_EQ(r(i, i - 1), 0);
+    }
+
+    vec_t u(_tall.n()), v;
+    for (size_t i = 0; i < u.dim(); ++i) {
+        u(i) = cos((double_t) i);
+    }
+    v = u;
+    qr.transApply(v);
+    ASSERT_NEAR(!v, !u, 1e-12);
+    ASSERT_NEAR((double) (qr.apply(v) / u), 0, 1e-12);
+}
+
+TEST_F(NQRTest, LeastSquares) {
+    vec_t u{6, 5, 7, 10}, expect_sol{3.5, 1.4};
+
+    ASSERT_NEAR((double) (_a.leastSquares(u) / expect_sol), 0, 1e-14);
+    ASSERT_EQ(u.dim(), 2);
+
+    vec_t b(_tall.n());
+    for (size_t i = 0; i < b.dim(); ++i) {
+        b(i) = cos((double_t) i);
+    }
+    vec_t x{b}, atb, expect_x;
+    mat_t normal = gram(_tall);
+    expect_x = normal % _tall.transProduct(b, atb);
+
+    ASSERT_NEAR((double) (_tall.leastSquares(x) / expect_x), 0, 1e-10);
+    ASSERT_EQ(x.dim(), _tall.p());
+
+    mat_t square{{2, 1},
+                 {1, 3}};
+    vec_t w{3, 5}, expect_w{0.8, 1.4};
+    ASSERT_NEAR((double) (square.leastSquares(w) / expect_w), 0, 1e-14);
+
+    mat_t rank_deficient{{1, 2},
+                         {2, 4},
+                         {3, 6}};
+    ASSERT_FALSE(rank_deficient.qr().isFullRank());
+    ASSERT_TRUE(_a.qr().isFullRank());
+#ifndef NDEBUG
+    vec_t z{1, 2, 3};
+    ::testing::FLAGS_gtest_death_test_style = "threadsafe";
+    ASSERT_DEATH(rank_deficient.leastSquares(z), "");
+#endif
+}
+
+TEST_F(NQRTest, Threads) {
+    const size_t threads = 4;
+    const NQR<double_t> qr{_tall};
+    vec_t b(_tall.n());
+    for (size_t i = 0; i < b.dim(); ++i) {
+        b(i) = cos((double_t) i);
+    }
+    vec_t expect_x{b};
+    qr.leastSquares(expect_x);
+
+    std::vector<vec_t> x(threads);
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&qr, &x, &b, t]() {
+            for (size_t k = 0; k < 20; ++k) {
+                vec_t u{b};
+                x[t] = qr.leastSquares(u);
+            }
+        });
+    }
+    for (std::thread &worker : workers) {
+        worker.join();
+    }
+
+    for (size_t t = 0; t < threads; ++t) {
+        ASSERT_EQ(x[t], expect_x);
+    }
+}
@@ -0,0 +1,175 @@
+//
+// Created on 17/10/2026.
+//
+
+#include <NPMatrix.h>
+#include <NSVD.h>
+#include <gtest/gtest.h>
+
+typedef NSVD<double_t> svd_t;
+
+class NSVDTest : public ::testing::Test {
+
+protected:
+    void SetUp() override {
+        _tall = mat_t(40, 12);
+        for (size_t i = 0; i < _tall.n(); ++i) {
+            for (size_t j = 0; j < _tall.p(); ++j) {
+                _tall(i, j) = sin((double_t) (i * _tall.p() + j));
+            }
+        }
+
+        _wide = mat_t(9, 25);
+        for (size_t i = 0; i < _wide.n(); ++i) {
+            for (size_t j = 0; j < _wide.p(); ++j) {
+                _wide(i, j) = cos((double_t) (3 * i + j * j));
+            }
+        }
+
+        // Rank 8 matrix with singular values decaying geometrically
+        mat_t x(300, 8), y(8, 200);
+        for (size_t i = 0; i < x.n(); ++i) {
+            for (size_t j = 0; j < x.p(); ++j) {
+                x(i, j) = sin((double_t) (i * x.p() + j)) * pow(2.0, -(double_t) j);
+            }
+        }
+        for (size_t i = 0; i < y.n(); ++i) {
+            for (size_t j = 0; j < y.p(); ++j) {
+                y(i, j) = cos((double_t) (i * y.p() + 2 * j));
+            }
+        }
+        _lowRank = x * y;
+    }
+
+    /**
+     * Check A = U S V^T, U^T U = I, V^T V = I and the order of the singular values.
+     */
+    static void assertDecomposition(const mat_t &a, const svd_t &svd, double_t tol) {
+        ASSERT_EQ(svd.n(), a.n());
+        ASSERT_EQ(svd.p(), a.p());
+        ASSERT_EQ(svd.k(), std::min(a.n(), a.p()));
+
+        mat_t approximation = svd.approximation();
+        for (size_t i = 0; i < a.n(); ++i) {
+            for (size_t j = 0; j < a.p(); ++j) {
+                ASSERT_NEAR(approximation(i, j), a(i, j), tol);
+            }
+        }
+        for (size_t c = 0; c < svd.k(); ++c) {
+            ASSERT_GE(svd.S()(c), 0);
+            if (c > 0) {
+                ASSERT_LE(svd.S()(c), svd.S()(c - 1));
+            }
+        }
+        assertOrthonormal(svd, tol);
+    }
+
+    static void assertOrthonormal(const svd_t &svd, double_t tol) {
+        const mat_t &u = svd.U(), &vt = svd.Vt();
+        for (size_t c1 = 0; c1 < svd.k(); ++c1) {
+            for (size_t c2 = 0; c2 < svd.k(); ++c2) {
+                double_t u_dot = 0, v_dot = 0;
+                for (size_t i = 0; i < u.n(); ++i) {
+                    u_dot += u(i, c1) * u(i, c2);
+                }
+                for (size_t j = 0; j < vt.p(); ++j) {
+                    v_dot += vt(c1, j) * vt(c2, j);
+                }
+                ASSERT_NEAR(u_dot, (c1 == c2) ? 1 : 0, tol);
+                ASSERT_NEAR(v_dot, (c1 == c2) ? 1 : 0, tol);
+            }
+        }
+    }
+
+    mat_t _tall, _wide, _lowRank;
+};
+
+TEST_F(NSVDTest, Small) {
+    mat_t a{{3, 0},
+            {4, 5}};
+    svd_t svd{a};
+
+    ASSERT_TRUE(svd.isConverged());
+    ASSERT_NEAR(svd.S()(0), 3 * sqrt(5.0), 1e-14);
+    ASSERT_NEAR(svd.S()(1), sqrt(5.0), 1e-14);
+    assertDecomposition(a, svd, 1e-14);
+
+    mat_t one{{-2}};
+    svd_t scalar{one};
+    ASSERT_DOUBLE_EQ(scalar.S()(0), 2);
+    ASSERT_DOUBLE_EQ(scalar.U()(0, 0) * scalar.Vt()(0, 0), -1);
+}
+
+TEST_F(NSVDTest, Jacobi) {
+    svd_t tall{_tall}, wide{_wide};
+
+    ASSERT_TRUE(tall.isConverged());
+    ASSERT_TRUE(wide.isConverged());
+    assertDecomposition(_tall, tall, 1e-12);
+    assertDecomposition(_wide, wide, 1e-12);
+
+    // Sum of the squared singular values is the squared Frobenius norm
+    double_t norm = 0, sum = 0;
+    for (size_t i = 0; i < _tall.n(); ++i) {
+        for (size_t j = 0; j < _tall.p(); ++j) {
+            norm += _tall(i, j) * _tall(i, j);
+        }
+    }
+    for (size_t c = 0; c < tall.k(); ++c) {
+        sum += tall.S()(c) * tall.S()(c);
+    }
+    ASSERT_NEAR(sum, norm, 1e-10);
+
+    // Block selected by the browse indices
+    const mat_t &tall_ref = _tall;
+    mat_t square = tall_ref(0, 0, 11, 11);
+    svd_t block{_tall(0, 0, 11, 11)};
+    ASSERT_EQ(block.n(), 12);
+    ASSERT_EQ(block.p(), 12);
+    assertDecomposition(square, block, 1e-12);
+}
+
+TEST_F(NSVDTest, RankDeficient) {
+    mat_t a{{1, 2, 3},
+            {2, 4, 6},
+            {1, 0, 1},
+            {0, 1, 1}};
+    svd_t svd{a};
+
+    ASSERT_TRUE(svd.isConverged());
+    ASSERT_NEAR(svd.S()(2), 0, 1e-14);
+    ASSERT_GT(svd.S()(1), 0.1);
+    mat_t approximation = svd.approximation();
+    for (size_t i = 0; i < a.n(); ++i) {
+        for (size_t j = 0; j < a.p(); ++j) {
+            ASSERT_NEAR(approximation(i, j), a(i, j), 1e-14);
+        }
+    }
+}
+
+TEST_F(NSVDTest, Randomized) {
+    svd_t exact{_lowRank}, randomized{_lowRank, 8};
+
+    ASSERT_EQ(randomized.n(), _lowRank.n());
+    ASSERT_EQ(randomized.p(), _lowRank.p());
+    ASSERT_EQ(randomized.k(), 8);
+    for (size_t c = 0; c < randomized.k(); ++c) {
+        ASSERT_NEAR(randomized.S()(c), exact.S()(c), 1e-10 * exact.S()(0));
+    }
+    assertOrthonormal(randomized, 1e-12);
+
+    mat_t approximation = randomized.approximation();
+    for (size_t i = 0; i < _lowRank.n(); ++i) {
+        for (size_t j = 0; j < _lowRank.p(); ++j) {
+            ASSERT_NEAR(approximation(i, j), _lowRank(i, j), 1e-10);
+        }
+    }
+
+    // Truncated decomposition of a full rank matrix
+    svd_t full{_tall}, truncated{_tall, 4, 3, 2};
+    ASSERT_EQ(truncated.k(), 4);
+    for (size_t c = 0; c < truncated.k(); ++c) {
+        ASSERT_NEAR(truncated.S()(c), full.S()(c), 1e-2 * full.S()(0));
+    }
+    assertOrthonormal(truncated, 1e-12);
+}
@@ -0,0 +1,96 @@
+//
+// Created on 17/10/2026.
+//
+
+#include <NPMatrix.h>
+#include <NSparseMatrix.h>
+#include <NKrylov.h>
+#include <gtest/gtest.h>
+
+class NSparseMatrixTest : public ::testing::Test {
+
+protected:
+    void SetUp() override {
+
+        _a = {{4, 0, 0, 1},
+              {0, 0, 2, 0},
+              {3, 0, 5, 0}};
+
+        _b = {{1, 2},
+              {3, 4},
+              {5, 6},
+              {7, 8}};
+    }
+
+    mat_t _a, _b;
+};
+
+TEST_F(NSparseMatrixTest, Construction) {
+    sparse_t a{_a}, b{3, 4, {{2, 2, 2}, {0, 3, 1}, {1, 2, 2}, {2, 0, 3}, {0, 0, 4}, {2, 2, 3}}};
+
+    ASSERT_EQ(a.n(), 3);
+    ASSERT_EQ(a.p(), 4);
+    ASSERT_EQ(a.nnz(), 5);
+    ASSERT_EQ(a.rows(), vector<size_t>({0, 2, 3, 5}));
+    ASSERT_EQ(a.cols(), vector<size_t>({0, 3, 2, 0, 2}));
+    ASSERT_EQ(a, b);
+    ASSERT_EQ(a.dense(), _a);
+    ASSERT_EQ(a.str(), _a.str());
+    ASSERT_NE(a, sparse_t(3, 4));
+    ASSERT_EQ(sparse_t(3, 4).dense(), mat_t::zeros(3, 4));
+
+    ASSERT_DOUBLE_EQ(a(2, 2), 5);
+    ASSERT_DOUBLE_EQ(a(1, 1), 0);
+    ASSERT_DOUBLE_EQ(a(0, 3), 1);
+
+    mat_t a_trans{_a};
+    ASSERT_EQ(a.trans().dense(), a_trans.trans());
+}
+
+TEST_F(NSparseMatrixTest, Products) {
+    sparse_t a{_a};
+    vec_t x{1, 2, 3, 4}, y{1, 2, 3}, z;
+    mat_t a_trans{_a};
+    a_trans.trans();
+
+    ASSERT_EQ(a * x, _a * x);
+    ASSERT_EQ(a.transProduct(y, z), a_trans * y);
+    ASSERT_EQ(a * _b, _a * _b);
+}
+
+TEST_F(NSparseMatrixTest, ConjugateGradient) {
+    const size_t n = 200;
+    mat_t l = mat_t::nscalar({-1, 2}, n);
+    sparse_t a{l};
+    vec_t x = vec_t::ones(n), u = a * x, v{u}, w = vec_t::zeros(n);
+
+    ASSERT_EQ(a.nnz(), 3 * n - 2);
+    ASSERT_NEAR((double) (a.solve(u) / x), 0, 1e-8);
+    ASSERT_NEAR((double) ((a % v) / x), 0, 1e-8);
+
+    NKrylov<double_t> solver;
+    ASSERT_TRUE(solver.cg(a, v, w));
+    ASSERT_LE(solver.iterations(), n);
+    ASSERT_TRUE(solver.cg(a, v, w));
+    ASSERT_EQ(solver.iterations(), 0);
+}
+
+TEST_F(NSparseMatrixTest, Threads) {
+    const size_t m = 300, n = m * m;
+    vector<sparse_t::Triplet> triplets;
+
+    for (size_t i = 0; i < n; ++i) {
+        triplets.push_back({i, i, 4});
+        if (i % m > 0) triplets.push_back({i, i - 1, -1});
+        if (i % m + 1 < m) triplets.push_back({i, i + 1, -2});
+        if (i >= m) triplets.push_back({i, i - m, -1});
+    }
+    sparse_t a{n, n, triplets}, a_trans = a.trans();
+    vec_t x = vec_t::ones(n), y, z;
+
+    for (size_t k = 0; k < n; ++k) {
+        x(k) = (double_t) (k % 7);
+    }
+    ASSERT_EQ(a.transProduct(x, y), a_trans * x);
+    ASSERT_EQ(a_trans.transProduct(x, z), a * x);
+}
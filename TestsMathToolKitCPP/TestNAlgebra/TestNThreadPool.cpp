@@ -0,0 +1,158 @@
+//
+// Created on 17/10/2026.
+//
+
+#include <NThreadPool.h>
+#include <NPMatrix.h>
+#include <set>
+#include <stdexcept>
+#include <gtest/gtest.h>
+
+class NThreadPoolTest : public ::testing::Test {
+
+protected:
+    void SetUp() override {
+        _workers = NThreadPool::instance().workers();
+        NThreadPool::instance().setWorkers(4);
+    }
+
+    void TearDown() override {
+        NThreadPool::instance().setWorkers(_workers);
+    }
+
+    size_t _workers{};
+};
+
+TEST_F(NThreadPoolTest, Workers) {
+    ASSERT_EQ(NThreadPool::instance().workers(), 4);
+
+    NThreadPool::instance().setWorkers(0);
+    ASSERT_EQ(NThreadPool::instance().workers(), 1);
+}
+
+TEST_F(NThreadPoolTest, ParallelFor) {
+    std::vector<int> visits(1000, 0);
+
+    NThreadPool::instance().parallelFor(0, visits.size(), 10, [&](size_t k1, size_t k2) {
+        EXPECT_EQ(k1 % 10, 0);
+        for (size_t k = k1; k < k2; ++k) {
+            visits[k]++;
+        }
+    });
+
+    ASSERT_EQ(std::count(visits.begin(), visits.end(), 1), 1000);
+}
+
+TEST_F(NThreadPoolTest, Nested) {
+    std::vector<int> visits(100 * 100, 0);
+
+    NThreadPool::instance().parallelFor(0, 100, 1, [&](size_t i1, size_t i2) {
+        for (size_t i = i1; i < i2; ++i) {
+            NThreadPool::instance().parallelFor(0, 100, 1, [&](size_t j1, size_t j2) {
+                for (size_t j = j1; j < j2; ++j) {
+                    visits[100 * i + j]++;
+                }
+            });
+        }
+    });
+
+    ASSERT_EQ(std::count(visits.begin(), visits.end(), 1), 100 * 100);
+}
+
+TEST_F(NThreadPoolTest, Exception) {
+    std::vector<int> visits(1000, 0);
+    auto body = [&](size_t k1, size_t k2) {
+        if (k1 == 500) {
+            throw std::runtime_error("body");
+        }
+        for (size_t k = k1; k < k2; ++k) {
+            visits[k]++;
+        }
+    };
+
+    ASSERT_THROW(NThreadPool::instance().parallelFor(0, visits.size(), 10, body), std::runtime_error);
+    ASSERT_EQ(visits[500], 0);
+
+    // The calling thread is still dispatching to the workers
+    std::mutex mutex;
+    std::set<std::thread::id> ids;
+    NThreadPool::instance().parallelFor(0, 40, 1, [&](size_t, size_t) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ids.insert(std::this_thread::get_id());
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    });
+    ASSERT_GT(ids.size(), 1);
+}
+
+TEST_F(NThreadPoolTest, ConcurrentCallers) {
+    std::vector<std::vector<int>> visits(4, std::vector<int>(1000, 0));
+    std::vector<std::thread> callers;
+
+    for (size_t t = 0; t < visits.size(); ++t) {
+        callers.emplace_back([&visits, t] {
+            for (size_t r = 0; r < 20; ++r) {
+                NThreadPool::instance().parallelFor(0, 1000, 10, [&visits, t](size_t k1, size_t k2) {
+                    for (size_t k = k1; k < k2; ++k) {
+                        visits[t][k]++;
+                    }
+                });
+            }
+        });
+    }
+    for (auto &caller : callers) {
+        caller.join();
+    }
+
+    for (const auto &v : visits) {
+        ASSERT_EQ(std::count(v.begin(), v.end(), 20), 1000);
+    }
+}
+
+TEST_F(NThreadPoolTest, MatrixProd) {
+    mat_t a = mat_t::nscalar({-1, 2}, 150), b = mat_t::ones(150), expect_prod = mat_t::zeros(150);
+    vec_t u = vec_t::ones(150), expect_u = vec_t::zeros(150);
+
+    expect_prod.setRow(vec_t::ones(150), 0).setRow(vec_t::ones(150), 149);
+    expect_u(0) = 1;
+    expect_u(149) = 1;
+
+    ASSERT_EQ(a * b, expect_prod);
+    ASSERT_EQ(a * u, expect_u);
+}
+
+TEST_F(NThreadPoolTest, MatrixVectorProd) {
+    mat_t a = mat_t::nscalar({-1, 2}, 601);
+    vec_t u = vec_t::ones(601), y, expect_u = vec_t::zeros(601);
+
+    expect_u(0) = 1;
+    expect_u(600) = 1;
+
+    ASSERT_EQ(a.product(u, y), expect_u);
+    ASSERT_EQ(a.transProduct(u, y), expect_u);
+}
+
+TEST_F(NThreadPoolTest, Reduction) {
+    vec_t u = vec_t::ones(4 * NTHREADPOOL_MIN_SIZE + 3), v = vec_t::scalar(2, 4 * NTHREADPOOL_MIN_SIZE + 3);
+
+    ASSERT_EQ(u | v, 2 * (4 * NTHREADPOOL_MIN_SIZE + 3));
+    ASSERT_EQ(u / v, sqrt(4 * NTHREADPOOL_MIN_SIZE + 3));
+}
+
+TEST_F(NThreadPoolTest, ReductionDeterminism) {
+    const size_t n = 7 * NTHREADPOOL_MIN_SIZE + 5;
+    vec_t u = vec_t::zeros(n), v = vec_t::zeros(n);
+    for (size_t k = 0; k < n; ++k) {
+        u(k) = 1.0 / (double_t) (k + 1);
+        v(k) = sin((double_t) k);
+    }
+
+    double_t dot = u | v, norm = !u, dist = u / v;
+    for (size_t workers = 1; workers <= 8; ++workers) {
+        NThreadPool::instance().setWorkers(workers);
+        ASSERT_EQ(u | v, dot);
+        ASSERT_EQ(!u, norm);
+        ASSERT_EQ(u / v, dist);
+    }
+}
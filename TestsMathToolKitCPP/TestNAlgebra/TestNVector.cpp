@@ -2,7 +2,7 @@
 // Created by Sami Dahoux on 20/09/2018.
 //
 
-#include <NVector.h>
+#include <NPMatrix.h>
 #include <gtest/gtest.h>
 
 
@@ -121,6 +121,48 @@ TEST_F(NVectorTest, EuclideanOperations) {
     ASSERT_EQ(_u / _u, 0);
 }
 
+TEST_F(NVectorTest, EuclideanKernels) {
+    for (size_t n = 1; n < 68; ++n) {
+        vec_t u(n), v(n);
+        double_t expect_dot = 0, expect_dist = 0;
+        for (size_t k = 0; k < n; ++k) {
+            u(k) = (double_t) k / 4 - 3;
+            v(k) = 1 - (double_t) (k % 5);
+            expect_dot += u(k) * v(k);
+            expect_dist += (u(k) - v(k)) * (u(k) - v(k));
+        }
+
+        ASSERT_NEAR(u | v, expect_dot, 1e-12);
+        ASSERT_NEAR(u / v, sqrt(expect_dist), 1e-12);
+        ASSERT_NEAR(u / v, !vec_t(u - v), 1e-12);
+    }
+
+    vec_t u{1, 2, 3, 4, 5}, v{5, 4, 3, 2, 1};
+    ASSERT_EQ(u(1, 3) | v(0, 2), 34);
+    ASSERT_EQ(u(1, 2) / v(3, 4), 2);
+    ASSERT_EQ(u | v, 35);
+}
+
+TEST_F(NVectorTest, Allocator) {
+    vec_t u = vec_t::ones(13);
+    mat_t a = mat_t::eye(7);
+
+    ASSERT_EQ((uintptr_t) u.data() % NALIGNED_ALLOCATOR_ALIGNMENT, 0);
+    ASSERT_EQ((uintptr_t) a.data() % NALIGNED_ALLOCATOR_ALIGNMENT, 0);
+    ASSERT_EQ((uintptr_t) vec_t(u + u).data() % NALIGNED_ALLOCATOR_ALIGNMENT, 0);
+
+    u.resize(1000);
+    ASSERT_EQ((uintptr_t) u.data() % NALIGNED_ALLOCATOR_ALIGNMENT, 0);
+
+    typedef NVector<double_t, std::allocator<double_t>> std_vec_t;
+    std_vec_t v{1, 2, 3}, w{3, 2, 1};
+    ASSERT_EQ(v + w, std_vec_t::scalar(4, 3));
+    ASSERT_EQ(v | w, 10);
+
+    NPMatrix<double_t, std::allocator<double_t>> b{{2, 1}, {1, 2}};
+    ASSERT_NEAR(b.det(), 3, 1e-12);
+}
+
 TEST_F(NVectorTest, MaxMin) {
     ASSERT_EQ(_u.max(), 1);
     ASSERT_EQ(_u.min(), 0);
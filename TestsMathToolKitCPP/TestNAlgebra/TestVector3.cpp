@@ -61,4 +61,15 @@ TEST_F(Vector3Test, Angle) {
     ASSERT_EQ(_u % _u, 0);
     ASSERT_EQ(_v % _v, 0);
     ASSERT_EQ(_w % _w, 0);
-}
\ No newline at end of file
+}
+
+TEST_F(Vector3Test, Storage) {
+    std::vector<Vector3> vectors(1000, Vector3(1, 2, 3));
+
+    ASSERT_EQ(sizeof(Vector3), 3 * sizeof(double_t));
+    ASSERT_EQ((char *) &vectors[999] - (char *) &vectors[0], 999 * 24);
+    ASSERT_EQ(vectors[999].vector(), vec_t({1, 2, 3}));
+    ASSERT_EQ(Vector3(vec_t({1, 2, 3})), vectors[0]);
+    ASSERT_EQ(_u + 2 * _v - _w / 2, Vector3(1, 2, -0.5));
+    ASSERT_DOUBLE_EQ(_u / _v, sqrt(2));
+}
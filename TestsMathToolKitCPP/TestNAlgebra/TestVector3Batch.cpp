@@ -0,0 +1,140 @@
+//
+// Created on 17/10/2026.
+//
+
+#include <Vector3Batch.h>
+#include <NCpu.h>
+#include <gtest/gtest.h>
+
+class Vector3BatchTest : public ::testing::Test {
+
+protected:
+    void SetUp() override {
+        _level = NCpu::instance().level();
+        for (size_t k = 0; k < 67; ++k) {
+            const double_t t = (double_t) k;
+            _u.emplace_back(cos(t) * t / 8, 2 - (double_t) (k % 5), sin(3 * t));
+            _v.emplace_back((double_t) (k % 3) - 1, t / 16, cos(t) - 0.5);
+        }
+        _u[7] = Vector3::zeros();
+        _v[12] = Vector3::zeros();
+        _v[20] = -2 * _u[20];
+        _v[21] = _u[21];
+    }
+
+    void TearDown() override {
+        NCpu::instance().setLevel(_level);
+    }
+
+    std::vector<NCpu::Level> levels() const {
+        std::vector<NCpu::Level> levels;
+        for (NCpu::Level level : {NCpu::Scalar, NCpu::SSE2, NCpu::AVX2, NCpu::AVX512}) {
+            if (level <= NCpu::instance().maxLevel()) {
+                levels.push_back(level);
+            }
+        }
+        return levels;
+    }
+
+    NCpu::Level _level{};
+    std::vector<Vector3> _u;
+    std::vector<Vector3> _v;
+};
+
+TEST_F(Vector3BatchTest, Construction) {
+    Vector3Batch batch(_u), empty;
+
+    ASSERT_EQ(batch.size(), _u.size());
+    ASSERT_EQ(empty.size(), 0);
+    for (size_t k = 0; k < _u.size(); ++k) {
+        ASSERT_EQ(batch[k], _u[k]);
+        ASSERT_EQ(batch.x()[k], _u[k].x());
+        ASSERT_EQ(batch.z()[k], _u[k].z());
+    }
+
+    empty.append(_u[3]);
+    empty.append(_u[4]);
+    ASSERT_EQ(empty.size(), 2);
+    ASSERT_EQ(empty[1], _u[4]);
+
+    empty.set(0, _v[0]);
+    ASSERT_EQ(empty.vectors()[0], _v[0]);
+
+    empty.resize(3);
+    ASSERT_EQ(empty[2], Vector3::zeros());
+    ASSERT_EQ(empty.str(), _v[0].str() + "\n" + _u[4].str() + "\n" + Vector3().str() + "\n");
+}
+
+TEST_F(Vector3BatchTest, Algebra) {
+    for (NCpu::Level level : levels()) {
+        NCpu::instance().setLevel(level);
+
+        for (size_t n : {1, 3, 8, 13, 67}) {
+            std::vector<Vector3> u(_u.begin(), _u.begin() + n), v(_v.begin(), _v.begin() + n);
+            Vector3Batch u_batch(u), v_batch(v);
+            vec_t dot = u_batch | v_batch, norm = !u_batch, angle = u_batch % v_batch;
+            Vector3Batch cross = u_batch ^ v_batch;
+
+            ASSERT_EQ(dot.dim(), n);
+            for (size_t k = 0; k < n; ++k) {
+                ASSERT_NEAR(dot(k), u[k] | v[k], 1e-12);
+                ASSERT_NEAR(norm(k), !u[k], 1e-12);
+                ASSERT_NEAR(angle(k), u[k] % v[k], 1e-12);
+                ASSERT_NEAR(cross[k] / (u[k] ^ v[k]), 0, 1e-12);
+            }
+
+            u_batch.normalize();
+            for (size_t k = 0; k < n; ++k) {
+                ASSERT_NEAR(u_batch[k] / ((u[k] == 0) ? u[k] : u[k] / !u[k]), 0, 1e-15);
+            }
+        }
+    }
+}
+
+TEST_F(Vector3BatchTest, Coordinates) {
+    Vector3Batch batch(_u), copy;
+    vec_t r, theta, phi;
+
+    batch.r(r);
+    batch.theta(theta);
+    batch.phi(phi);
+    for (size_t k = 0; k < _u.size(); ++k) {
+        ASSERT_NEAR(r(k), _u[k].r(), 1e-12);
+        ASSERT_NEAR(theta(k), _u[k].theta(), 1e-12);
+        ASSERT_NEAR(phi(k), _u[k].phi(), 1e-12);
+    }
+
+    copy.setRThetaPhi(r, theta, phi);
+    ASSERT_EQ(copy.size(), _u.size());
+    for (size_t k = 0; k < _u.size(); ++k) {
+        ASSERT_NEAR(copy[k] / _u[k], 0, 1e-12);
+    }
+
+    vec_t z(_u.size());
+    for (size_t k = 0; k < _u.size(); ++k) {
+        r(k) = !_u[k].rXY();
+        z(k) = _u[k].z();
+    }
+    copy.setRThetaZ(r, theta, z);
+    for (size_t k = 0; k < _u.size(); ++k) {
+        ASSERT_NEAR(copy[k] / _u[k], 0, 1e-12);
+    }
+}
+
+TEST_F(Vector3BatchTest, LargeBatch) {
+    const size_t n = 100003;
+    Vector3Batch u(n), v(n);
+    for (size_t k = 0; k < n; ++k) {
+        u.set(k, _u[k % _u.size()]);
+        v.set(k, _v[k % _v.size()]);
+    }
+
+    vec_t dot = u | v, angle = u % v;
+    u ^= v;
+    for (size_t k = 0; k < n; k += 997) {
+        const Vector3 &u_k = _u[k % _u.size()], &v_k = _v[k % _v.size()];
+        ASSERT_NEAR(dot(k), u_k | v_k, 1e-12);
+        ASSERT_NEAR(angle(k), u_k % v_k, 1e-12);
+        ASSERT_NEAR(u[k] / (u_k ^ v_k), 0, 1e-12);
+    }
+}